@@ -89,12 +89,14 @@ if(ENABLE_ECL_INPUT)
     src/opm/parser/eclipse/EclipseState/Schedule/Events.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/Group/Group2.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/Group/GTNode.cpp
+    src/opm/parser/eclipse/EclipseState/Schedule/Group/GroupTopology.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/Well/injection.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/MessageLimits.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/MSW/Compsegs.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/MSW/Segment.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/MSW/WellSegments.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/MSW/updatingConnectionsWithSegments.cpp
+    src/opm/parser/eclipse/EclipseState/Schedule/NamePattern.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/RFTConfig.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/Schedule.cpp
@@ -122,6 +124,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/parser/eclipse/EclipseState/Tables/ColumnSchema.cpp
     src/opm/parser/eclipse/EclipseState/Tables/JFunc.cpp
     src/opm/parser/eclipse/EclipseState/Tables/PvtxTable.cpp
+    src/opm/parser/eclipse/EclipseState/Tables/ResampledColumn.cpp
     src/opm/parser/eclipse/EclipseState/Tables/SimpleTable.cpp
     src/opm/parser/eclipse/EclipseState/Tables/PolyInjTables.cpp
     src/opm/parser/eclipse/EclipseState/Tables/TableColumn.cpp
@@ -135,6 +138,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQASTNode.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParams.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParser.cpp
+    src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQProgram.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQSet.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQAssign.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQDefine.cpp
@@ -167,6 +171,8 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list( APPEND MAIN_SOURCE_FILES
+          src/opm/io/eclipse/Columnar.cpp
+          src/opm/io/eclipse/EclCompress.cpp
           src/opm/io/eclipse/EclFile.cpp
           src/opm/io/eclipse/EclOutput.cpp
           src/opm/io/eclipse/EclUtil.cpp
@@ -194,7 +200,9 @@ if(ENABLE_ECL_OUTPUT)
           src/opm/output/eclipse/Tables.cpp
           src/opm/output/eclipse/RegionCache.cpp
           src/opm/output/eclipse/RestartValue.cpp
+          src/opm/output/eclipse/StaticWellCache.cpp
           src/opm/output/eclipse/WriteInit.cpp
+          src/opm/output/eclipse/WriteRFT.cpp
           src/opm/output/data/Solution.cpp
       )
 endif()
@@ -203,6 +211,7 @@ list (APPEND TEST_SOURCE_FILES
       tests/test_calculateCellVol.cpp
       tests/test_cmp.cpp
       tests/test_cubic.cpp
+      tests/test_linearInterpolation.cpp
       tests/test_messagelimiter.cpp
       tests/test_nonuniformtablelinear.cpp
       tests/test_OpmLog.cpp
@@ -244,6 +253,7 @@ if(ENABLE_ECL_INPUT)
     tests/parser/MultiRegTests.cpp
     tests/parser/MultisegmentWellTests.cpp
     tests/parser/MULTREGTScannerTests.cpp
+    tests/parser/NamePatternTests.cpp
     tests/parser/OrderedMapTests.cpp
     tests/parser/ParseContextTests.cpp
     tests/parser/ParseContext_EXIT1.cpp
@@ -385,6 +395,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/numeric/linearInterpolation.hpp
       opm/common/utility/numeric/MonotCubicInterpolator.hpp
       opm/common/utility/numeric/NonuniformTableLinear.hpp
+      opm/common/utility/numeric/PiecewiseLinearTable.hpp
       opm/common/utility/numeric/RootFinders.hpp
       opm/common/utility/numeric/SparseVector.hpp
       opm/common/utility/numeric/UniformTableLinear.hpp
@@ -478,6 +489,7 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/EclipseState/Tables/EnkrvdTable.hpp
        opm/parser/eclipse/EclipseState/Tables/PlyrockTable.hpp
        opm/parser/eclipse/EclipseState/Tables/PvtxTable.hpp
+       opm/parser/eclipse/EclipseState/Tables/ResampledColumn.hpp
        opm/parser/eclipse/EclipseState/Tables/WatvisctTable.hpp
        opm/parser/eclipse/EclipseState/Tables/TableEnums.hpp
        opm/parser/eclipse/EclipseState/Tables/RvvdTable.hpp
@@ -544,8 +556,10 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp
        opm/parser/eclipse/EclipseState/Schedule/Tuning.hpp
        opm/parser/eclipse/EclipseState/Schedule/Group/GTNode.hpp
+       opm/parser/eclipse/EclipseState/Schedule/Group/GroupTopology.hpp
        opm/parser/eclipse/EclipseState/Schedule/Group/Group2.hpp
        opm/parser/eclipse/EclipseState/Schedule/MessageLimits.hpp
+       opm/parser/eclipse/EclipseState/Schedule/NamePattern.hpp
        opm/parser/eclipse/EclipseState/Schedule/Events.hpp
        opm/parser/eclipse/EclipseState/Schedule/ScheduleEnums.hpp
        opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.hpp
@@ -584,6 +598,8 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list(APPEND PUBLIC_HEADER_FILES
+        opm/io/eclipse/Columnar.hpp
+        opm/io/eclipse/EclCompress.hpp
         opm/io/eclipse/EclFile.hpp
         opm/io/eclipse/EclIOdata.hpp
         opm/io/eclipse/EclOutput.hpp
@@ -617,10 +633,12 @@ if(ENABLE_ECL_OUTPUT)
         opm/output/eclipse/RegionCache.hpp
         opm/output/eclipse/RestartIO.hpp
         opm/output/eclipse/RestartValue.hpp
+        opm/output/eclipse/StaticWellCache.hpp
         opm/output/eclipse/Summary.hpp
         opm/output/eclipse/Tables.hpp
         opm/output/eclipse/WindowedArray.hpp
         opm/output/eclipse/WriteInit.hpp
+        opm/output/eclipse/WriteRFT.hpp
         opm/output/eclipse/WriteRestartHelpers.hpp
         opm/output/OutputWriter.hpp
         )
@@ -0,0 +1,153 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Micro benchmark of the batch linear interpolation kernels in
+  linearInterpolation.hpp and PiecewiseLinearTable.hpp.  For tables of
+  10 to 10^5 nodes it reports the time per query point, in ns, of
+
+    scalar : linearInterpolation(xv, yv, x) point by point
+    batch  : linearInterpolation(xv, yv, n, x, y, m)
+    slopes : PiecewiseLinearTable::evaluate()
+
+  for uniformly distributed random queries, and of the scalar function,
+  linearInterpolationSorted() and PiecewiseLinearTable::evaluateSorted()
+  for the same queries in sorted order.  The best of a few repetitions
+  is reported.  The number of queries may be given as first argument,
+  the default is 10^6.
+
+  The program is only built when ENABLE_BENCHMARKS is set.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <opm/common/utility/numeric/linearInterpolation.hpp>
+#include <opm/common/utility/numeric/PiecewiseLinearTable.hpp>
+
+namespace {
+
+    const int repetitions = 5;
+
+    /* Best time over some repetitions, in ns per query point. */
+    double nsPerPoint(const std::function<void()>& kernel, std::size_t numPoints) {
+        double best = std::numeric_limits<double>::max();
+        for (int rep = 0; rep < repetitions; ++rep) {
+            const auto start = std::chrono::steady_clock::now();
+            kernel();
+            const auto stop = std::chrono::steady_clock::now();
+            best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+        }
+        return best / numPoints;
+    }
+
+    double checksum(const std::vector<double>& y) {
+        double sum = 0;
+        for (const auto& value : y)
+            sum += value;
+        return sum;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    const std::size_t numQueries = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    if (numQueries == 0) {
+        std::cerr << "Usage: " << argv[0] << " [number_of_queries]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> step(0.5, 1.5);
+    std::uniform_real_distribution<double> value(-1.0, 1.0);
+
+    std::cout << numQueries << " queries, ns per point" << std::endl
+              << std::setw(8) << "n"
+              << std::setw(9) << "scalar" << std::setw(8) << "batch" << std::setw(8) << "slopes"
+              << "   | sorted:"
+              << std::setw(8) << "scalar" << std::setw(8) << "merge" << std::setw(8) << "slopes"
+              << std::endl;
+
+    double sum = 0;
+    for (std::size_t numNodes = 10; numNodes <= 100000; numNodes *= 10) {
+        std::vector<double> xv(numNodes), yv(numNodes);
+        double x = 0;
+        for (std::size_t i = 0; i < numNodes; ++i) {
+            x += step(generator);
+            xv[i] = x;
+            yv[i] = value(generator);
+        }
+        const Opm::PiecewiseLinearTable table(xv, yv);
+
+        /* Some of the queries are outside the table and extrapolated. */
+        std::uniform_real_distribution<double> query(xv.front() - 1.0, xv.back() + 1.0);
+        std::vector<double> xq(numQueries), yq(numQueries);
+        for (auto& xi : xq)
+            xi = query(generator);
+
+        std::vector<double> sorted = xq;
+        std::sort(sorted.begin(), sorted.end());
+
+        const auto scalar = [&](const std::vector<double>& points) {
+            const double* xp = points.data();
+            return [&, xp]() {
+                for (std::size_t q = 0; q < numQueries; ++q)
+                    yq[q] = Opm::linearInterpolation(xv, yv, xp[q]);
+            };
+        };
+
+        std::cout << std::fixed << std::setprecision(1) << std::setw(8) << numNodes;
+
+        std::cout << std::setw(9) << nsPerPoint(scalar(xq), numQueries);
+        sum += checksum(yq);
+        std::cout << std::setw(8) << nsPerPoint([&]() {
+                Opm::linearInterpolation(xv.data(), yv.data(), numNodes, xq.data(), yq.data(), numQueries);
+            }, numQueries);
+        sum += checksum(yq);
+        std::cout << std::setw(8) << nsPerPoint([&]() {
+                table.evaluate(xq.data(), yq.data(), numQueries);
+            }, numQueries);
+        sum += checksum(yq);
+
+        std::cout << "   |        ";
+        std::cout << std::setw(8) << nsPerPoint(scalar(sorted), numQueries);
+        sum += checksum(yq);
+        std::cout << std::setw(8) << nsPerPoint([&]() {
+                Opm::linearInterpolationSorted(xv.data(), yv.data(), numNodes, sorted.data(), yq.data(), numQueries);
+            }, numQueries);
+        sum += checksum(yq);
+        std::cout << std::setw(8) << nsPerPoint([&]() {
+                table.evaluateSorted(sorted.data(), yq.data(), numQueries);
+            }, numQueries);
+        sum += checksum(yq);
+
+        std::cout << std::endl;
+    }
+
+    /* Keeps the compiler from dropping the evaluations. */
+    std::cout << "checksum: " << std::setprecision(6) << sum << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,217 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+  Micro benchmark of MonotCubicInterpolator::evaluate().  The flat
+  array implementation, evaluated point by point and in one batch, is
+  compared with the earlier std::map based implementation, which is
+  reproduced below as MapMonotCubic.  The time of 10^7 evaluations on
+  a monotone table of 100 points is reported, both for random and for
+  sorted x values.  The number of evaluations and of data points may
+  be given as arguments.
+
+  The program is only built when ENABLE_BENCHMARKS is set.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <opm/common/utility/numeric/MonotCubicInterpolator.hpp>
+
+namespace {
+
+    /*
+      The evaluation and derivative computation of MonotCubicInterpolator
+      before its data was moved from std::map to flat arrays.
+    */
+    class MapMonotCubic {
+    public:
+        MapMonotCubic(const std::vector<double>& x, const std::vector<double>& f) {
+            for (std::size_t i = 0; i < x.size(); ++i)
+                data[x[i]] = f[i];
+
+            computeSimpleDerivatives();
+            if (isMonotone())
+                adjustDerivativesForMonotoneness();
+        }
+
+        double evaluate(double x) const {
+            auto xf_iterator = data.lower_bound(x);
+            if (xf_iterator == data.begin())
+                return data.begin()->second;
+
+            if (xf_iterator == data.end())
+                return data.rbegin()->second;
+
+            const auto xf2 = *xf_iterator;
+            const auto xf1 = *(--xf_iterator);
+            const double t = (x - xf1.first)/(xf2.first - xf1.first);
+            const double h = xf2.first - xf1.first;
+            return xf1.second          * H00(t)
+                + ddata.at(xf1.first) * H10(t) * h
+                + xf2.second          * H01(t)
+                + ddata.at(xf2.first) * H11(t) * h;
+        }
+
+    private:
+        static double H00(double t) { return 2*t*t*t - 3*t*t + 1; }
+        static double H10(double t) { return t*t*t - 2*t*t + t; }
+        static double H01(double t) { return -2*t*t*t + 3*t*t; }
+        static double H11(double t) { return t*t*t - t*t; }
+
+        bool isMonotone() const {
+            bool increasing = true;
+            bool decreasing = true;
+            for (auto point = data.begin(), next = std::next(data.begin()); next != data.end(); ++point, ++next) {
+                increasing = increasing && (next->second >= point->second);
+                decreasing = decreasing && (next->second <= point->second);
+            }
+            return increasing || decreasing;
+        }
+
+        void computeSimpleDerivatives() {
+            auto first = data.begin();
+            auto second = std::next(first);
+            ddata[first->first] = (second->second - first->second) / (second->first - first->first);
+
+            auto last = std::prev(data.end());
+            auto before_last = std::prev(last);
+            ddata[last->first] = (last->second - before_last->second) / (last->first - before_last->first);
+
+            for (auto point = std::next(data.begin()); point != last; ++point) {
+                const auto prev = std::prev(point);
+                const auto next = std::next(point);
+                ddata[point->first] = (next->second - point->second) / (2*(next->first - point->first))
+                    + (point->second - prev->second) / (2*(point->first - prev->first));
+            }
+        }
+
+        void adjustDerivativesForMonotoneness() {
+            for (auto point = data.begin(); point != std::prev(data.end()); ++point) {
+                const auto next = std::next(point);
+                const double delta = (next->second - point->second) / (next->first - point->first);
+                if (std::fabs(delta) < 1e-14) {
+                    ddata[point->first] = 0.0;
+                    ddata[next->first] = 0.0;
+                } else {
+                    const double alpha = ddata[point->first] / delta;
+                    const double beta = ddata[next->first] / delta;
+                    if (alpha*alpha + beta*beta > 9) {
+                        const double tau = 3/std::sqrt(alpha*alpha + beta*beta);
+                        ddata[point->first] = tau*alpha*delta;
+                        ddata[next->first] = tau*beta*delta;
+                    }
+                }
+            }
+        }
+
+        std::map<double, double> data;
+        std::map<double, double> ddata;
+    };
+
+    /* Wall clock time of kernel(), in seconds. */
+    double seconds(const std::function<void()>& kernel) {
+        const auto start = std::chrono::steady_clock::now();
+        kernel();
+        const auto stop = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(stop - start).count();
+    }
+
+    double maxDifference(const std::vector<double>& a, const std::vector<double>& b) {
+        double diff = 0;
+        for (std::size_t i = 0; i < a.size(); ++i)
+            diff = std::max(diff, std::fabs(a[i] - b[i]));
+        return diff;
+    }
+
+}
+
+int main(int argc, char** argv) {
+    const std::size_t numEvaluations = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    const std::size_t numPoints = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 100;
+    if (numEvaluations == 0 || numPoints < 3) {
+        std::cerr << "Usage: " << argv[0] << " [number_of_evaluations [number_of_points >= 3]]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> step(0.5, 1.5);
+
+    std::vector<double> xdata(numPoints), fdata(numPoints);
+    double x = 0;
+    double f = 0;
+    for (std::size_t i = 0; i < numPoints; ++i) {
+        x += step(generator);
+        f += step(generator) * step(generator);
+        xdata[i] = x;
+        fdata[i] = f;
+    }
+
+    const Opm::MonotCubicInterpolator flat(xdata, fdata);
+    const MapMonotCubic mapBased(xdata, fdata);
+
+    std::uniform_real_distribution<double> query(xdata.front(), xdata.back());
+    std::vector<double> random(numEvaluations);
+    for (auto& xi : random)
+        xi = query(generator);
+
+    std::vector<double> sorted = random;
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<double> mapValues(numEvaluations), scalarValues(numEvaluations), batchValues(numEvaluations);
+
+    std::cout << numEvaluations << " evaluations, " << numPoints << " data points, seconds" << std::endl
+              << std::setw(12) << "" << std::setw(10) << "map"
+              << std::setw(14) << "flat scalar" << std::setw(13) << "flat batch"
+              << std::setw(14) << "max |diff|" << std::endl;
+
+    for (const auto* points : { &random, &sorted }) {
+        const auto& xq = *points;
+        const double tMap = seconds([&]() {
+                for (std::size_t i = 0; i < numEvaluations; ++i)
+                    mapValues[i] = mapBased.evaluate(xq[i]);
+            });
+        const double tScalar = seconds([&]() {
+                for (std::size_t i = 0; i < numEvaluations; ++i)
+                    scalarValues[i] = flat.evaluate(xq[i]);
+            });
+        const double tBatch = seconds([&]() {
+                flat.evaluate(xq.data(), batchValues.data(), numEvaluations);
+            });
+        const double diff = std::max(maxDifference(mapValues, scalarValues), maxDifference(mapValues, batchValues));
+
+        std::cout << std::setw(12) << ((points == &random) ? "random x" : "sorted x")
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(8) << tMap << " s"
+                  << std::setw(12) << tScalar << " s"
+                  << std::setw(11) << tBatch << " s"
+                  << std::scientific << std::setprecision(1)
+                  << std::setw(14) << diff << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
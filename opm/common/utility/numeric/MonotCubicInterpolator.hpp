@@ -3,9 +3,10 @@
 #ifndef _MONOTCUBICINTERPOLATOR_H
 #define _MONOTCUBICINTERPOLATOR_H
 
-#include <vector>
-#include <map>
+#include <cstddef>
 #include <string>
+#include <utility>
+#include <vector>
 
 /*
   MonotCubicInterpolator
@@ -206,6 +207,30 @@ class MonotCubicInterpolator {
    */
    double evaluate(double x) const;
 
+   /**
+      @param x pointer to n x values
+      @param out pointer to storage for n function values
+      @param n number of values
+
+      Evaluates f at all n x values, out[i] = evaluate(x[i]).
+
+      The interval search continues from the interval of the
+      previous x value as long as the x values are non-decreasing,
+      so evaluating sorted input takes time linear in the number of
+      x values and data points.  Unsorted input falls back to a
+      binary search whenever x decreases.
+   */
+   void evaluate(const double* x, double* out, std::size_t n) const;
+
+   /**
+      @param x x values
+
+      Vector version of evaluate(const double*, double*, std::size_t).
+
+      @return f(x) for all given x
+   */
+   std::vector<double> evaluate(const std::vector<double>& x) const;
+
    /**
       @param x x value
       @param errorestimate_output
@@ -235,7 +260,7 @@ class MonotCubicInterpolator {
    */
    std::pair<double,double> getMinimumX() const {
        // Easy since the data is sorted on x:
-       return *data.begin();
+       return std::make_pair(xdata.front(), fdata.front());
    }
 
    /**
@@ -246,7 +271,7 @@ class MonotCubicInterpolator {
    */
    std::pair<double,double> getMaximumX() const {
        // Easy since the data is sorted on x:
-       return *data.rbegin();
+       return std::make_pair(xdata.back(), fdata.back());
    }
 
    /**
@@ -434,7 +459,7 @@ class MonotCubicInterpolator {
      @return Number of datapoint pairs in this object
    */
    int getSize() const {
-       return data.size();
+       return xdata.size();
    }
 
     /**
@@ -494,49 +519,65 @@ class MonotCubicInterpolator {
 
 private:
 
-   // Data structure to store x- and f-values
-   std::map<double, double> data;
-
-   // Data structure to store x- and d-values
-   mutable std::map<double, double> ddata;
+   // Data points, sorted on strictly increasing x-values
+   std::vector<double> xdata;
+   std::vector<double> fdata;
 
+   // Derivative values at the data points.  Empty (or of a different
+   // size than xdata) if linear interpolation is to be used.
+   mutable std::vector<double> ddata;
 
-   // Storage containers for precomputed interpolation data
-   //   std::vector<double> dvalues; // derivatives in Hermite interpolation.
+   // Polynomial coefficients of the interpolant in each interval
+   // [xdata[i], xdata[i+1]], in terms of s = x - xdata[i]:
+   //
+   //    f(x) = c0 + s*(c1 + s*(c2 + s*c3))
+   struct Cubic {
+       double c0, c1, c2, c3;
+   };
+   mutable std::vector<Cubic> coeffs;
 
    // Flag to determine whether the boolean strictlyMonotone can be
    // trusted.
-   mutable bool strictlyMonotoneCached;
-   mutable bool monotoneCached; /* only monotone, not stricly montone */
+   mutable bool strictlyMonotoneCached = false;
+   mutable bool monotoneCached = false; /* only monotone, not stricly montone */
 
-   mutable bool strictlyMonotone;
-   mutable bool monotone;
+   mutable bool strictlyMonotone = false;
+   mutable bool monotone = false;
 
    // if strictlyMonotone is true (and can be trusted), the two next are meaningful
-   mutable bool strictlyDecreasing;
-   mutable bool strictlyIncreasing;
-   mutable bool decreasing;
-   mutable bool increasing;
+   mutable bool strictlyDecreasing = false;
+   mutable bool strictlyIncreasing = false;
+   mutable bool decreasing = false;
+   mutable bool increasing = false;
+
 
+   /**
+      Sorts the data points on x.  If several points have the same
+      x-value, the last one is kept.
+   */
+   void sortData(std::vector<std::pair<double,double>>& xf);
 
-   /* Hermite basis functions, t \in [0,1] ,
-      notation from:
-      http://en.wikipedia.org/w/index.php?title=Cubic_Hermite_spline&oldid=84495502
+   /**
+      Inserts (x,f), or replaces f(x) if x is already a data point.
    */
+   void setPair(double x, double f);
 
-   double H00(double t) const {
-       return 2*t*t*t - 3*t*t + 1;
-   }
-   double H10(double t) const {
-       return t*t*t - 2*t*t + t;
-   }
-   double H01(double t) const {
-       return -2*t*t*t + 3*t*t;
-   }
-   double H11(double t) const {
-       return t*t*t - t*t;
-   }
+   /**
+      Erases all data points, keeping those for which keep[i] is true.
+   */
+   void eraseData(const std::vector<bool>& keep);
 
+   /**
+      Evaluates f at x given the index i of the first data point with
+      xdata[i] >= x, as found by std::lower_bound().
+   */
+   double evaluateAt(double x, std::size_t i) const;
+
+   /**
+      Populates coeffs from the data points and, if available, the
+      derivative values (cubic Hermite), else linear interpolation.
+   */
+   void computeCoefficients() const;
 
    void computeInternalFunctionData() const ;
 
@@ -544,7 +585,7 @@ private:
        Computes initial derivative values using centered (second order) difference
        for internal datapoints, and one-sided derivative for endpoints
 
-       The internal datastructure map<double,double> ddata is populated by this method.
+       The internal datastructure ddata is populated by this method.
    */
 
    void computeSimpleDerivatives() const ;
@@ -0,0 +1,156 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PIECEWISELINEARTABLE_HEADER_INCLUDED
+#define OPM_PIECEWISELINEARTABLE_HEADER_INCLUDED
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <opm/common/utility/numeric/linearInterpolation.hpp>
+
+namespace Opm
+{
+    /// @brief Piecewise linear function through the points of an
+    ///        increasing table, with the slope of every interval
+    ///        computed once at construction.  Values outside the
+    ///        domain are extrapolated linearly.  The results are
+    ///        identical to those of linearInterpolation() and
+    ///        linearInterpolationDerivative() on the same table.
+    class PiecewiseLinearTable
+    {
+    public:
+        /// @brief Default constructor.
+        PiecewiseLinearTable() = default;
+
+        /// @brief Construct from x and y values.
+        /// @param x_values strictly increasing domain values, at least two.
+        /// @param y_values corresponding range values.
+        template<class XContainer, class YContainer>
+        PiecewiseLinearTable(const XContainer& x_values,
+                             const YContainer& y_values)
+            : x_values_(x_values.begin(), x_values.end()),
+              y_values_(y_values.begin(), y_values.end())
+        {
+            assert(x_values_.size() >= 2);
+            assert(x_values_.size() == y_values_.size());
+            assert(std::adjacent_find(x_values_.begin(), x_values_.end(),
+                                      [](double a, double b) { return !(a < b); }) == x_values_.end());
+
+            slopes_.resize(x_values_.size() - 1);
+            for (std::size_t i = 0; i < slopes_.size(); ++i) {
+                slopes_[i] = (y_values_[i + 1] - y_values_[i])/(x_values_[i + 1] - x_values_[i]);
+            }
+        }
+
+        /// @brief Get the domain.
+        /// @return the domain as a pair of doubles.
+        std::pair<double, double> domain() const
+        {
+            return std::make_pair(x_values_.front(), x_values_.back());
+        }
+
+        /// @brief Evaluate the value at x.
+        /// @param x a domain value
+        /// @return f(x)
+        double operator()(const double x) const
+        {
+            const int i = tableIndex(x_values_, x);
+            return slopes_[i]*(x - x_values_[i]) + y_values_[i];
+        }
+
+        /// @brief Evaluate the derivative at x.
+        /// @param x a domain value
+        /// @return f'(x)
+        double derivative(const double x) const
+        {
+            return slopes_[tableIndex(x_values_, x)];
+        }
+
+        /// @brief Evaluate the values at m arbitrary points.
+        /// @param x the m domain values
+        /// @param y receives f(x[0]), ..., f(x[m - 1])
+        /// @param m the number of points
+        void evaluate(const double* x, double* y, std::size_t m) const
+        {
+            int index[interpolationBlockSize];
+            for (std::size_t start = 0; start < m; start += interpolationBlockSize) {
+                const std::size_t blockSize = std::min(interpolationBlockSize, m - start);
+                tableIndex(x_values_.data(), x_values_.size(), x + start, index, blockSize);
+                for (std::size_t q = 0; q < blockSize; ++q) {
+                    const int i = index[q];
+                    y[start + q] = slopes_[i]*(x[start + q] - x_values_[i]) + y_values_[i];
+                }
+            }
+        }
+
+        /// @brief Evaluate the values at m nondecreasing points.
+        /// @param x the m domain values, in nondecreasing order
+        /// @param y receives f(x[0]), ..., f(x[m - 1])
+        /// @param m the number of points
+        void evaluateSorted(const double* x, double* y, std::size_t m) const
+        {
+            const std::size_t last = slopes_.size() - 1;
+            std::size_t i = 0;
+            for (std::size_t q = 0; q < m; ++q) {
+                assert(q == 0 || !(x[q] < x[q - 1]));
+                while (i < last && x_values_[i + 1] <= x[q]) {
+                    ++i;
+                }
+                y[q] = slopes_[i]*(x[q] - x_values_[i]) + y_values_[i];
+            }
+        }
+
+        /// @brief Evaluate the derivatives at m arbitrary points.
+        /// @param x the m domain values
+        /// @param dy receives f'(x[0]), ..., f'(x[m - 1])
+        /// @param m the number of points
+        void derivative(const double* x, double* dy, std::size_t m) const
+        {
+            int index[interpolationBlockSize];
+            for (std::size_t start = 0; start < m; start += interpolationBlockSize) {
+                const std::size_t blockSize = std::min(interpolationBlockSize, m - start);
+                tableIndex(x_values_.data(), x_values_.size(), x + start, index, blockSize);
+                for (std::size_t q = 0; q < blockSize; ++q) {
+                    dy[start + q] = slopes_[index[q]];
+                }
+            }
+        }
+
+        /// @brief Equality operator.
+        /// @param other another PiecewiseLinearTable.
+        /// @return true if they are represented exactly alike.
+        bool operator==(const PiecewiseLinearTable& other) const
+        {
+            return x_values_ == other.x_values_
+                && y_values_ == other.y_values_;
+        }
+
+    private:
+        std::vector<double> x_values_;
+        std::vector<double> y_values_;
+        std::vector<double> slopes_;
+    };
+
+} // namespace Opm
+
+#endif // OPM_PIECEWISELINEARTABLE_HEADER_INCLUDED
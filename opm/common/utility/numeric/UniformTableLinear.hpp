@@ -171,15 +171,12 @@ namespace Opm {
             double x = std::min(xparam, xmax_);
             x = std::max(x, xmin_);
 
-            // Lookup is easy since we are uniform in x.
+            // Lookup is easy since we are uniform in x.  At xmax_ we
+            // use the last interval with weight 1 instead of
+            // branching, as this is often called in inner loops.
             double pos = (x - xmin_)/xdelta_;
-            double posi = std::floor(pos);
-            int left = int(posi);
-            if (left == int(y_values_.size()) - 1) {
-                // We are at xmax_
-                return y_values_.back();
-            }
-            double w = pos - posi;
+            int left = std::min(int(pos), int(y_values_.size()) - 2);
+            double w = pos - left;
 	    return (1.0 - w)*y_values_[left] + w*y_values_[left + 1];
 	}
 
@@ -20,8 +20,10 @@
 #ifndef OPM_BUILDUNIFORMMONOTONETABLE_HEADER_INCLUDED
 #define OPM_BUILDUNIFORMMONOTONETABLE_HEADER_INCLUDED
 
-#include <opm/core/utility/MonotCubicInterpolator.hpp>
-#include <opm/core/utility/UniformTableLinear.hpp>
+#include <opm/common/utility/numeric/MonotCubicInterpolator.hpp>
+#include <opm/common/utility/numeric/UniformTableLinear.hpp>
+
+#include <vector>
 
 namespace Opm {
 
@@ -24,6 +24,8 @@
 
 #include <vector>
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
 
 namespace Opm
 {
@@ -97,6 +99,139 @@ namespace Opm
     }
 
 
+    // Batch versions of tableIndex(), linearInterpolation() and
+    // linearInterpolationDerivative() for an increasing table of n
+    // values and m query points, all given as plain arrays.  The
+    // results are identical to calling the scalar functions point by
+    // point, including linear extrapolation outside the table.
+    //
+    // The queries are processed in blocks.  For unsorted queries the
+    // intervals of a block are found by a branch free bisection with
+    // a number of steps which only depends on n, so the loop over the
+    // block has no data dependent control flow and may be vectorised.
+    // The ...Sorted() variants require nondecreasing queries and find
+    // the intervals by walking the table and the queries in step,
+    // i.e. in O(n + m) operations.
+
+    const std::size_t interpolationBlockSize = 64;
+
+    inline void tableIndex(const double* table, std::size_t n,
+                           const double* x, int* index, std::size_t m)
+    {
+        assert(n < 2 || table[n - 1] > table[0]);
+        if (n < 4) {
+            // At most two intervals; same test as the bisection below.
+            for (std::size_t q = 0; q < m; ++q) {
+                index[q] = (n == 3 && x[q] >= table[1]) ? 1 : 0;
+            }
+            return;
+        }
+
+        // Interval q is the number of interior nodes table[1],
+        // ..., table[n - 2] which are less than or equal to x[q].
+        const double* nodes = table + 1;
+        const std::size_t numNodes = n - 2;
+        for (std::size_t start = 0; start < m; start += interpolationBlockSize) {
+            const std::size_t blockSize = std::min(interpolationBlockSize, m - start);
+            const double* xb = x + start;
+            int* ib = index + start;
+
+            std::size_t base[interpolationBlockSize];
+            for (std::size_t q = 0; q < blockSize; ++q) {
+                base[q] = 0;
+            }
+            for (std::size_t len = numNodes; len > 1; len -= len/2) {
+                const std::size_t half = len/2;
+                for (std::size_t q = 0; q < blockSize; ++q) {
+                    base[q] += (nodes[base[q] + half] <= xb[q]) ? half : 0;
+                }
+            }
+            for (std::size_t q = 0; q < blockSize; ++q) {
+                ib[q] = static_cast<int>(base[q] + ((nodes[base[q]] <= xb[q]) ? 1 : 0));
+            }
+        }
+    }
+
+    inline void tableIndexSorted(const double* table, std::size_t n,
+                                 const double* x, int* index, std::size_t m)
+    {
+        assert(n < 2 || table[n - 1] > table[0]);
+        // The last interval is [n - 2, n - 1]; never step past it.
+        const std::size_t last = (n < 3) ? 0 : n - 2;
+        std::size_t i = 0;
+        for (std::size_t q = 0; q < m; ++q) {
+            assert(q == 0 || !(x[q] < x[q - 1]));
+            while (i < last && table[i + 1] <= x[q]) {
+                ++i;
+            }
+            index[q] = static_cast<int>(i);
+        }
+    }
+
+    inline void linearInterpolation(const double* xv, const double* yv, std::size_t n,
+                                    const double* x, double* y, std::size_t m)
+    {
+        int index[interpolationBlockSize];
+        for (std::size_t start = 0; start < m; start += interpolationBlockSize) {
+            const std::size_t blockSize = std::min(interpolationBlockSize, m - start);
+            tableIndex(xv, n, x + start, index, blockSize);
+            for (std::size_t q = 0; q < blockSize; ++q) {
+                const int ix1 = index[q];
+                const int ix2 = ix1 + 1;
+                const double xq = x[start + q];
+                y[start + q] = (yv[ix2] - yv[ix1])/(xv[ix2] - xv[ix1])*(xq - xv[ix1]) + yv[ix1];
+            }
+        }
+    }
+
+    inline void linearInterpolationSorted(const double* xv, const double* yv, std::size_t n,
+                                          const double* x, double* y, std::size_t m)
+    {
+        assert(n < 2 || xv[n - 1] > xv[0]);
+        const std::size_t last = (n < 3) ? 0 : n - 2;
+        std::size_t ix1 = 0;
+        for (std::size_t q = 0; q < m; ++q) {
+            assert(q == 0 || !(x[q] < x[q - 1]));
+            while (ix1 < last && xv[ix1 + 1] <= x[q]) {
+                ++ix1;
+            }
+            const std::size_t ix2 = ix1 + 1;
+            y[q] = (yv[ix2] - yv[ix1])/(xv[ix2] - xv[ix1])*(x[q] - xv[ix1]) + yv[ix1];
+        }
+    }
+
+    inline void linearInterpolationDerivative(const double* xv, const double* yv, std::size_t n,
+                                              const double* x, double* dy, std::size_t m)
+    {
+        int index[interpolationBlockSize];
+        for (std::size_t start = 0; start < m; start += interpolationBlockSize) {
+            const std::size_t blockSize = std::min(interpolationBlockSize, m - start);
+            tableIndex(xv, n, x + start, index, blockSize);
+            for (std::size_t q = 0; q < blockSize; ++q) {
+                const int ix1 = index[q];
+                const int ix2 = ix1 + 1;
+                dy[start + q] = (yv[ix2] - yv[ix1])/(xv[ix2] - xv[ix1]);
+            }
+        }
+    }
+
+    inline void linearInterpolationDerivativeSorted(const double* xv, const double* yv, std::size_t n,
+                                                    const double* x, double* dy, std::size_t m)
+    {
+        assert(n < 2 || xv[n - 1] > xv[0]);
+        const std::size_t last = (n < 3) ? 0 : n - 2;
+        std::size_t ix1 = 0;
+        for (std::size_t q = 0; q < m; ++q) {
+            assert(q == 0 || !(x[q] < x[q - 1]));
+            while (ix1 < last && xv[ix1 + 1] <= x[q]) {
+                ++ix1;
+            }
+            const std::size_t ix2 = ix1 + 1;
+            dy[q] = (yv[ix2] - yv[ix1])/(xv[ix2] - xv[ix1]);
+        }
+    }
+
+
 
 } // namespace Opm
 
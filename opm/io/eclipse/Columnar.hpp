@@ -0,0 +1,224 @@
+/*
+  Copyright (c) 2019 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_COLUMNAR_HPP
+#define OPM_IO_COLUMNAR_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/OutputStream.hpp>
+#include <opm/io/eclipse/PaddedOutputString.hpp>
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+/// Columnar result container.
+///
+/// A result set "CASE" in directory "DIR" is stored in the directory
+/// DIR/CASE.COLUMNS, with one subdirectory per section: "INIT" for the
+/// static properties and "RESTART_nnnn" and "RFT_nnnn" for the restart
+/// and RFT data of report step nnnn.  Each array written to a section is
+/// a separate dataset file named after its keyword, "KW.col" for the
+/// first array named "KW" in the section and "KW.n.col" for the n-th
+/// repetition.  Keyword characters other than letters, digits, '_' and
+/// '-' are written as "%XX" in the file names.
+///
+/// A dataset file starts with a header consisting of the eight character
+/// magic string "OPMCOL01", the four character element type (INTE, REAL,
+/// DOUB, LOGI, CHAR or MESS), the number of bytes per element and the
+/// number of elements as 32 and 64 bit little-endian integers, and the
+/// keyword as a 32 bit length followed by its characters.  The elements
+/// follow, in little-endian byte order, from the next multiple of eight
+/// bytes.  LOGI elements are single bytes (0 or 1) and CHAR elements are
+/// blank padded strings of the width given in the header.  Element i is
+/// thus found at a fixed offset and any range of elements can be read
+/// without reading the rest of the array.
+///
+/// Each section also has a text file INDEX with one line per dataset, in
+/// the order the arrays were written, holding the keyword, element type,
+/// number of elements and file name separated by tabs.  A line is added
+/// only once its dataset is completely written.  Sections are independent
+/// of each other and may be written by different processes.
+namespace Opm { namespace EclIO { namespace OutputStream {
+
+    /// Columnar output stream of one section of a result set.
+    ///
+    /// Unlike the ECLIPSE output streams, every array goes to a separate
+    /// file whence downstream readers may load individual arrays of a
+    /// report step directly.
+    class Columnar : public ArrayWriter
+    {
+    public:
+        /// Kind of data stored in a section.
+        enum class Section { Init, Restart, RFT };
+
+        /// Constructor.
+        ///
+        /// Creates the section directory, removing any previous contents.
+        ///
+        /// \param[in] rset Output directory and base name of result set.
+        ///
+        /// \param[in] section Kind of section.
+        ///
+        /// \param[in] seqnum Report step of Restart and RFT sections.
+        ///    Ignored for the Init section.
+        explicit Columnar(const ResultSet& rset,
+                          const Section    section,
+                          const int        seqnum = 0);
+
+        ~Columnar() override;
+
+        Columnar(const Columnar& rhs) = delete;
+        Columnar(Columnar&& rhs);
+
+        Columnar& operator=(const Columnar& rhs) = delete;
+        Columnar& operator=(Columnar&& rhs);
+
+        /// Location of section directory.
+        ///
+        /// \param[in] rset Output directory and base name of result set.
+        ///
+        /// \param[in] section Kind of section.
+        ///
+        /// \param[in] seqnum Report step of Restart and RFT sections.
+        ///
+        /// \return outputDir/baseName.COLUMNS/SECTION
+        static std::string directory(const ResultSet& rset,
+                                     const Section    section,
+                                     const int        seqnum = 0);
+
+        void message(const std::string& msg) override;
+
+        void write(const std::string&      kw,
+                   const std::vector<int>& data) override;
+
+        void write(const std::string&       kw,
+                   const std::vector<bool>& data) override;
+
+        void write(const std::string&        kw,
+                   const std::vector<float>& data) override;
+
+        void write(const std::string&         kw,
+                   const std::vector<double>& data) override;
+
+        void write(const std::string&           kw,
+                   const std::size_t            size,
+                   const SinglePrecisionSource& source) override;
+
+        void write(const std::string&              kw,
+                   const std::vector<std::string>& data) override;
+
+        void write(const std::string&                        kw,
+                   const std::vector<PaddedOutputString<8>>& data) override;
+
+    private:
+        /// Section directory.
+        std::string dir_;
+
+        /// Number of arrays written so far, per keyword.
+        std::unordered_map<std::string, int> count_;
+
+        /// Write dataset file header and all elements, then register the
+        /// dataset in the section's INDEX.
+        ///
+        /// \param[in] fill Callback fill(begin, end, bytes) which stores
+        ///    the little-endian representation of elements [begin, end)
+        ///    in bytes[0 .. (end - begin)*elemSize).
+        template <class Fill>
+        void writeDataset(const std::string& kw,
+                          const eclArrType   type,
+                          const std::size_t  elemSize,
+                          const std::size_t  size,
+                          Fill&&             fill);
+
+        template <typename T>
+        void writeNumeric(const std::string& kw,
+                          const eclArrType   type,
+                          const T*           data,
+                          const std::size_t  size);
+
+        void writeStrings(const std::string&              kw,
+                          const std::vector<std::string>& data,
+                          const std::size_t               width);
+    };
+
+}}} // namespace Opm::EclIO::OutputStream
+
+namespace Opm { namespace EclIO {
+
+    /// Reader of one section of a columnar result container.
+    class EColumnar
+    {
+    public:
+        using EclEntry = std::tuple<std::string, eclArrType, int>;
+
+        /// Constructor.
+        ///
+        /// Reads the section's INDEX.  Arrays are loaded on request.
+        ///
+        /// \param[in] directory Section directory, e.g., as returned by
+        ///    OutputStream::Columnar::directory().
+        explicit EColumnar(const std::string& directory);
+
+        /// Arrays of the section in the order they were written.
+        std::vector<EclEntry> getList() const;
+
+        bool hasKey(const std::string& name) const;
+
+        /// Number of arrays named \p name in the section.
+        int count(const std::string& name) const;
+
+        /// Load elements [begin, end) of an array.  Element type \p T is
+        /// one of int, float, double, bool and std::string and must match
+        /// the array type.
+        ///
+        /// \param[in] name Keyword.
+        ///
+        /// \param[in] occurrence Zero-based repetition of keyword.
+        template <typename T>
+        std::vector<T> get(const std::string& name,
+                           const std::size_t  begin,
+                           const std::size_t  end,
+                           const int          occurrence = 0) const;
+
+        /// Load an entire array.
+        template <typename T>
+        std::vector<T> get(const std::string& name,
+                           const int          occurrence = 0) const;
+
+    private:
+        struct Dataset
+        {
+            std::string name;
+            eclArrType  type;
+            std::size_t size;
+            std::string file;
+        };
+
+        std::string dir_;
+        std::vector<Dataset> datasets_;
+
+        const Dataset& dataset(const std::string& name, const int occurrence) const;
+    };
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_COLUMNAR_HPP
@@ -41,6 +41,10 @@ public:
 
     void loadReportStepNumber(int number);
 
+    // Load only the named arrays of a report step.  Names which do not
+    // exist in the report step are ignored.
+    void loadReportStepNumber(int number, const std::vector<std::string>& names);
+
     template <typename T>
     const std::vector<T>& getRst(const std::string& name, int reportStepNumber);
 
@@ -58,6 +62,7 @@ private:
 
     void initUnified();
     void initSeparate(const int number);
+    void resolveReferences();
 
     int getArrayIndex(const std::string& name, int seqnum) const;
 
@@ -0,0 +1,104 @@
+/*
+  Copyright (c) 2019 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_ECLCOMPRESS_HPP
+#define OPM_IO_ECLCOMPRESS_HPP
+
+#include <cstddef>
+#include <vector>
+
+/// Lossless block compression of numeric arrays in binary ECLIPSE-style
+/// files.
+///
+/// A compressed INTE, REAL or DOUB array is stored with the element type
+/// "ZINT", "ZREA" or "ZDOU" in its header, and the header's element count
+/// is the number of array elements.  The header is followed by an index
+/// record holding the number of elements per block and the number of
+/// bytes of each compressed block, and then one record per block.  Every
+/// block is compressed independently of the others, whence blocks may be
+/// located from the index alone and decoded concurrently.
+///
+/// Arrays of unified restart files may also be stored relative to the
+/// array of the same name in an earlier report step.  Such arrays start
+/// with a reference record holding the SEQNUM value of that report step.
+/// An array of type "DINT", "DREA" or "DDOU" continues as a compressed
+/// array of differences from the earlier array, while an array of type
+/// "RINT", "RREA", "RDOU", "RLOG" or "RCHA" is equal to the earlier array
+/// and holds no further records.  The earlier array is always stored in
+/// full.  ERst reconstructs the arrays on input.
+///
+/// Each block stores the difference between consecutive elements, as the
+/// bitwise exclusive-or of floating-point values and as the wrapping
+/// difference of integers, with the bytes of the differences grouped by
+/// significance and run-length encoded.  Smooth and piecewise constant
+/// arrays thus compress well while the original bit patterns are
+/// recovered exactly.
+namespace Opm { namespace EclIO { namespace Compress {
+
+    /// Number of array elements in each compressed block.  The last
+    /// block of an array may be shorter.
+    const std::size_t blockSize = 8 * 1024;
+
+    /// Arrays with fewer elements than this are written in the standard
+    /// layout also when compression is requested.
+    const std::size_t minArraySize = 4 * 1024;
+
+    /// Number of blocks of \p elementsPerBlock elements needed to hold
+    /// \p size array elements.
+    std::size_t numBlocks(const std::size_t size,
+                          const std::size_t elementsPerBlock = Compress::blockSize);
+
+    /// Split data[0 .. size) into blocks of \c blockSize elements and
+    /// compress each of them.  Blocks are compressed concurrently.
+    std::vector<std::vector<char>> encodeBlocks(const int* data, const std::size_t size);
+    std::vector<std::vector<char>> encodeBlocks(const float* data, const std::size_t size);
+    std::vector<std::vector<char>> encodeBlocks(const double* data, const std::size_t size);
+
+    /// As above, but compress the differences between data[0 .. size)
+    /// and the equally sized base[0 .. size) of an earlier report step.
+    /// Unchanged elements thus compress to almost nothing.
+    std::vector<std::vector<char>> encodeBlocks(const int* data, const int* base, const std::size_t size);
+    std::vector<std::vector<char>> encodeBlocks(const float* data, const float* base, const std::size_t size);
+    std::vector<std::vector<char>> encodeBlocks(const double* data, const double* base, const std::size_t size);
+
+    /// Decompress consecutive blocks of \p elementsPerBlock elements into
+    /// data[0 .. size).  Blocks are decompressed concurrently.  Throws
+    /// std::runtime_error if the blocks do not hold exactly \p size
+    /// elements.
+    void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                      const std::size_t elementsPerBlock, int* data, const std::size_t size);
+    void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                      const std::size_t elementsPerBlock, float* data, const std::size_t size);
+    void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                      const std::size_t elementsPerBlock, double* data, const std::size_t size);
+
+    /// Decompress blocks created by encodeBlocks(data, base, size).
+    void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                      const std::size_t elementsPerBlock, int* data,
+                      const int* base, const std::size_t size);
+    void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                      const std::size_t elementsPerBlock, float* data,
+                      const float* base, const std::size_t size);
+    void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                      const std::size_t elementsPerBlock, double* data,
+                      const double* base, const std::size_t size);
+
+}}} // namespace Opm::EclIO::Compress
+
+#endif // OPM_IO_ECLCOMPRESS_HPP
@@ -23,6 +23,7 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <algorithm>
 #include <ios>
 #include <string>
 #include <stdexcept>
@@ -41,7 +42,7 @@ public:
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
     void loadData(int arrIndex);                // load data based on array indices in vector arrIndex
-    void loadData(const std::vector<int>& arrIndex);   // load data based on array indices in vector arrIndex
+    void loadData(const std::vector<int>& arrIndex);   // load data based on array indices in vector arrIndex, concurrently
 
     void clearData()
     {
@@ -50,6 +51,8 @@ public:
       doub_array.clear();
       logi_array.clear();
       char_array.clear();
+
+      std::fill(arrayLoaded.begin(), arrayLoaded.end(), false);
     }
 
     using EclEntry = std::tuple<std::string, eclArrType, int>;
@@ -83,6 +86,12 @@ protected:
 
     std::map<std::string, int> array_index;
 
+    // SEQNUM of the report step referenced by arrays stored relative to
+    // an earlier report step of a unified restart file, -1 for other
+    // arrays.  The index of the referenced array is resolved by ERst.
+    std::vector<int> array_reference;
+    std::vector<int> array_base;
+
     template<class T>
     const std::vector<T>& getImpl(int arrIndex, eclArrType type,
                                   const std::unordered_map<int, std::vector<T>>& array,
@@ -105,8 +114,23 @@ protected:
 
 private:
     std::vector<bool> arrayLoaded;
+    // Leading character of the element type of compressed ('Z') and
+    // referencing ('D', 'R') arrays, '\0' for arrays in standard layout.
+    std::vector<char> arrayLayout;
+
+    void openInputStream(std::fstream& fileH) const;
+
+    template <typename T>
+    void storeArray(std::unordered_map<int, std::vector<T>>& array,
+                    int arrIndex, std::vector<T>&& data);
 
     void loadArray(std::fstream& fileH, int arrIndex);
+    void loadReferencingArray(std::fstream& fileH, int arrIndex);
+
+    template <typename T>
+    const std::vector<T>& baseArray(std::fstream& fileH,
+                                    const std::unordered_map<int, std::vector<T>>& array,
+                                    int arrIndex);
 };
 
 }} // namespace Opm::EclIO
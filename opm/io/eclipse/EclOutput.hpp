@@ -18,12 +18,17 @@
 #ifndef OPM_IO_ECLOUTPUT_HPP
 #define OPM_IO_ECLOUTPUT_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <fstream>
+#include <functional>
 #include <ios>
 #include <string>
 #include <typeinfo>
+#include <utility>
 #include <vector>
 
+#include <opm/io/eclipse/EclCompress.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 
@@ -56,6 +61,9 @@ public:
         else if (typeid(T) == typeid(char))
             arrType = MESS;
 
+        if (writeCompressed(name, data))
+            return;
+
         if (isFormatted)
         {
             writeFormattedHeader(name, data.size(), arrType);
@@ -70,12 +78,151 @@ public:
         }
     }
 
+    /// Write array of \p size elements which are generated on the fly,
+    /// a range of whole output blocks at a time, by the callback \p fill.
+    /// The callback is invoked as fill(begin, end, block) and must store
+    /// elements [begin, end) of the output array in block[0 .. end - begin).
+    /// The only temporary storage is a single range of at most
+    /// blocksPerFill output blocks, whence this is intended for large
+    /// arrays derived from other data, e.g., double precision cell values
+    /// written as single precision.  The ranges are large enough that the
+    /// callback may split its work between threads.  Compressed arrays
+    /// additionally keep the compressed blocks until the whole array has
+    /// been generated.  Element type \p T must be one of int, float or
+    /// double.
+    template <typename T, class Fill>
+    void write(const std::string& name,
+               const std::size_t  size,
+               Fill&&             fill)
+    {
+        eclArrType arrType = INTE;
+        if (typeid(T) == typeid(float))
+            arrType = REAL;
+        else if (typeid(T) == typeid(double))
+            arrType = DOUB;
+
+        if (compressible(arrType, size)) {
+            writeCompressedArray<T>(name, size, arrType, std::forward<Fill>(fill));
+            return;
+        }
+
+        if (isFormatted)
+            writeFormattedHeader(name, size, arrType);
+        else
+            writeBinaryHeader(name, size, arrType);
+
+        const auto blockSize = this->elementsPerBlock(arrType) * blocksPerFill;
+
+        std::vector<T> block;
+        block.reserve(std::min(size, blockSize));
+
+        for (auto begin = std::size_t{0}; begin < size; begin += blockSize) {
+            const auto end = std::min(size, begin + blockSize);
+
+            block.resize(end - begin);
+            fill(begin, end, block.data());
+
+            if (isFormatted)
+                writeFormattedArray(block);
+            else
+                writeBinaryArray(block);
+        }
+    }
+
     void message(const std::string& msg);
 
+    /// Store subsequent INTE, REAL and DOUB arrays of at least
+    /// Compress::minArraySize elements in independently compressed
+    /// blocks (see EclCompress.hpp).  Such files are only readable by
+    /// EclFile and its derived classes.  Formatted output is never
+    /// compressed.
+    void compressArrays(const bool compress);
+
     friend class OutputStream::Restart;
 
 private:
-    void writeBinaryHeader(const std::string& arrName, int size, eclArrType arrType);
+    /// Number of output blocks generated by each call to the fill
+    /// callback of write(name, size, fill).
+    static constexpr std::size_t blocksPerFill = 64;
+
+    bool compressible(eclArrType arrType, std::size_t size) const;
+
+    /// Write array in compressed layout if compression is enabled and
+    /// applicable.  Returns whether or not the array was written.
+    bool writeCompressed(const std::string& name, const std::vector<int>& data);
+    bool writeCompressed(const std::string& name, const std::vector<float>& data);
+    bool writeCompressed(const std::string& name, const std::vector<double>& data);
+
+    template <typename T>
+    bool writeCompressed(const std::string&, const std::vector<T>&)
+    {
+        return false;
+    }
+
+    template <typename T, class Fill>
+    void writeCompressedArray(const std::string& name,
+                              const std::size_t  size,
+                              const eclArrType   arrType,
+                              Fill&&             fill)
+    {
+        // The compressed blocks are collected before writing, since the
+        // index record precedes the blocks and the stream may have been
+        // opened for appending.
+        const auto rangeSize = Compress::blockSize * blocksPerFill;
+
+        std::vector<std::vector<char>> blocks;
+        blocks.reserve(Compress::numBlocks(size));
+
+        std::vector<T> values;
+        values.reserve(std::min(size, rangeSize));
+
+        for (auto begin = std::size_t{0}; begin < size; begin += rangeSize) {
+            const auto end = std::min(size, begin + rangeSize);
+
+            values.resize(end - begin);
+            fill(begin, end, values.data());
+
+            for (auto& block : Compress::encodeBlocks(values.data(), values.size()))
+                blocks.push_back(std::move(block));
+        }
+
+        writeBinaryHeader(name, size, arrType, 'Z');
+        writeCompressedBlocks(blocks);
+    }
+
+    void writeCompressedBlocks(const std::vector<std::vector<char>>& blocks);
+
+    /// Write index record of compressed blocks of \p blockBytes bytes,
+    /// and a single compressed block.
+    void writeBlockIndex(const std::vector<std::size_t>& blockBytes);
+    void writeBlock(const std::vector<char>& block);
+
+    /// Write array header.  Non-null \p layout is the leading character
+    /// of the element type of compressed ('Z') and referencing ('D', 'R')
+    /// arrays.
+    void writeBinaryHeader(const std::string& arrName, int size, eclArrType arrType,
+                           const char layout = '\0');
+
+    void writeReferenceRecord(const int seqnum);
+
+    /// Write array which equals the array of the same name in report
+    /// step \p seqnum of a unified restart file.
+    void writeReference(const std::string& name, const std::size_t size,
+                        const eclArrType arrType, const int seqnum);
+
+    /// Write array as compressed differences from the array of the same
+    /// name in report step \p seqnum of a unified restart file.
+    void writeDelta(const std::string& name, const std::size_t size,
+                    const eclArrType arrType, const int seqnum,
+                    const std::vector<std::vector<char>>& blocks);
+
+    /// As above, but the compressed blocks are generated one at a time
+    /// while writing.  \p blockBytes holds the size of each block, and
+    /// block(i) must return block i of exactly that size.
+    void writeDelta(const std::string& name, const std::size_t size,
+                    const eclArrType arrType, const int seqnum,
+                    const std::vector<std::size_t>& blockBytes,
+                    const std::function<std::vector<char>(std::size_t)>& block);
 
     template <typename T>
     void writeBinaryArray(const std::vector<T>& data);
@@ -91,10 +238,13 @@ private:
     void writeFormattedCharArray(const std::vector<std::string>& data);
     void writeFormattedCharArray(const std::vector<PaddedOutputString<8>>& data);
 
+    std::size_t elementsPerBlock(eclArrType arrType) const;
+
     std::string make_real_string(float value) const;
     std::string make_doub_string(double value) const;
 
     bool isFormatted;
+    bool isCompressed = false;
     std::ofstream ofileH;
 };
 
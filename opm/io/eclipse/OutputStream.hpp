@@ -22,9 +22,12 @@
 
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 
+#include <cstddef>
+#include <functional>
 #include <ios>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Opm { namespace EclIO {
@@ -35,8 +38,15 @@ namespace Opm { namespace EclIO {
 
 namespace Opm { namespace EclIO { namespace OutputStream {
 
-    struct Formatted { bool set; };
-    struct Unified   { bool set; };
+    struct Formatted  { bool set; };
+    struct Unified    { bool set; };
+    struct Compressed { bool set; };
+
+    /// Generator of single precision output values.  Called as
+    /// source(begin, end, block) to store elements [begin, end) of the
+    /// output vector in block[0 .. end - begin).
+    using SinglePrecisionSource =
+        std::function<void(std::size_t begin, std::size_t end, float* block)>;
 
     /// Abstract representation of an ECLIPSE-style result set.
     struct ResultSet
@@ -48,8 +58,91 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         std::string baseName;
     };
 
+    /// Abstract destination of result arrays.
+    ///
+    /// The result writers (INIT, restart and RFT) emit their arrays
+    /// through this interface whence the file format is determined by the
+    /// concrete output stream.  Init, Restart and RFT create files in the
+    /// ECLIPSE formats while Columnar (see Columnar.hpp) creates a
+    /// directory of separately readable arrays.
+    class ArrayWriter
+    {
+    public:
+        virtual ~ArrayWriter();
+
+        /// Generate a message string (keyword type 'MESS') in underlying
+        /// output stream.
+        ///
+        /// \param[in] msg Message string (e.g., "STARTSOL").
+        virtual void message(const std::string& msg) = 0;
+
+        /// Write integer data to underlying output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        virtual void write(const std::string&      kw,
+                           const std::vector<int>& data) = 0;
+
+        /// Write boolean data to underlying output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        virtual void write(const std::string&       kw,
+                           const std::vector<bool>& data) = 0;
+
+        /// Write single precision floating point data to underlying
+        /// output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        virtual void write(const std::string&        kw,
+                           const std::vector<float>& data) = 0;
+
+        /// Write double precision floating point data to underlying
+        /// output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        virtual void write(const std::string&         kw,
+                           const std::vector<double>& data) = 0;
+
+        /// Write single precision floating point data to underlying
+        /// output stream without forming the full output vector.  The
+        /// values are generated one output block at a time.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] size Number of elements in output vector.
+        ///
+        /// \param[in] source Generator of output values.
+        virtual void write(const std::string&           kw,
+                           const std::size_t            size,
+                           const SinglePrecisionSource& source) = 0;
+
+        /// Write unpadded string data to underlying output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        virtual void write(const std::string&              kw,
+                           const std::vector<std::string>& data) = 0;
+
+        /// Write padded character data (8 characters per string)
+        /// to underlying output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        virtual void write(const std::string&                        kw,
+                           const std::vector<PaddedOutputString<8>>& data) = 0;
+    };
+
     /// File manager for "init" output streams.
-    class Init
+    class Init : public ArrayWriter
     {
     public:
         /// Constructor.
@@ -62,7 +155,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         explicit Init(const ResultSet& rset,
                       const Formatted& fmt);
 
-        ~Init();
+        ~Init() override;
 
         Init(const Init& rhs) = delete;
         Init(Init&& rhs);
@@ -70,13 +163,19 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         Init& operator=(const Init& rhs) = delete;
         Init& operator=(Init&& rhs);
 
+        /// Generate a message string (keyword type 'MESS') in underlying
+        /// output stream.
+        ///
+        /// \param[in] msg Message string.
+        void message(const std::string& msg) override;
+
         /// Write integer data to underlying output stream.
         ///
         /// \param[in] kw Name of output vector (keyword).
         ///
         /// \param[in] data Output values.
         void write(const std::string&      kw,
-                   const std::vector<int>& data);
+                   const std::vector<int>& data) override;
 
         /// Write boolean data to underlying output stream.
         ///
@@ -84,7 +183,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] data Output values.
         void write(const std::string&       kw,
-                   const std::vector<bool>& data);
+                   const std::vector<bool>& data) override;
 
         /// Write single precision floating point data to underlying
         /// output stream.
@@ -93,7 +192,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] data Output values.
         void write(const std::string&        kw,
-                   const std::vector<float>& data);
+                   const std::vector<float>& data) override;
 
         /// Write double precision floating point data to underlying
         /// output stream.
@@ -102,7 +201,37 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] data Output values.
         void write(const std::string&         kw,
-                   const std::vector<double>& data);
+                   const std::vector<double>& data) override;
+
+        /// Write single precision floating point data to underlying
+        /// output stream without forming the full output vector.  The
+        /// values are generated one output block at a time.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] size Number of elements in output vector.
+        ///
+        /// \param[in] source Generator of output values.
+        void write(const std::string&           kw,
+                   const std::size_t            size,
+                   const SinglePrecisionSource& source) override;
+
+        /// Write unpadded string data to underlying output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&              kw,
+                   const std::vector<std::string>& data) override;
+
+        /// Write padded character data (8 characters per string)
+        /// to underlying output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&                        kw,
+                   const std::vector<PaddedOutputString<8>>& data) override;
 
     private:
         /// Init file output stream.
@@ -128,8 +257,77 @@ namespace Opm { namespace EclIO { namespace OutputStream {
                        const std::vector<T>& data);
     };
 
+    /// Arrays previously written in full to a unified restart file.
+    ///
+    /// Restart streams created with a DeltaBase store arrays which are
+    /// equal, or close, to the array of the same name in an earlier report
+    /// step of the same file relative to that array (see EclCompress.hpp)
+    /// rather than in full.  The DeltaBase keeps a copy of each array of
+    /// at least \c minArraySize elements written in full, and must be
+    /// passed to the Restart stream of every report step of the file.
+    ///
+    /// The copies are the memory cost of referencing arrays: as much as
+    /// all the arrays of a report step, e.g., four bytes per active cell
+    /// for each single precision solution array.  Their total size is
+    /// limited by the constructor argument; arrays which do not fit are
+    /// written in full and not retained.
+    class DeltaBase
+    {
+    public:
+        /// Arrays with fewer elements than this are always written in
+        /// full and not retained.
+        static constexpr std::size_t minArraySize = 32;
+
+        /// Default limit on the total size of the retained arrays.
+        static constexpr std::size_t defaultMaxBytes = std::size_t{256} * 1024 * 1024;
+
+        /// Constructor.
+        ///
+        /// \param[in] maxBytes Limit on the total size, in bytes, of the
+        ///    retained arrays.
+        explicit DeltaBase(const std::size_t maxBytes = defaultMaxBytes);
+
+        /// Total size, in bytes, of the retained arrays.
+        std::size_t retainedBytes() const;
+
+        /// Forget all arrays.
+        void clear();
+
+        /// Forget arrays written at or after report step \p seqnum, e.g.,
+        /// when output is restarted from an earlier report step.
+        void discardFrom(const int seqnum);
+
+    private:
+        template <typename T>
+        struct Entry
+        {
+            int seqnum;
+            std::vector<T> data;
+        };
+
+        template <typename T>
+        using EntryMap = std::unordered_map<std::string, Entry<T>>;
+
+        std::size_t maxBytes_;
+        std::size_t retainedBytes_ = 0;
+
+        EntryMap<int>         inte_;
+        EntryMap<bool>        logi_;
+        EntryMap<float>       real_;
+        EntryMap<double>      doub_;
+        EntryMap<std::string> char_;
+
+        EntryMap<int>&         entries(const std::vector<int>&)         { return this->inte_; }
+        EntryMap<bool>&        entries(const std::vector<bool>&)        { return this->logi_; }
+        EntryMap<float>&       entries(const std::vector<float>&)       { return this->real_; }
+        EntryMap<double>&      entries(const std::vector<double>&)      { return this->doub_; }
+        EntryMap<std::string>& entries(const std::vector<std::string>&) { return this->char_; }
+
+        friend class Restart;
+    };
+
     /// File manager for restart output streams.
-    class Restart
+    class Restart : public ArrayWriter
     {
     public:
         /// Constructor.
@@ -154,7 +352,38 @@ namespace Opm { namespace EclIO { namespace OutputStream {
                          const Formatted& fmt,
                          const Unified&   unif);
 
-        ~Restart();
+        /// Constructor.
+        ///
+        /// As above, but optionally stores large numeric arrays in
+        /// independently compressed blocks (see EclCompress.hpp).
+        ///
+        /// \param[in] compr Whether or not to compress large INTE, REAL
+        ///    and DOUB arrays.  Ignored for formatted output files.
+        explicit Restart(const ResultSet&  rset,
+                         const int         seqnum,
+                         const Formatted&  fmt,
+                         const Unified&    unif,
+                         const Compressed& compr);
+
+        /// Constructor.
+        ///
+        /// As above, but stores arrays of a unified, unformatted restart
+        /// file relative to the arrays of earlier report steps when this
+        /// reduces the file size.
+        ///
+        /// \param[in,out] deltas Arrays written in full to earlier report
+        ///    steps of the file.  Updated with the arrays written in full
+        ///    to this report step.  Must outlive the Restart object.
+        ///    Nullptr, or separate or formatted output files, disables
+        ///    referencing arrays.
+        explicit Restart(const ResultSet&  rset,
+                         const int         seqnum,
+                         const Formatted&  fmt,
+                         const Unified&    unif,
+                         const Compressed& compr,
+                         DeltaBase*        deltas);
+
+        ~Restart() override;
 
         Restart(const Restart& rhs) = delete;
         Restart(Restart&& rhs);
@@ -166,7 +395,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// output stream.
         ///
         /// \param[in] msg Message string (e.g., "STARTSOL").
-        void message(const std::string& msg);
+        void message(const std::string& msg) override;
 
         /// Write integer data to underlying output stream.
         ///
@@ -174,7 +403,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] data Output values.
         void write(const std::string&      kw,
-                   const std::vector<int>& data);
+                   const std::vector<int>& data) override;
 
         /// Write boolean data to underlying output stream.
         ///
@@ -182,7 +411,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] data Output values.
         void write(const std::string&       kw,
-                   const std::vector<bool>& data);
+                   const std::vector<bool>& data) override;
 
         /// Write single precision floating point data to underlying
         /// output stream.
@@ -191,7 +420,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] data Output values.
         void write(const std::string&        kw,
-                   const std::vector<float>& data);
+                   const std::vector<float>& data) override;
 
         /// Write double precision floating point data to underlying
         /// output stream.
@@ -200,7 +429,20 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] data Output values.
         void write(const std::string&         kw,
-                   const std::vector<double>& data);
+                   const std::vector<double>& data) override;
+
+        /// Write single precision floating point data to underlying
+        /// output stream without forming the full output vector.  The
+        /// values are generated one output block at a time.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] size Number of elements in output vector.
+        ///
+        /// \param[in] source Generator of output values.
+        void write(const std::string&           kw,
+                   const std::size_t            size,
+                   const SinglePrecisionSource& source) override;
 
         /// Write unpadded string data to underlying output stream.
         ///
@@ -208,7 +450,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] data Output values.
         void write(const std::string&              kw,
-                   const std::vector<std::string>& data);
+                   const std::vector<std::string>& data) override;
 
         /// Write padded character data (8 characters per string)
         /// to underlying output stream.
@@ -217,12 +459,19 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] data Output values.
         void write(const std::string&                        kw,
-                   const std::vector<PaddedOutputString<8>>& data);
+                   const std::vector<PaddedOutputString<8>>& data) override;
 
     private:
         /// Restart output stream.
         std::unique_ptr<EclOutput> stream_;
 
+        /// Sequence number of this report step.
+        int seqnum_;
+
+        /// Arrays of earlier report steps.  Nullptr unless arrays are
+        /// stored relative to them.
+        DeltaBase* deltas_ = nullptr;
+
         /// Open unified output file and place stream's output indicator
         /// in appropriate location.
         ///
@@ -235,7 +484,9 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] seqnum Sequence number of new report.  One-based
         ///    report step ID.
-        void openUnified(const std::string& fname,
+        ///
+        /// \return Whether or not a new output file was created.
+        bool openUnified(const std::string& fname,
                          const bool         formatted,
                          const int          seqnum);
 
@@ -270,6 +521,162 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// Must not be called prior to \c prepareStep.
         EclOutput& stream();
 
+        /// Implementation function for public \c write overload set.
+        template <typename T>
+        void writeImpl(const std::string&    kw,
+                       const std::vector<T>& data);
+
+        /// Write array relative to the array of the same name in an
+        /// earlier report step if that is possible and worthwhile.
+        /// Returns whether or not the array was written.
+        template <typename T>
+        bool writeReferencing(const std::string&    kw,
+                              const std::vector<T>& values);
+
+        /// Write single precision array generated by \p source relative
+        /// to the array of the same name in an earlier report step if
+        /// that is possible and worthwhile.  The array is generated and
+        /// compared one compressed block at a time, and generated a second
+        /// time if it is written as compressed differences.  Returns
+        /// whether or not the array was written.
+        bool writeReferencing(const std::string&           kw,
+                              const std::size_t            size,
+                              const SinglePrecisionSource& source);
+
+        /// Whether or not an array of \p bytes bytes written in full to
+        /// this report step fits in the DeltaBase.
+        template <typename T>
+        bool retainable(const std::string& kw,
+                        const std::size_t  bytes) const;
+
+        /// Retain copy of array written in full to this report step.
+        template <typename T>
+        void retain(const std::string& kw,
+                    std::vector<T>&&   values);
+    };
+
+    /// File manager for RFT output streams.
+    class RFT : public ArrayWriter
+    {
+    public:
+        /// Whether or not to append to an existing RFT file.
+        struct OpenExisting { bool set; };
+
+        /// Constructor.
+        ///
+        /// Opens file stream for writing.  All RFT data of a report
+        /// step is written through the same stream.
+        ///
+        /// \param[in] rset Output directory and base name of output stream.
+        ///
+        /// \param[in] fmt Whether or not to create formatted output files.
+        ///
+        /// \param[in] existing Whether or not to append to an existing
+        ///    RFT file, or to create a new one.
+        explicit RFT(const ResultSet&    rset,
+                     const Formatted&    fmt,
+                     const OpenExisting& existing);
+
+        ~RFT() override;
+
+        RFT(const RFT& rhs) = delete;
+        RFT(RFT&& rhs);
+
+        RFT& operator=(const RFT& rhs) = delete;
+        RFT& operator=(RFT&& rhs);
+
+        /// Generate a message string (keyword type 'MESS') in underlying
+        /// output stream.
+        ///
+        /// \param[in] msg Message string.
+        void message(const std::string& msg) override;
+
+        /// Write integer data to underlying output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&      kw,
+                   const std::vector<int>& data) override;
+
+        /// Write boolean data to underlying output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&       kw,
+                   const std::vector<bool>& data) override;
+
+        /// Write single precision floating point data to underlying
+        /// output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&        kw,
+                   const std::vector<float>& data) override;
+
+        /// Write double precision floating point data to underlying
+        /// output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&         kw,
+                   const std::vector<double>& data) override;
+
+        /// Write single precision floating point data to underlying
+        /// output stream without forming the full output vector.  The
+        /// values are generated one output block at a time.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] size Number of elements in output vector.
+        ///
+        /// \param[in] source Generator of output values.
+        void write(const std::string&           kw,
+                   const std::size_t            size,
+                   const SinglePrecisionSource& source) override;
+
+        /// Write unpadded string data to underlying output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&              kw,
+                   const std::vector<std::string>& data) override;
+
+        /// Write padded character data (8 characters per string)
+        /// to underlying output stream.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void write(const std::string&                        kw,
+                   const std::vector<PaddedOutputString<8>>& data) override;
+
+    private:
+        /// RFT file output stream.
+        std::unique_ptr<EclOutput> stream_;
+
+        /// Open output stream.
+        ///
+        /// Writes to \c stream_.
+        ///
+        /// \param[in] fname Filename of output stream.
+        ///
+        /// \param[in] formatted Whether or not to create a
+        ///    formatted output file.
+        ///
+        /// \param[in] existing Whether or not to append to an existing
+        ///    output file.
+        void open(const std::string& fname,
+                  const bool         formatted,
+                  const bool         existing);
+
+        /// Access writable output stream.
+        EclOutput& stream();
+
         /// Implementation function for public \c write overload set.
         template <typename T>
         void writeImpl(const std::string&    kw,
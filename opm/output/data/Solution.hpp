@@ -55,6 +55,12 @@ class Solution : public std::map< std::string, data::CellData > {
         void convertToSI( const UnitSystem& );
         void convertFromSI( const UnitSystem& );
 
+        /*
+         * Whether the data fields are in SI units, i.e., whether they must
+         * be converted with UnitSystem::from_si() for output.
+         */
+        bool isSI() const;
+
     private:
         bool si = true;
 };
@@ -38,16 +38,24 @@ namespace Opm { namespace data {
 
 namespace Opm { namespace RestartIO { namespace Helpers {
 
+    class StaticWellCache;
+
     class AggregateConnectionData
     {
     public:
         explicit AggregateConnectionData(const std::vector<int>& inteHead);
 
+        /// Capture ICON and SCON, and the dynamic connection data XCON.
+        ///
+        /// If a cache is given, the ICON and SCON windows of wells which
+        /// are unchanged since they were stored are copied from the cache,
+        /// and the windows of the other wells are stored in it.
         void captureDeclaredConnData(const Opm::Schedule&        sched,
                                      const Opm::EclipseGrid&     grid,
                                      const Opm::UnitSystem&      units,
                                      const Opm::data::WellRates& xw,
-                                     const std::size_t           sim_step);
+                                     const std::size_t           sim_step,
+                                     StaticWellCache*            cache = nullptr);
 
         const std::vector<int>& getIConn() const
         {
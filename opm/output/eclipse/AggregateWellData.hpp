@@ -40,16 +40,25 @@ namespace Opm { namespace data {
 
 namespace Opm { namespace RestartIO { namespace Helpers {
 
+    class StaticWellCache;
+
     class AggregateWellData
     {
     public:
         explicit AggregateWellData(const std::vector<int>& inteHead);
 
+        /// Capture the static contributions to IWEL, SWEL, XWEL and ZWEL.
+        ///
+        /// If a cache is given, the windows of wells which are unchanged
+        /// since they were stored are copied from the cache, and the
+        /// windows of the other wells are stored in it unless they depend
+        /// on the summary state.
 	void captureDeclaredWellData(const Schedule&   	sched,
                         const UnitSystem& 		units,
                         const std::size_t 		sim_step,
 			const ::Opm::SummaryState&  	smry,
-			const std::vector<int>& 	inteHead);
+			const std::vector<int>& 	inteHead,
+			StaticWellCache*		cache = nullptr);
 
         void captureDynamicWellData(const Opm::Schedule&        sched,
                                     const std::size_t           sim_step,
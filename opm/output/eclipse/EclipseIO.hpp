@@ -50,6 +50,24 @@ class SummaryState;
  */
 class EclipseIO {
 public:
+    /*!
+     * \brief Container format of INIT, restart and RFT output.
+     *
+     * Eclipse creates the ECLIPSE binary or formatted result files while
+     * Columnar stores every array of the INIT data and of each report step
+     * in a separate file below the directory <BASE>.COLUMNS (see
+     * opm/io/eclipse/Columnar.hpp).  loadRestart() reads the restart
+     * data of the selected backend.
+     *
+     * Grid and summary output always use the ECLIPSE formats.  The EGRID
+     * file is written by EclipseGrid::save() and the summary by libecl's
+     * ecl_sum writer, which keeps the SMSPEC and UNSMRY files open for
+     * the whole run and appends to them itself.  Neither emits its arrays
+     * through an OutputStream::ArrayWriter, so there is nothing to send
+     * to a Columnar stream.
+     */
+    enum class Backend { Eclipse, Columnar };
+
     /*!
      * \brief Sets the common attributes required to write eclipse
      *        binary files using ERT.
@@ -57,7 +75,8 @@ public:
     EclipseIO( const EclipseState& es,
                EclipseGrid grid,
                const Schedule& schedule,
-               const SummaryConfig& summary_config);
+               const SummaryConfig& summary_config,
+               const Backend backend = Backend::Eclipse);
 
 
 
@@ -176,7 +195,7 @@ public:
                         int report_step,
                         bool isSubstep,
                         double seconds_elapsed,
-                        RestartValue value,
+                        const RestartValue& value,
                         const bool write_double = false);
 
 
@@ -199,7 +218,9 @@ public:
 
       The function will consult the InitConfig object in the
       EclipseState object to determine which file and report step to
-      load.
+      load.  With Backend::Columnar the restart data is read from the
+      section <RESTART_ROOT>.COLUMNS/RESTART_nnnn instead of an ECLIPSE
+      restart file.
 
       The return value is of type 'data::Solution', which is the same
       container type which is used by the EclipseIO, but observe
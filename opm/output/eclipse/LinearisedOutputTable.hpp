@@ -87,6 +87,34 @@ namespace Opm {
                               const std::size_t numCols,
                               const double      fillValue);
 
+        /// Constructor.
+        ///
+        /// Table stored in place at the end of an existing buffer, e.g.,
+        /// the full TAB vector, rather than in an internal buffer.
+        ///
+        /// \param[in,out] buffer External storage.  On output, extended
+        ///    by \code numTables * numPrimary * numRows * numCols
+        ///    \endcode elements, all equal to \p fillValue, that hold the
+        ///    table data.  Must outlive the table object and must not be
+        ///    resized while the table object is in use.
+        ///
+        /// \param[in] numTables Number of tables managed by buffer.
+        ///
+        /// \param[in] numPrimary Number of primary look-up keys for the
+        ///    tabular data managed by the buffer.
+        ///
+        /// \param[in] numRows Number of rows in each sub-table.
+        ///
+        /// \param[in] numCols Number of columns in each sub-table.
+        ///
+        /// \param[in] fillValue Data element value for padded table entries.
+        LinearisedOutputTable(std::vector<double>& buffer,
+                              const std::size_t    numTables,
+                              const std::size_t    numPrimary,
+                              const std::size_t    numRows,
+                              const std::size_t    numCols,
+                              const double         fillValue);
+
         /// Retrieve iterator to start of \c numRows (contiguous) column
         /// elements of a particular sub-table of a particular main table.
         ///
@@ -111,11 +139,13 @@ namespace Opm {
         /// Read-only access to internal data buffer.
         ///
         /// Mostly to support outputting all table data to external storage.
+        /// Not meaningful for tables stored in an external buffer.
         const std::vector<double>& getData() const;
 
         /// Destructive access to internal data buffer.
         ///
         /// Mostly to support outputting all table data to external storage.
+        /// Not meaningful for tables stored in an external buffer.
         ///
         /// \return \code std::move() \endcode of the internal data buffer.
         std::vector<double> getDataDestructively();
@@ -132,6 +162,13 @@ namespace Opm {
 
         /// Number of rows per sub-table in \c data_.
         std::size_t numRows;
+
+        /// External buffer for tabular data.  Null if the table data is
+        /// stored in \c data.
+        std::vector<double>* external{ nullptr };
+
+        /// Start of table data in \c external.
+        std::size_t offset{ 0 };
     };
 
     /// Apply piecewise linear differentiation (i.e., compute slopes) on a
@@ -42,7 +42,13 @@ namespace Opm {
 
 namespace Opm { namespace EclIO { namespace OutputStream {
 
-    class Restart;
+    class ArrayWriter;
+
+}}}
+
+namespace Opm { namespace RestartIO { namespace Helpers {
+
+    class StaticWellCache;
 
 }}}
 
@@ -66,18 +72,28 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 
    will read from and write to the file "CASE.X0010" - completely ignoring
    the report step argument '99'.
+
+   The optional wellCache is used to retain the static well and connection
+   data between calls to save(), so that it is only recomputed for the wells
+   which have changed; the cache must only be used with one grid and unit
+   system.
+
+   The solution and extra vectors of the RestartValue are converted to
+   output units while they are written; the RestartValue itself is neither
+   copied nor modified.
 */
 namespace Opm { namespace RestartIO {
 
-    void save(EclIO::OutputStream::Restart& rstFile,
-              int                           report_step,
-              double                        seconds_elapsed,
-              RestartValue                  value,
-              const EclipseState&           es,
-              const EclipseGrid&            grid,
-              const Schedule&               schedule,
-              const SummaryState&           sumState,
-              bool                          write_double = false);
+    void save(EclIO::OutputStream::ArrayWriter& rstFile,
+              int                               report_step,
+              double                            seconds_elapsed,
+              const RestartValue&               value,
+              const EclipseState&               es,
+              const EclipseGrid&                grid,
+              const Schedule&                   schedule,
+              const SummaryState&               sumState,
+              bool                              write_double = false,
+              Helpers::StaticWellCache*         wellCache = nullptr);
 
 
     RestartValue load(const std::string&             filename,
@@ -89,6 +105,20 @@ namespace Opm { namespace RestartIO {
                       const Schedule&                schedule,
                       const std::vector<RestartKey>& extra_keys = {});
 
+    /*
+      Load from the restart section of a columnar result set, i.e. the
+      directory <BASE>.COLUMNS/RESTART_nnnn written by an
+      EclIO::OutputStream::Columnar stream.
+    */
+    RestartValue loadColumnar(const std::string&             directory,
+                              int                            report_step,
+                              SummaryState&                  summary_state,
+                              const std::vector<RestartKey>& solution_keys,
+                              const EclipseState&            es,
+                              const EclipseGrid&             grid,
+                              const Schedule&                schedule,
+                              const std::vector<RestartKey>& extra_keys = {});
+
 }} // namespace Opm::RestartIO
 
 #endif  // RESTART_IO_HPP
@@ -0,0 +1,122 @@
+/*
+  Copyright (c) 2019 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_STATIC_WELL_CACHE_HPP
+#define OPM_STATIC_WELL_CACHE_HPP
+
+#include <opm/io/eclipse/PaddedOutputString.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Opm {
+    class Well2;
+} // Opm
+
+namespace Opm { namespace RestartIO { namespace Helpers {
+
+    /// Static per-well portions of the restart file's well and connection
+    /// arrays, retained from one restart output to the next.
+    ///
+    /// For a fixed grid and unit system the static contributions to IWEL,
+    /// SWEL, XWEL, ZWEL, ICON and SCON only depend on the well's Schedule
+    /// object, and the Schedule shares a single Well2 instance between all
+    /// report steps in which the well is unchanged.  The entries are
+    /// therefore keyed on that instance, which the cache holds on to, and
+    /// the aggregators only recompute the contributions of wells which
+    /// have changed since the previous restart output.
+    ///
+    /// The well and connection entries are kept apart so that the well
+    /// and connection arrays can be aggregated concurrently.  Each
+    /// aggregator drops the entries of wells which are not part of the
+    /// report step being output before using the cache, so the cache
+    /// holds on to at most one Well2 instance per well of that step.
+    class StaticWellCache
+    {
+    public:
+        /// Static windows of the well arrays for a single well.
+        struct WellData
+        {
+            std::shared_ptr<const Well2> well;
+
+            /// Multi-segment well ID and group index the windows were
+            /// computed for; these depend on the other wells and groups.
+            std::size_t msWellID;
+            int groupIndex;
+
+            std::vector<int>    iWell;
+            std::vector<float>  sWell;
+            std::vector<double> xWell;
+            std::vector<EclIO::PaddedOutputString<8>> zWell;
+        };
+
+        /// Static windows of the connection arrays for a single well.
+        struct ConnData
+        {
+            std::shared_ptr<const Well2> well;
+
+            /// Whether each of the well's active connections, in
+            /// WellConnections order, is open.
+            std::vector<bool> open;
+
+            /// ICON and SCON windows of the connections in output order,
+            /// concatenated.
+            std::vector<int>   iConn;
+            std::vector<float> sConn;
+        };
+
+        /// Cached well array windows of a well, or nullptr if the well
+        /// has changed or has not been stored.
+        const WellData* wellData(const std::shared_ptr<const Well2>& well,
+                                 const std::size_t                   msWellID,
+                                 const int                           groupIndex) const;
+
+        /// Cached connection array windows of a well, or nullptr if the
+        /// well has changed or has not been stored.
+        const ConnData* connData(const std::shared_ptr<const Well2>& well) const;
+
+        void storeWellData(WellData data);
+        void storeConnData(ConnData data);
+
+        /// Drop the well array entries of all wells which are not among
+        /// \p wells, or which have changed.
+        void retainWellData(const std::vector<std::shared_ptr<const Well2>>& wells);
+
+        /// Drop the connection array entries of all wells which are not
+        /// among \p wells, or which have changed.
+        void retainConnData(const std::vector<std::shared_ptr<const Well2>>& wells);
+
+        /// Number of wells with cached well and connection array entries
+        /// respectively.
+        std::size_t numWellData() const;
+        std::size_t numConnData() const;
+
+        void clear();
+
+    private:
+        std::map<std::string, WellData> wells_;
+        std::map<std::string, ConnData> conns_;
+    };
+
+}}} // Opm::RestartIO::Helpers
+
+#endif // OPM_STATIC_WELL_CACHE_HPP
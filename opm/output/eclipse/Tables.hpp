@@ -22,6 +22,7 @@
 #ifndef OUTPUT_TABLES_HPP
 #define OUTPUT_TABLES_HPP
 
+#include <functional>
 #include <vector>
 
 #include <ert/ecl/FortIO.hpp>
@@ -79,6 +80,12 @@ namespace Opm {
         void addData(const std::size_t          offset_index,
                      const std::vector<double>& new_data);
 
+        /// Register the next block of the TAB vector at \p offset_index,
+        /// with the block contents appended to the TAB vector in place by
+        /// \p appendData.
+        void addData(const std::size_t                                 offset_index,
+                     const std::function<void(std::vector<double>&)>& appendData);
+
         /// Add saturation function tables corresponding to family I (SGOF,
         /// SWOF) to the tabular data (TABDIMS and TAB vectors).
         ///
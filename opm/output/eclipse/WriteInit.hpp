@@ -41,19 +41,19 @@ namespace Opm { namespace data {
 
 namespace Opm { namespace EclIO { namespace OutputStream {
 
-    class Init;
+    class ArrayWriter;
 
 }}} // namespace Opm::EclIO::OutputStream
 
 namespace Opm { namespace InitIO {
 
-    void write(const ::Opm::EclipseState&              es,
-               const ::Opm::EclipseGrid&               grid,
-               const ::Opm::Schedule&                  schedule,
-               const ::Opm::data::Solution&            simProps,
-               std::map<std::string, std::vector<int>> int_data,
-               const ::Opm::NNC&                       nnc,
-               ::Opm::EclIO::OutputStream::Init&       initFile);
+    void write(const ::Opm::EclipseState&               es,
+               const ::Opm::EclipseGrid&                grid,
+               const ::Opm::Schedule&                   schedule,
+               const ::Opm::data::Solution&             simProps,
+               std::map<std::string, std::vector<int>>  int_data,
+               const ::Opm::NNC&                        nnc,
+               ::Opm::EclIO::OutputStream::ArrayWriter& initFile);
 
 }} // namespace Opm::InitIO
 
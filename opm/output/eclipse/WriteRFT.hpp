@@ -0,0 +1,77 @@
+/*
+  Copyright (c) 2019 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_WRITE_RFT_HPP
+#define OPM_WRITE_RFT_HPP
+
+namespace Opm {
+
+    class EclipseGrid;
+    class Schedule;
+    class UnitSystem;
+
+} // namespace Opm
+
+namespace Opm { namespace data {
+
+    class WellRates;
+
+}} // namespace Opm::data
+
+namespace Opm { namespace EclIO { namespace OutputStream {
+
+    class ArrayWriter;
+
+}}} // namespace Opm::EclIO::OutputStream
+
+namespace Opm { namespace RftIO {
+
+    /// Write RFT data of all wells for which RFT or PLT output is requested
+    /// at report step \p reportStep to an open RFT output stream.
+    ///
+    /// Each well's record consists of the arrays TIME, DATE, WELLETC,
+    /// CON{I,J,K}POS, HOSTGRID, DEPTH, PRESSURE, SWAT and SGAS, holding
+    /// the values of the well's connections to active cells in output
+    /// units.  Wells without connection data are skipped.
+    ///
+    /// \param[in] reportStep Report step index into the schedule.
+    ///
+    /// \param[in] elapsed Simulated time, in seconds, since the start of
+    ///    the simulation.
+    ///
+    /// \param[in] usys Output unit system.
+    ///
+    /// \param[in] grid Simulation grid.
+    ///
+    /// \param[in] schedule Run's schedule, holding the RFT configuration.
+    ///
+    /// \param[in] wellSol Dynamic well and connection data in SI units.
+    ///
+    /// \param[in,out] rftFile RFT output stream.
+    void write(const int                                reportStep,
+               const double                             elapsed,
+               const ::Opm::UnitSystem&                 usys,
+               const ::Opm::EclipseGrid&                grid,
+               const ::Opm::Schedule&                   schedule,
+               const ::Opm::data::WellRates&            wellSol,
+               ::Opm::EclIO::OutputStream::ArrayWriter& rftFile);
+
+}} // namespace Opm::RftIO
+
+#endif // OPM_WRITE_RFT_HPP
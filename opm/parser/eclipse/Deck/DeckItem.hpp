@@ -20,6 +20,7 @@
 #ifndef DECKITEM_HPP
 #define DECKITEM_HPP
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -42,6 +43,10 @@ namespace Opm {
         DeckItem( const std::string&, std::string, size_t size_hint = 8 );
         DeckItem( const std::string&, UDAValue, size_t size_hint = 8 );
 
+        /*
+          Item names are interned: all items with the same name return a
+          reference to the same string, which is never deallocated.
+        */
         const std::string& name() const;
 
         // return true if the default value was used for a given data point
@@ -66,7 +71,17 @@ namespace Opm {
         std::string getTrimmedString( size_t ) const;
 
         template< typename T > const std::vector< T >& getData() const;
+
+        /*
+          getSIDoubleData() converts the data to SI units on the first call
+          and keeps the converted copy in the item for the lifetime of the
+          deck.  getSIDouble() and getSIDoubleDataCopy() convert the raw
+          values on every call and do not keep a copy; use them when the SI
+          values are copied into another container anyway, e.g. for the
+          large grid property keywords.
+        */
         const std::vector< double >& getSIDoubleData() const;
+        std::vector< double > getSIDoubleDataCopy() const;
 
         void push_back( UDAValue );
         void push_back( int );
@@ -113,6 +128,31 @@ namespace Opm {
         bool operator!=(const DeckItem& other) const;
         static bool to_bool(std::string string_value);
     private:
+        /*
+          Default flags of the values. The flags of the first 64 values are
+          stored inline, so that the large majority of items, which hold
+          only a few values, do not allocate any memory for them.
+        */
+        class DefaultFlags {
+        public:
+            size_t size() const { return this->count; }
+            bool empty() const { return this->count == 0; }
+            bool at( size_t index ) const;
+            void push_back( bool flag, size_t n = 1 );
+
+            bool operator==( const DefaultFlags& other ) const;
+            bool operator!=( const DefaultFlags& other ) const;
+
+        private:
+            static constexpr size_t inline_size = 64;
+
+            std::uint64_t bits = 0;
+            std::vector< bool > overflow;
+            size_t count = 0;
+        };
+
+        static const std::string* intern( const std::string& );
+
         mutable std::vector< double > dval;
         std::vector< int > ival;
         std::vector< std::string > sval;
@@ -120,11 +160,13 @@ namespace Opm {
 
         type_tag type = type_tag::unknown;
 
-        std::string item_name;
-        std::vector< bool > defaulted;
+        const std::string* item_name = intern( "" );
+        DefaultFlags defaulted;
         std::vector< Dimension > dimensions;
         mutable std::vector< double > SIdata;
 
+        void assertSIDimension() const;
+        void convertToSI( const std::vector< double >& raw, std::vector< double >& si_data ) const;
         template< typename T > std::vector< T >& value_ref();
         template< typename T > const std::vector< T >& value_ref() const;
         template< typename T > void push( T );
@@ -55,6 +55,7 @@ namespace Opm {
         const std::vector<int>& getIntData() const;
         const std::vector<double>& getRawDoubleData() const;
         const std::vector<double>& getSIDoubleData() const;
+        std::vector<double> getSIDoubleDataCopy() const;
         const std::vector<std::string>& getStringData() const;
         size_t getDataSize() const;
         void write( DeckOutput& output ) const;
@@ -140,6 +140,25 @@ namespace Opm {
       pass a field in the solution section which Eclipse does not recognize you
       will end up with a restart file which Eclipse can not read, even if you
       have set ecl_compatible_restart to true.
+
+
+      Compressed restart
+      ==================
+
+      The boolean flag compressed_restart in the IOConfig class, which is
+      false by default, requests that large numeric arrays of binary restart
+      files are stored in independently compressed blocks.  Such files are
+      read transparently by RestartIO::load(), but not by other
+      applications.  The compressECL utility converts between the compressed
+      and the standard layout.  Formatted restart files are never compressed.
+
+      The boolean flag delta_restart, also false by default, requests that
+      arrays of unified, unformatted restart files which are unchanged, or
+      nearly unchanged, since an earlier report step are stored relative to
+      the array of that report step.  This typically shrinks restart files
+      with many report steps considerably, at the cost of keeping a copy of
+      the arrays written in full in memory during the simulation.  Such
+      files are also only read by OPM, and compressECL expands them.
     */
 
 
@@ -154,6 +173,10 @@ namespace Opm {
 
         void setEclCompatibleRST(bool ecl_rst);
         bool getEclCompatibleRST() const;
+        void setCompressedRST(bool compressed);
+        bool getCompressedRST() const;
+        void setDeltaRST(bool delta);
+        bool getDeltaRST() const;
         bool getWriteEGRIDFile() const;
         bool getWriteINITFile() const;
         bool getUNIFOUT() const;
@@ -202,6 +225,8 @@ namespace Opm {
         bool            m_nosim;
         std::string     m_base_name;
         bool            ecl_compatible_rst = true;
+        bool            compressed_rst = false;
+        bool            delta_rst = false;
 
         IOConfig( const GRIDSection&,
                   const RUNSPECSection&,
@@ -21,7 +21,9 @@
 #ifndef DYNAMICSTATE_HPP_
 #define DYNAMICSTATE_HPP_
 
+#include <iterator>
 #include <stdexcept>
+#include <string>
 #include <vector>
 #include <algorithm>
 #include <utility>
@@ -50,6 +52,12 @@ namespace Opm {
        The update() method returns true if the updated value is
        different from the current value, this implies that the
        class<T> must support operator!=
+
+       Internally only the timesteps where the value changes are
+       stored, i.e. the memory usage is proportional to the number of
+       updates and not the number of timesteps, lookup with get() is
+       logarithmic in the number of updates and update() at the end of
+       the current range of updates is amortized constant time.
     */
 
 
@@ -61,20 +69,23 @@ class DynamicState {
         typedef typename std::vector< T >::iterator iterator;
 
         DynamicState( const TimeMap& timeMap, T initial ) :
-            m_data( timeMap.size(), initial ),
+            m_size( timeMap.size() ),
+            m_index( 1, 0 ),
+            m_values( 1, initial ),
             initial_range( timeMap.size() )
         {}
 
         void globalReset( T value ) {
-            this->m_data.assign( this->m_data.size(), value );
+            this->m_index.assign( 1, 0 );
+            this->m_values.assign( 1, value );
         }
 
         const T& back() const {
-            return m_data.back();
+            return m_values.back();
         }
 
         const T& at( size_t index ) const {
-            return this->m_data.at( index );
+            return this->m_values[ this->lookup( index ) ];
         }
 
         const T& operator[](size_t index) const {
@@ -86,26 +97,18 @@ class DynamicState {
         }
 
         void updateInitial( T initial ) {
-            std::fill_n( this->m_data.begin(), this->initial_range, initial );
+            this->assign( 0, this->initial_range, initial );
         }
 
 
         std::vector<std::pair<std::size_t, T>> unique() const {
-            if (this->m_data.empty())
+            if (this->m_size == 0)
                 return {};
 
-            const auto * current_value = std::addressof(this->m_data[0]);
-            std::size_t current_index = 0;
-            std::vector<std::pair<std::size_t, T>> result{{current_index, *current_value}};
-            while (true) {
-                if (this->m_data[current_index] != *current_value) {
-                    current_value = std::addressof(this->m_data[current_index]);
-                    result.emplace_back(current_index, *current_value);
-                }
-
-                current_index++;
-                if (current_index == this->m_data.size())
-                    break;
+            std::vector<std::pair<std::size_t, T>> result{{this->m_index[0], this->m_values[0]}};
+            for (std::size_t pos = 1; pos < this->m_index.size(); pos++) {
+                if (this->m_values[pos] != result.back().second)
+                    result.emplace_back(this->m_index[pos], this->m_values[pos]);
             }
 
             return result;
@@ -117,25 +120,27 @@ class DynamicState {
            return true, otherwise it will return false.
         */
         bool update( size_t index, T value ) {
-            if( this->initial_range == this->m_data.size() )
+            if( this->initial_range == this->m_size )
                 this->initial_range = index;
 
-            const bool change = (value != this->m_data.at( index ));
+            const bool change = (value != this->at( index ));
 
             if( !change ) return false;
 
-            std::fill( this->m_data.begin() + index,
-                       this->m_data.end(),
-                       value );
+            const auto pos = this->lower_pos( index );
+            this->m_index.erase( this->m_index.begin() + pos, this->m_index.end() );
+            this->m_values.erase( this->m_values.begin() + pos, this->m_values.end() );
 
+            this->m_index.push_back( index );
+            this->m_values.push_back( std::move(value) );
             return true;
         }
 
         void update_elm( size_t index, const T& value ) {
-            if (this->m_data.size() <= index)
+            if (this->m_size <= index)
                 throw std::out_of_range("Invalid index for update_elm()");
 
-            this->m_data[index] = value;
+            this->assign( index, index + 1, value );
         }
 
 
@@ -147,69 +152,125 @@ class DynamicState {
       applied for all times in the range [Tx,T2].
     */
     void update_equal(size_t index, const T& value) {
-        if (this->m_data.size() <= index)
+        if (this->m_size <= index)
             throw std::out_of_range("Invalid index for update_equal()");
 
-        const T prev_value = this->m_data[index];
+        auto pos = this->lookup( index );
+        const T prev_value = this->m_values[pos];
         if (prev_value == value)
             return;
 
-        while (true) {
-            if (this->m_data[index] != prev_value)
-                break;
-
-            this->m_data[index] = value;
+        pos++;
+        while (pos < this->m_index.size() && this->m_values[pos] == prev_value)
+            pos++;
 
-            index++;
-            if (index == this->m_data.size())
-                break;
-
-        }
+        const auto end_index = (pos == this->m_index.size()) ? this->m_size : this->m_index[pos];
+        this->assign( index, end_index, value );
     }
 
     /// Will return the index of the first occurence of @value, or
     /// -1 if @value is not found.
     int find(const T& value) const {
-        auto iter = std::find( m_data.begin() , m_data.end() , value);
-        if( iter == this->m_data.end() ) return -1;
-
-        return std::distance( m_data.begin() , iter );
+        return this->find_if( [&value] (const T& elm) { return elm == value; } );
     }
 
     template<typename P>
     int find_if(P&& pred) const {
-        auto iter = std::find_if(m_data.begin(), m_data.end(), std::forward<P>(pred));
-        if( iter == this->m_data.end() ) return -1;
+        for (std::size_t pos = 0; pos < this->m_index.size(); pos++) {
+            if (pred(this->m_values[pos]))
+                return this->m_index[pos];
+        }
 
-        return std::distance( m_data.begin() , iter );
+        return -1;
     }
 
     /// Will return the index of the first value which is != @value, or -1
     /// if all values are == @value
     int find_not(const T& value) const {
-        auto iter = std::find_if_not( m_data.begin() , m_data.end() , [&value] (const T& elm) { return value == elm; });
-        if( iter == this->m_data.end() ) return -1;
-
-        return std::distance( m_data.begin() , iter );
+        return this->find_if( [&value] (const T& elm) { return !(value == elm); } );
     }
 
-    iterator begin() {
-        return this->m_data.begin();
-    }
+    struct ChangePointRange {
+        iterator first;
+        iterator last;
 
+        iterator begin() const { return this->first; }
+        iterator end() const { return this->last; }
+    };
 
-    iterator end() {
-        return this->m_data.end();
+    /*
+      Range over the stored values, i.e. one element for each report step
+      where the value changes - and not one element for each report step.
+      Modifying an element changes the value at all the report steps it
+      applies to.
+    */
+    ChangePointRange change_points() {
+        return { this->m_values.begin(), this->m_values.end() };
     }
 
 
     std::size_t size() const {
-        return this->m_data.size();
+        return this->m_size;
     }
 
     private:
-        std::vector< T > m_data;
+        /*
+          The values are stored as a sorted list of the report steps where the
+          value changes, m_values[i] applies in the range [m_index[i],
+          m_index[i + 1]). The first element of m_index is always zero.
+        */
+        std::size_t m_size;
+        std::vector< std::size_t > m_index;
+        std::vector< T > m_values;
         size_t initial_range;
+
+        /*
+          Position of the first change point >= index.
+        */
+        std::size_t lower_pos( std::size_t index ) const {
+            return std::distance( this->m_index.begin(),
+                                  std::lower_bound( this->m_index.begin(), this->m_index.end(), index ) );
+        }
+
+        /*
+          Position of the value which applies at report step index.
+        */
+        std::size_t lookup( std::size_t index ) const {
+            if (index >= this->m_size)
+                throw std::out_of_range("Invalid index: " + std::to_string(index) + " for DynamicState");
+
+            if (index >= this->m_index.back())
+                return this->m_index.size() - 1;
+
+            auto iter = std::upper_bound( this->m_index.begin(), this->m_index.end(), index );
+            return std::distance( this->m_index.begin(), iter ) - 1;
+        }
+
+        /*
+          Will assign value to all the report steps in the range [begin_index,
+          end_index), the values outside the range are left unchanged.
+        */
+        void assign( std::size_t begin_index, std::size_t end_index, const T& value ) {
+            if (begin_index >= end_index)
+                return;
+
+            if (end_index < this->m_size) {
+                const auto end_pos = this->lower_pos( end_index );
+                if (end_pos == this->m_index.size() || this->m_index[end_pos] != end_index) {
+                    T end_value = this->m_values[ end_pos - 1 ];
+                    this->m_index.insert( this->m_index.begin() + end_pos, end_index );
+                    this->m_values.insert( this->m_values.begin() + end_pos, std::move(end_value) );
+                }
+            }
+
+            const auto begin_pos = this->lower_pos( begin_index );
+            const auto end_pos = this->lower_pos( end_index );
+            this->m_index.erase( this->m_index.begin() + begin_pos, this->m_index.begin() + end_pos );
+            this->m_values.erase( this->m_values.begin() + begin_pos, this->m_values.begin() + end_pos );
+
+            this->m_index.insert( this->m_index.begin() + begin_pos, begin_index );
+            this->m_values.insert( this->m_values.begin() + begin_pos, value );
+        }
 };
 
 }
@@ -0,0 +1,144 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GROUP_TOPOLOGY_HPP
+#define GROUP_TOPOLOGY_HPP
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm {
+
+class Group2;
+class Well2;
+
+/*
+  The GroupTopology class is a flattened, index based representation of the
+  group tree at one report step. Groups and wells are identified by their
+  position in the topology, the parent/child relations are stored as plain
+  index arrays and the efficiency factors are accumulated from the wells all
+  the way up to the FIELD group when the topology is created.
+
+  The Schedule creates a new GroupTopology instance only at the report steps
+  where the group structure or the efficiency factors actually change, the
+  instances are immutable and shared between all report steps in the
+  interval where they apply.
+*/
+
+class GroupTopology {
+public:
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    class IndexRange {
+    public:
+        IndexRange(const std::size_t * begin_arg, const std::size_t * end_arg) :
+            m_begin(begin_arg),
+            m_end(end_arg)
+        {}
+
+        const std::size_t * begin() const { return this->m_begin; }
+        const std::size_t * end() const { return this->m_end; }
+        std::size_t size() const { return static_cast<std::size_t>(this->m_end - this->m_begin); }
+        bool empty() const { return this->m_begin == this->m_end; }
+        std::size_t operator[](std::size_t index) const { return this->m_begin[index]; }
+    private:
+        const std::size_t * m_begin;
+        const std::size_t * m_end;
+    };
+
+    GroupTopology() = default;
+
+    /*
+      The groups and wells vectors should contain all the groups and wells
+      which are defined at the report step in question; the groups vector
+      must contain the FIELD group.
+    */
+    GroupTopology(const std::vector<const Group2*>& groups, const std::vector<const Well2*>& wells);
+
+    std::size_t numGroups() const;
+    std::size_t numWells() const;
+    bool hasGroup(const std::string& group_name) const;
+    bool hasWell(const std::string& well_name) const;
+    std::size_t groupIndex(const std::string& group_name) const;
+    std::size_t wellIndex(const std::string& well_name) const;
+    const std::string& groupName(std::size_t group_index) const;
+    const std::string& wellName(std::size_t well_index) const;
+
+    std::size_t root() const;
+    std::size_t parent(std::size_t group_index) const;
+    std::size_t level(std::size_t group_index) const;
+    IndexRange childGroups(std::size_t group_index) const;
+    IndexRange childWells(std::size_t group_index) const;
+    std::size_t wellGroup(std::size_t well_index) const;
+
+    double groupEfficiencyFactor(std::size_t group_index) const;
+    double wellEfficiencyFactor(std::size_t well_index) const;
+
+    /*
+      The product of the well efficiency factor and the efficiency factors of
+      all groups from the well's parent group and up to, and including, the
+      FIELD group.
+    */
+    double cumulativeEfficiencyFactor(std::size_t well_index) const;
+
+    /*
+      As cumulativeEfficiencyFactor(), but the accumulation stops - without
+      including the efficiency factor of that group - at the group
+      stop_group. If stop_group is not an ancestor of the well the result is
+      the same as for cumulativeEfficiencyFactor().
+    */
+    double cumulativeEfficiencyFactor(std::size_t well_index, std::size_t stop_group) const;
+
+    /*
+      The largest number of wells in one well group, i.e. a group without
+      child groups, among all the groups below the FIELD group.
+    */
+    std::size_t maxGroupSize() const;
+
+    bool operator==(const GroupTopology& other) const;
+    bool operator!=(const GroupTopology& other) const;
+private:
+    std::size_t checkedGroup(std::size_t group_index) const;
+    std::size_t checkedWell(std::size_t well_index) const;
+
+    std::vector<std::string> group_names;
+    std::unordered_map<std::string, std::size_t> group_index;
+    std::vector<std::size_t> group_parent;
+    std::vector<std::size_t> group_level;
+    std::vector<double> group_efac;
+    std::vector<std::size_t> child_group_offset;
+    std::vector<std::size_t> child_groups;
+    std::vector<std::size_t> child_well_offset;
+    std::vector<std::size_t> child_wells;
+
+    std::vector<std::string> well_names;
+    std::unordered_map<std::string, std::size_t> well_index;
+    std::vector<std::size_t> well_group;
+    std::vector<double> well_efac;
+    std::vector<double> well_cumulative_efac;
+
+    std::size_t root_index = npos;
+};
+
+}
+
+#endif
@@ -0,0 +1,134 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NAME_PATTERN_HPP
+#define NAME_PATTERN_HPP
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+/*
+  The NamePattern class is a precompiled version of the shell wildcard
+  patterns used to select wells and groups in the SCHEDULE section. The
+  matching semantics are those of fnmatch(), but the common cases of a plain
+  name, the pattern '*', a prefix pattern like 'PROD*' and a suffix pattern
+  like '*_A' are recognized when the pattern is created, and matched without
+  calling fnmatch().
+*/
+
+class NamePattern {
+public:
+    explicit NamePattern(const std::string& pattern);
+
+    bool match(const std::string& name) const;
+    const std::string& pattern() const;
+
+    /*
+      All names matching the pattern start with this prefix, i.e. the part of
+      the pattern in front of the first wildcard character.
+    */
+    const std::string& prefix() const;
+    bool literal() const;
+    bool all() const;
+
+private:
+    enum class Type {
+        LITERAL,
+        ALL,
+        PREFIX,
+        SUFFIX,
+        GENERAL
+    };
+
+    std::string m_pattern;
+    std::string m_prefix;
+    std::string m_suffix;
+    Type m_type;
+};
+
+
+/*
+  The NameIndex class holds a list of names in insertion order, with an
+  additional sorted index so that the names matching a NamePattern can be
+  found without testing all the names; for a prefix pattern the cost is
+  logarithmic in the total number of names and linear in the number of
+  matches.
+*/
+
+class NameIndex {
+public:
+    void add(const std::string& name);
+    std::size_t size() const;
+
+    /*
+      Returns the insertion index of all the names matching the pattern, in
+      insertion order.
+    */
+    std::vector<std::size_t> match(const NamePattern& pattern) const;
+
+private:
+    std::map<std::string, std::size_t> sorted_names;
+};
+
+
+/*
+  The NameIndexCache class holds the names present at each report step
+  together with a NameIndex of them. The entry for a step is created the
+  first time the step is queried, and neighbouring steps with the same list
+  of names share one entry. The owner must call clear() whenever the names
+  present at a report step change.
+
+  The cache can be queried concurrently; a copy of a cache starts out
+  empty.
+*/
+
+class NameIndexCache {
+public:
+    struct Entry {
+        std::vector<std::string> names;
+        NameIndex index;
+    };
+
+    NameIndexCache() = default;
+    NameIndexCache(const NameIndexCache& other);
+    NameIndexCache& operator=(const NameIndexCache& other);
+
+    /*
+      Returns the entry for the report step; if the step is not in the cache
+      the names present at the step are obtained by calling make_names().
+    */
+    std::shared_ptr<const Entry> get(std::size_t report_step,
+                                     const std::function<std::vector<std::string>()>& make_names) const;
+    void clear();
+
+private:
+    mutable std::mutex entries_mutex;
+    mutable std::map<std::size_t, std::shared_ptr<const Entry>> entries;
+};
+
+}
+
+#endif
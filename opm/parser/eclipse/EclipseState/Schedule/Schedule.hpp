@@ -30,6 +30,8 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/Events.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Group/Group2.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Group/GTNode.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Group/GroupTopology.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/NamePattern.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/ScheduleEnums.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Tuning.hpp>
@@ -173,6 +175,15 @@ namespace Opm
         std::vector<Well2> getWells2(size_t timeStep) const;
         std::vector<Well2> getWells2atEnd() const;
 
+        /*
+          The Well2 instances shared by all report steps where the well is
+          unchanged, in the same order as getWells2(). An instance is only
+          replaced when the well is updated, so the pointers can be compared
+          between report steps to detect which wells have changed without
+          copying them.
+        */
+        std::vector<std::shared_ptr<const Well2>> getSharedWells2(size_t timeStep) const;
+
         std::vector<const Group2*> getChildGroups2(const std::string& group_name, size_t timeStep) const;
         std::vector<Well2> getChildWells2(const std::string& group_name, size_t timeStep, GroupWellQueryMode query_mode) const;
         const OilVaporizationProperties& getOilVaporizationProperties(size_t timestep) const;
@@ -185,6 +196,7 @@ namespace Opm
 
         GTNode groupTree(std::size_t report_step) const;
         GTNode groupTree(const std::string& root_node, std::size_t report_step) const;
+        const GroupTopology& groupTopology(std::size_t report_step) const;
         size_t numGroups() const;
         size_t numGroups(size_t timeStep) const;
         bool hasGroup(const std::string& groupName) const;
@@ -216,6 +228,9 @@ namespace Opm
         TimeMap m_timeMap;
         OrderedMap< std::string, DynamicState<std::shared_ptr<Well2>>> wells_static;
         OrderedMap< std::string, DynamicState<std::shared_ptr<Group2>>> groups;
+        NameIndexCache well_name_cache;
+        NameIndex group_name_index;
+        DynamicState<std::shared_ptr<const GroupTopology>> group_topology;
         DynamicState< OilVaporizationProperties > m_oilvaporizationproperties;
         Events m_events;
         DynamicVector< Deck > m_modifierDeck;
@@ -236,6 +251,8 @@ namespace Opm
 
         GTNode groupTree(const std::string& root_node, std::size_t report_step, const GTNode * parent) const;
         void updateGroup(std::shared_ptr<Group2> group, size_t reportStep);
+        bool groupTopologyChanged(std::size_t report_step) const;
+        void updateGroupTopology(std::size_t start_step);
         bool updateWellStatus( const std::string& well, size_t reportStep , WellCommon::StatusEnum status);
         void addWellToGroup( const std::string& group_name, const std::string& well_name , size_t timeStep);
         void iterateScheduleSection(const ParseContext& parseContext ,  ErrorGuard& errors, const SCHEDULESection& , const EclipseGrid& grid,
@@ -31,7 +31,7 @@
 
 namespace Opm {
 
-class UDQASTNode;
+class UDQProgram;
 class ParseContext;
 class ErrorGuard;
 
@@ -59,10 +59,11 @@ public:
     const std::string& keyword() const;
     const std::string& input_string() const;
     UDQVarType  var_type() const;
+    const std::vector<std::string>& input_variables() const;
 private:
     const UDQParams& udq_params;  // Beacuse of the shared RNG stream this must be a reference.
     std::string m_keyword;
-    std::shared_ptr<UDQASTNode> ast;
+    std::shared_ptr<const UDQProgram> program;
     UDQVarType m_var_type;
     std::string string_data;
 };
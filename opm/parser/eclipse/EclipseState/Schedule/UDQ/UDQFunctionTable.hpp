@@ -20,6 +20,7 @@
 #ifndef UDQFUNCTIONTABLE_HPP
 #define UDQFUNCTIONTABLE_HPP
 
+#include <cstddef>
 #include <unordered_map>
 #include <memory>
 
@@ -34,8 +35,16 @@ public:
     UDQFunctionTable();
     bool has_function(const std::string& name) const;
     const UDQFunction& get(const std::string& name) const;
+
+    /*
+      Identifies the function objects of the table; copies of a table share
+      the function objects and the id, whereas every constructed table gets
+      a new id.
+    */
+    std::size_t id() const;
 private:
     void insert_function(std::shared_ptr<const UDQFunction> func);
+    std::size_t table_id;
     UDQParams params;
     std::unordered_map<std::string, std::shared_ptr<const UDQFunction>> function_table;
 };
@@ -35,6 +35,7 @@
 
 namespace Opm {
 
+    class DeckKeyword;
     class DeckRecord;
     class Deck;
 
@@ -44,7 +45,12 @@ namespace Opm {
         const std::string& unit(const std::string& key) const;
         bool has_unit(const std::string& keyword) const;
         bool has_keyword(const std::string& keyword) const;
-        void add_record(const DeckRecord& record);
+
+        /*
+          Adds all the records of a UDQ keyword and then updates the
+          evaluation order, which is computed once per keyword.
+        */
+        void add_keyword(const DeckKeyword& keyword);
         void assign_unit(const std::string& keyword, const std::string& unit);
 
         std::vector<UDQDefine> definitions() const;
@@ -78,11 +84,38 @@ namespace Opm {
         */
         std::vector<std::pair<size_t, UDQDefine>> input_definitions() const;
 
+        /*
+          The definitions() functions return the DEFINE keywords in input
+          order. When a definition uses the value of another UDQ variable it
+          should be evaluated after that variable has been updated; the
+          eval_order() functions return the definitions sorted topologically
+          on these dependencies, with ties broken by the input order:
+
+          UDQ
+            DEFINE WUX WUY * 2 /
+            DEFINE WUY WOPR + 1 /
+          /
+
+          Here eval_order() will return {WUY, WUX}. A definition which refers
+          to itself, like DEFINE FUCNT FUCNT + 1, uses the value from the
+          previous evaluation and does not create a dependency. Definitions
+          which are part of a longer dependency cycle can not be ordered; they
+          are listed by cyclic_definitions() in input order. When no other
+          definition can be evaluated the first of them not yet evaluated goes
+          next, using previously calculated values.
+        */
+        std::vector<UDQDefine> eval_order() const;
+        std::vector<UDQDefine> eval_order(UDQVarType var_type) const;
+        const std::vector<std::string>& cyclic_definitions() const;
+
         std::vector<UDQAssign> assignments() const;
         std::vector<UDQAssign> assignments(UDQVarType var_type) const;
         const UDQParams& params() const;
         const UDQFunctionTable& function_table() const;
     private:
+        void add_record(const DeckRecord& record);
+        void update_eval_order();
+
         UDQParams udq_params;
         UDQFunctionTable udqft;
 
@@ -101,6 +134,9 @@ namespace Opm {
         std::unordered_map<std::string, std::string> units;
 
         OrderedMap<std::string, std::pair<size_t, UDQAction>> input_index;
+
+        std::vector<std::string> m_eval_order;
+        std::vector<std::string> m_cyclic_definitions;
     };
 }
 
@@ -20,6 +20,7 @@
 #ifndef UDQSET_HPP
 #define UDQSET_HPP
 
+#include <memory>
 #include <stdexcept>
 #include <vector>
 #include <string>
@@ -90,11 +91,18 @@ public:
 private:
     UDQSet() = default;
     UDQSet(const std::string& name, UDQVarType var_type, std::size_t size);
+    static std::shared_ptr<const std::unordered_map<std::string, std::size_t>> make_index(const std::vector<std::string>& wgnames);
+    std::size_t index(const std::string& wgname) const;
 
 
     std::string m_name;
     UDQVarType m_var_type;
-    std::unordered_map<std::string, std::size_t> wgname_index;
+    /*
+      The well/group name index is shared between a set and all the sets
+      which are copied from it, e.g. the intermediate results when
+      evaluating a UDQ expression.
+    */
+    std::shared_ptr<const std::unordered_map<std::string, std::size_t>> wgname_index;
     std::vector<UDQScalar> values;
 };
 
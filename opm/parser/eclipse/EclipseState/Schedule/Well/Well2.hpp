@@ -163,6 +163,13 @@ public:
     ProductionControls productionControls(const SummaryState& st) const;
     InjectionControls injectionControls(const SummaryState& st) const;
 
+    /*
+      Whether any of the rates or limits of the active production or
+      injection controls is given as a UDA, i.e. whether the result of
+      productionControls() / injectionControls() depends on the SummaryState.
+    */
+    bool hasUDAControls() const;
+
     int vfp_table_number() const;
     double alq_value() const;
     double temperature() const;
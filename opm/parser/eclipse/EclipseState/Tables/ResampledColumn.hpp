@@ -0,0 +1,93 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef OPM_PARSER_RESAMPLED_COLUMN_HPP
+#define OPM_PARSER_RESAMPLED_COLUMN_HPP
+
+#include <opm/common/utility/numeric/UniformTableLinear.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace Opm {
+
+    class SimpleTable;
+
+    /*
+      Copy of one column of a SimpleTable, as a function of the first
+      column of the table, resampled on a uniform grid.  Evaluation is
+      a constant time, branch free, linear interpolation in the
+      resampled values with the same constant extrapolation as
+      SimpleTable::evaluate().
+
+      The table is piecewise linear in the rows of the original table
+      and the resampled copy is piecewise linear in the uniform grid,
+      so the largest difference between the two is found at one of
+      the original rows.  The number of samples is doubled until that
+      difference is at most the requested tolerance or the number of
+      samples would exceed the given maximum.  The final difference is
+      available from error().
+
+      Works for any SimpleTable with an ordered first column, e.g.,
+      the SWOF, SGOF and PVDG tables of the TableManager or the
+      saturated table of a PVTO or PVTG table.
+    */
+    class ResampledColumn {
+    public:
+        struct ErrorReport {
+            /// Largest absolute difference from the original table.
+            double maxError;
+
+            /// Argument (first column value) of the largest difference.
+            double maxErrorArgument;
+
+            /// Number of uniform samples.
+            std::size_t numSamples;
+
+            /// Whether maxError is within the requested tolerance.
+            bool withinTolerance;
+        };
+
+        /*
+          Throws std::invalid_argument if the table has fewer than two
+          rows, if the first column can not be used for lookup or if
+          the first column does not span a proper interval.
+        */
+        ResampledColumn(const SimpleTable& table,
+                        const std::string& columnName,
+                        double tolerance,
+                        std::size_t maxSamples = 10000);
+
+        double evaluate(double x) const {
+            return m_table(x);
+        }
+
+        double operator()(double x) const {
+            return m_table(x);
+        }
+
+        const ErrorReport& error() const;
+
+    private:
+        UniformTableLinear<double> m_table;
+        ErrorReport m_error;
+    };
+}
+
+#endif
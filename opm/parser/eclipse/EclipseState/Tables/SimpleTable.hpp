@@ -60,6 +60,16 @@ namespace Opm {
          */
         double evaluate(const std::string& columnName, double xPos) const;
 
+        /*!
+         * \brief Evaluate a column of the table at a sequence of positions.
+         *
+         * Equivalent to calling evaluate(columnName, x) for each x, but
+         * looks up the first column only once per position and starts each
+         * search at the interval of the previous position.  Fastest for
+         * sorted, or slowly varying, positions.
+         */
+        std::vector<double> evaluate(const std::string& columnName, const std::vector<double>& xPos) const;
+
         /// throws std::invalid_argument if jf != m_jfunc
         void assertJFuncPressure(const bool jf) const;
 
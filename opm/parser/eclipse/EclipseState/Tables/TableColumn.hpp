@@ -21,6 +21,8 @@
 #ifndef OPM_TABLE_COLUMN_HPP
 #define OPM_TABLE_COLUMN_HPP
 
+#include <cstddef>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -52,7 +54,23 @@ namespace Opm {
            is out of range.
         */
         TableIndex lookup(double argValue) const;
+
+        /*
+           As lookup(argValue), but checks the interval @hint and the
+           one following it before searching the whole column. Pass the
+           getIndex1() of a previous lookup when the arguments change
+           slowly, e.g. when evaluating cells sorted by depth.
+        */
+        TableIndex lookup(double argValue, size_t hint) const;
+
+        /*
+           Lookup of a sequence of arguments; each lookup uses the
+           result of the previous one as hint.
+        */
+        std::vector<TableIndex> lookup(const std::vector<double>& argValues) const;
+
         double eval( const TableIndex& index) const;
+        std::vector<double> eval( const std::vector<TableIndex>& indices) const;
         void applyDefaults( const TableColumn& argColumn );
         void assertUnitRange() const;
         TableColumn& operator= (const TableColumn& other);
@@ -64,12 +82,29 @@ namespace Opm {
         void assertUpdate(size_t index, double value) const;
         void assertPrevious(size_t index , double value) const;
         void assertNext(size_t index , double value) const;
+        void assertLookup() const;
+        bool isDefault(size_t index) const;
+        TableIndex lookupAssumeValid(double argValue, size_t hint) const;
+        void updateExtrema(size_t index);
 
         ColumnSchema m_schema;
-        std::string m_name;
         std::vector<double> m_values;
+
+        /*
+          Default flags of m_values; empty if no value is defaulted.
+        */
         std::vector<bool> m_default;
         size_t m_defaultCount;
+
+        /*
+          Position of the smallest and largest non-defaulted value, or
+          npos if there are no such values.  Kept up to date by
+          addValue() and updateValue() so min(), max() and lookup() need
+          not scan the column.
+        */
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+        size_t m_minIndex = npos;
+        size_t m_maxIndex = npos;
     };
 
 
@@ -21,6 +21,8 @@
 #ifndef OPM_TABLE_MANAGER_HPP
 #define OPM_TABLE_MANAGER_HPP
 
+#include <functional>
+#include <memory>
 #include <set>
 
 #include <opm/common/OpmLog/OpmLog.hpp>
@@ -35,6 +37,7 @@
 #include <opm/parser/eclipse/EclipseState/Tables/PvtoTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/Rock2dTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/Rock2dtrTable.hpp>
+#include <opm/parser/eclipse/EclipseState/Tables/ResampledColumn.hpp>
 
 #include <opm/parser/eclipse/EclipseState/Tables/FlatTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/SorwmisTable.hpp>
@@ -64,6 +67,16 @@ namespace Opm {
         const TableContainer& operator[](const std::string& tableName) const;
         bool hasTables( const std::string& tableName ) const;
 
+        /*
+          Column @columnName of table @tableNumber in the collection
+          @tableName resampled on a uniform grid with maximum error
+          @tolerance, for constant time evaluation.  See ResampledColumn.
+        */
+        ResampledColumn getResampledColumn( const std::string& tableName,
+                                            size_t tableNumber,
+                                            const std::string& columnName,
+                                            double tolerance ) const;
+
         const Tabdims& getTabdims() const;
         const Eqldims& getEqldims() const;
         const Aqudims& getAqudims() const;
@@ -155,6 +168,15 @@ namespace Opm {
 
         void complainAboutAmbiguousKeyword(const Deck& deck, const std::string& keywordName);
 
+        /*
+          Calls buildTable(tableIdx) for tableIdx = 0 ... numTables - 1,
+          in parallel when there are many tables. buildTable() must
+          only write to its own table slot. If several tables fail the
+          exception of the lowest table index is rethrown, i.e. the same
+          error as a sequential build would give.
+        */
+        static void buildTables(size_t numTables, const std::function<void(size_t)>& buildTable);
+
         void addTables( const std::string& tableName , size_t numTables);
         void initSimpleTables(const Deck& deck);
         void initRTempTables(const Deck& deck);
@@ -227,12 +249,16 @@ namespace Opm {
             }
 
             const auto& tableKeyword = deck.getKeyword(keywordName);
-            for (size_t tableIdx = 0; tableIdx < tableKeyword.size(); ++tableIdx) {
+            std::vector<std::shared_ptr<TableType>> tables( tableKeyword.size() );
+            buildTables( tables.size() , [&](size_t tableIdx) {
                 const auto& dataItem = tableKeyword.getRecord( tableIdx ).getItem( 0 );
-                if (dataItem.size() > 0) {
-                    std::shared_ptr<TableType> table = std::make_shared<TableType>( dataItem, useJFunc() );
-                    container.addTable( tableIdx , table );
-                }
+                if (dataItem.size() > 0)
+                    tables[tableIdx] = std::make_shared<TableType>( dataItem, useJFunc() );
+            });
+
+            for (size_t tableIdx = 0; tableIdx < tables.size(); ++tableIdx) {
+                if (tables[tableIdx])
+                    container.addTable( tableIdx , tables[tableIdx] );
             }
         }
 
@@ -254,12 +280,16 @@ namespace Opm {
             }
 
             const auto& tableKeyword = deck.getKeyword(keywordName);
-            for (size_t tableIdx = 0; tableIdx < tableKeyword.size(); ++tableIdx) {
+            std::vector<std::shared_ptr<TableType>> tables( tableKeyword.size() );
+            buildTables( tables.size() , [&](size_t tableIdx) {
                 const auto& dataItem = tableKeyword.getRecord( tableIdx ).getItem( 0 );
-                if (dataItem.size() > 0) {
-                    std::shared_ptr<TableType> table = std::make_shared<TableType>( dataItem );
-                    container.addTable( tableIdx , table );
-                }
+                if (dataItem.size() > 0)
+                    tables[tableIdx] = std::make_shared<TableType>( dataItem );
+            });
+
+            for (size_t tableIdx = 0; tableIdx < tables.size(); ++tableIdx) {
+                if (tables[tableIdx])
+                    container.addTable( tableIdx , tables[tableIdx] );
             }
         }
 
@@ -327,9 +357,13 @@ namespace Opm {
 
             const auto& tableKeyword = deck.getKeyword(keywordName);
 
-            int numTables = TableType::numTables( tableKeyword );
-            for (int tableIdx = 0; tableIdx < numTables; ++tableIdx)
-                tableVector.emplace_back( tableKeyword , tableIdx );
+            std::vector<std::unique_ptr<TableType>> tables( TableType::numTables( tableKeyword ));
+            buildTables( tables.size() , [&](size_t tableIdx) {
+                tables[tableIdx].reset( new TableType( tableKeyword , tableIdx ));
+            });
+
+            for (auto& table : tables)
+                tableVector.push_back( std::move( *table ));
         }
 
         std::map<std::string , TableContainer> m_simpleTables;
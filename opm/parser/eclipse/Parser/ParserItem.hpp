@@ -19,6 +19,7 @@
 #ifndef PARSER_ITEM_H
 #define PARSER_ITEM_H
 
+#include <cstddef>
 #include <iosfwd>
 #include <string>
 #include <vector>
@@ -76,6 +77,8 @@ namespace Opm {
 
         void push_backDimension( const std::string& );
         const std::string& getDimension(size_t index) const;
+        /* UnitSystem::dimensionHandle() of getDimension( index ). */
+        std::size_t getDimensionHandle(size_t index) const;
         bool hasDimension() const;
         size_t numDimensions() const;
         const std::string& name() const;
@@ -111,6 +114,7 @@ namespace Opm {
         std::string sval;
         UDAValue uval;
         std::vector< std::string > dimensions;
+        std::vector< std::size_t > dimension_handles;
 
         std::string m_name;
         item_size m_sizeType = item_size::SINGLE;
@@ -30,6 +30,7 @@ namespace Opm {
         Dimension(const std::string& name, double SIfactor, double SIoffset = 0.0);
 
         double getSIScaling() const;
+        double getSIScalingRaw() const;
         double getSIOffset() const;
 
         double convertRawToSi(double rawValue) const;
@@ -20,10 +20,12 @@
 #ifndef UNITSYSTEM_H
 #define UNITSYSTEM_H
 
+#include <cstddef>
 #include <string>
 #include <map>
 #include <vector>
 #include <memory>
+#include <utility>
 
 #include <ert/ecl/ecl_util.h>
 
@@ -71,7 +73,10 @@ namespace Opm {
             oil_inverse_formation_volume_factor,
             water_inverse_formation_volume_factor,
             liquid_productivity_index,
-            gas_productivity_index
+            gas_productivity_index,
+
+            // Number of measures above; not a measure itself.
+            num_measures
         };
 
         explicit UnitSystem(UnitType unit = UnitType::UNIT_TYPE_METRIC);
@@ -82,9 +87,33 @@ namespace Opm {
         UnitType getType() const;
         ert_ecl_unit_enum getEclType( ) const;
 
+        /*
+          Factors and offset converting one measure between SI and this
+          unit system: si = to_si_factor*value + offset and value =
+          from_si_factor*(si - offset).
+        */
+        struct MeasureConversion {
+            double to_si_factor;
+            double from_si_factor;
+            double offset;
+        };
+
+        /*
+          Dimension strings are interned; dimensionHandle() returns the
+          same small integer for equal strings and may be called from any
+          thread.  getNewDimension(handle) is equivalent to
+          getNewDimension() with the string of the handle, but the result
+          is cached by handle so repeated calls are a vector lookup.  Like
+          the string version it returns a reference to the stored
+          dimension, which stays valid as more dimensions are added.
+        */
+        using DimensionHandle = std::size_t;
+        static DimensionHandle dimensionHandle(const std::string& dimension);
+
         void addDimension(const std::string& dimension, double SIfactor, double SIoffset = 0.0);
         void addDimension( Dimension );
         const Dimension& getNewDimension(const std::string& dimension);
+        const Dimension& getNewDimension(DimensionHandle handle);
         const Dimension& getDimension(const std::string& dimension) const;
         bool hasDimension(const std::string& dimension) const;
         bool equal(const UnitSystem& other) const;
@@ -98,6 +127,16 @@ namespace Opm {
         double to_si( measure, double ) const;
         void from_si( measure, std::vector<double>& ) const;
         void to_si( measure, std::vector<double>& ) const;
+
+        /*
+          Convert data[0 .. size) into out[0 .. size), which may be the same
+          array, in a single pass.  The float overload converts and narrows
+          SI values for single precision output without an intermediate
+          double precision copy.
+        */
+        void from_si( measure, const double* data, double* out, std::size_t size ) const;
+        void from_si( measure, const double* data, float* out, std::size_t size ) const;
+        void to_si( measure, const double* data, double* out, std::size_t size ) const;
         const char* name( measure ) const;
         std::string deck_name() const;
 
@@ -119,11 +158,39 @@ namespace Opm {
         std::string m_name;
         UnitType m_unittype;
         std::map< std::string , Dimension > m_dimensions;
-        const double* measure_table_to_si_offset;
-        const double* measure_table_from_si;
-        const double* measure_table_to_si;
+
+        /*
+          The elements of m_dimensions by handle, or nullptr where the
+          handle has not been looked up.  The map elements never move, so
+          the pointers stay valid when the cache grows and dimensions are
+          added; a copied UnitSystem starts with an empty cache since the
+          pointers refer to the map of the original.
+        */
+        struct DimensionCache {
+            DimensionCache() = default;
+            DimensionCache( const DimensionCache& ) {}
+            DimensionCache& operator=( const DimensionCache& ) {
+                this->dimensions.clear();
+                return *this;
+            }
+
+            std::vector< const Dimension* > dimensions;
+        };
+
+        DimensionCache m_handle_dimensions;
+        const MeasureConversion* m_conversions;
         const char* const*  unit_name_table;
     };
+
+    inline double UnitSystem::from_si( measure m, double val ) const {
+        const auto& conversion = this->m_conversions[ static_cast< int >( m ) ];
+        return conversion.from_si_factor * (val - conversion.offset);
+    }
+
+    inline double UnitSystem::to_si( measure m, double val ) const {
+        const auto& conversion = this->m_conversions[ static_cast< int >( m ) ];
+        return conversion.to_si_factor*val + conversion.offset;
+    }
 }
 
 
@@ -33,13 +33,14 @@
 #include "config.h"
 #include <opm/common/utility/numeric/MonotCubicInterpolator.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
-#include <map>
 #include <cmath>
 
 using namespace std;
@@ -50,34 +51,21 @@ using namespace std;
 
   Internal data structure of points and values:
 
-  vector(s):
-   - Easier coding
-   - Faster vector operations when setting up derivatives.
-   - sorting slightly more complex.
-   - insertion of further values bad.
-
-  vector<double,double>
-   - easy sorting
-   - code complexity almost as for map.
-   - insertion of additional values bad
-
-  vector over struct datapoint { x, f, d}
-   - nice code
-   - not as sortable, insertion is cumbersome.
-
-   ** This is used currently: **
   map<double, double> one for (x,f) and one for (x,d)
    - Naturally sorted on x-values (done by the map-construction)
-   - Slower to set up, awkward loop coding (?)
    - easy to add more points.
-   - easier to just add code to linear interpolation code
-   - x-data is duplicated, but that memory waste is
-     unlikely to represent a serious issue.
+   - every evaluation is a tree search with pointer chasing, and
+     the derivative lookups are further tree searches.
 
-  map<double, <double, double> >
-   - naturally couples x-value, f-value and d-value
-   - even more unreadable(??) code?
-   - higher skills needed by programmer.
+   ** This is used currently: **
+  vectors xdata, fdata and ddata, sorted on x
+   - contiguous, cache friendly binary search.
+   - sorted batches of x-values are evaluated by walking the
+     intervals, no search needed.
+   - insertion of further values is linear in the number of data
+     points, but this is done when setting up the function only.
+   - the polynomial coefficients of each interval are precomputed
+     (coeffs), so evaluation is a search followed by a Horner scheme.
 
 
   MONOTONE CUBIC INTERPOLATION:
@@ -103,11 +91,13 @@ MonotCubicInterpolator(const vector<double> & x, const vector<double> & f) {
     throw("Unable to constuct MonotCubicInterpolator from vectors.") ;
   }
 
-  // Add the contents of the input vectors to our map of values.
-  vector<double>::const_iterator posx, posf;
-  for (posx = x.begin(), posf = f.begin(); posx != x.end(); ++posx, ++posf) {
-    data[*posx] = *posf ;
+  // Add the contents of the input vectors to our table of values.
+  vector<pair<double,double> > xf;
+  xf.reserve(x.size());
+  for (vector<double>::size_type i = 0; i < x.size(); ++i) {
+    xf.push_back(make_pair(x[i], f[i]));
   }
+  sortData(xf);
 
   computeInternalFunctionData();
 }
@@ -118,14 +108,17 @@ bool
 MonotCubicInterpolator::
 read(const std::string & datafilename, int xColumn, int fColumn)
 {
-  data.clear() ;
+  xdata.clear() ;
+  fdata.clear() ;
   ddata.clear() ;
+  coeffs.clear() ;
 
   ifstream datafile_fs(datafilename.c_str());
   if (!datafile_fs) {
     return false ;
   }
 
+  vector<pair<double,double> > xf;
   string linestring;
   while (!datafile_fs.eof()) {
     getline(datafile_fs, linestring);
@@ -150,27 +143,86 @@ read(const std::string & datafilename, int xColumn, int fColumn)
         }
     }
     if (columnindex >= (max(xColumn, fColumn))) {
-      data[value[xColumn-1]] =  value[fColumn-1] ;
+      xf.push_back(make_pair(value[xColumn-1], value[fColumn-1]));
     }
   }
   datafile_fs.close();
 
-  if (data.size() == 0) {
+  if (xf.size() == 0) {
     return false ;
   }
 
+  sortData(xf);
+
   computeInternalFunctionData();
   return true ;
 }
 
 
+void
+MonotCubicInterpolator::
+sortData(vector<pair<double,double> >& xf) {
+  // Stable sort on x only, so that the last of several pairs with the
+  // same x-value overwrites the others as when inserting one by one.
+  stable_sort(xf.begin(), xf.end(),
+              [](const pair<double,double>& a, const pair<double,double>& b)
+              { return a.first < b.first; });
+
+  xdata.clear();
+  fdata.clear();
+  xdata.reserve(xf.size());
+  fdata.reserve(xf.size());
+  for (const auto& p : xf) {
+    if (!xdata.empty() && xdata.back() == p.first) {
+      fdata.back() = p.second;
+    }
+    else {
+      xdata.push_back(p.first);
+      fdata.push_back(p.second);
+    }
+  }
+}
+
+
+void
+MonotCubicInterpolator::
+setPair(double x, double f) {
+  vector<double>::iterator pos = lower_bound(xdata.begin(), xdata.end(), x);
+  const vector<double>::difference_type i = pos - xdata.begin();
+
+  if (pos != xdata.end() && *pos == x) {
+    fdata[i] = f;
+  }
+  else {
+    xdata.insert(pos, x);
+    fdata.insert(fdata.begin() + i, f);
+  }
+}
+
+
+void
+MonotCubicInterpolator::
+eraseData(const vector<bool>& keep) {
+  vector<double>::size_type n = 0;
+  for (vector<double>::size_type i = 0; i < xdata.size(); ++i) {
+    if (keep[i]) {
+      xdata[n] = xdata[i];
+      fdata[n] = fdata[i];
+      ++n;
+    }
+  }
+  xdata.resize(n);
+  fdata.resize(n);
+}
+
+
 void
 MonotCubicInterpolator::
 addPair(double newx, double newf) {
   if (std::isnan(newx) || std::isinf(newx) || std::isnan(newf) || std::isinf(newf)) {
     throw("MonotCubicInterpolator: addPair() received inf/nan input.");
   }
-  data[newx] = newf ;
+  setPair(newx, newf);
 
   // In a critical application, we should only update the
   // internal function data for the offended interval,
@@ -179,6 +231,32 @@ addPair(double newx, double newf) {
 }
 
 
+double
+MonotCubicInterpolator::
+evaluateAt(double x, std::size_t i) const {
+
+  // First check if we must extrapolate:
+  if (i == 0) {
+      // Constant extrapolation (!!), or just on the interval limit
+      return fdata.front();
+  }
+  if (i == xdata.size()) {
+      // Constant extrapolation (!!)
+      return fdata.back();
+  }
+
+  // Exactly on a data point:
+  if (xdata[i] == x) {
+      return fdata[i];
+  }
+
+  // Ok, we have xdata[i-1] < x < xdata[i]
+  const Cubic& c = coeffs[i - 1];
+  const double s = x - xdata[i - 1];
+  return c.c0 + s*(c.c1 + s*(c.c2 + s*c.c3));
+}
+
+
 double
 MonotCubicInterpolator::
 evaluate(double x) const {
@@ -187,49 +265,52 @@ evaluate(double x) const {
     throw("MonotCubicInterpolator: evaluate() received inf/nan input.");
   }
 
-  // xf becomes the first (xdata,fdata) pair where xdata >= x
-  map<double,double>::const_iterator xf_iterator = data.lower_bound(x);
+  // i becomes the index of the first xdata >= x
+  const std::size_t i =
+      lower_bound(xdata.begin(), xdata.end(), x) - xdata.begin();
 
-  // First check if we must extrapolate:
-  if (xf_iterator == data.begin()) {
-    if (data.begin()->first == x) { // Just on the interval limit
-      return data.begin()->second;
-    }
-    else {
-      // Constant extrapolation (!!)
-      return data.begin()->second;
-    }
-  }
-  if (xf_iterator == data.end()) {
-      // Constant extrapolation (!!)
-      return data.rbegin()->second;
-  }
+  return evaluateAt(x, i);
+}
 
 
-  // Ok, we have x_min < x < x_max
+void
+MonotCubicInterpolator::
+evaluate(const double* x, double* out, std::size_t n) const {
 
-  pair<double,double> xf2 = *xf_iterator;
-  pair<double,double> xf1 = *(--xf_iterator);
-  // we now have: xf2.first > x
+  const std::size_t size = xdata.size();
 
-  // Linear interpolation if derivative data is not available:
-  if (ddata.size() != data.size()) {
-    double finterp =  xf1.second +
-      (xf2.second - xf1.second) / (xf2.first - xf1.first)
-      * (x - xf1.first);
-    return finterp;
-  }
-  else { // Do Cubic Hermite spline
-    double t = (x - xf1.first)/(xf2.first - xf1.first); // t \in [0,1]
-    double h = xf2.first - xf1.first;
-    double finterp
-      = xf1.second       * H00(t)
-      + ddata[xf1.first] * H10(t) * h
-      + xf2.second       * H01(t)
-      + ddata[xf2.first] * H11(t) * h ;
-    return finterp;
+  // Index of the first xdata >= x[k], continued from x[k-1] as long
+  // as the input is non-decreasing.
+  std::size_t i = 0;
+  double prev = -HUGE_VAL;
+
+  for (std::size_t k = 0; k < n; ++k) {
+    const double xk = x[k];
+    if (std::isnan(xk) || std::isinf(xk)) {
+      throw("MonotCubicInterpolator: evaluate() received inf/nan input.");
+    }
+
+    if (xk < prev) {
+      i = lower_bound(xdata.begin(), xdata.begin() + i, xk) - xdata.begin();
+    }
+    else {
+      while (i < size && xdata[i] < xk) {
+        ++i;
+      }
+    }
+    prev = xk;
+
+    out[k] = evaluateAt(xk, i);
   }
+}
+
 
+vector<double>
+MonotCubicInterpolator::
+evaluate(const vector<double>& x) const {
+  vector<double> out(x.size());
+  evaluate(x.data(), out.data(), x.size());
+  return out;
 }
 
 
@@ -245,14 +326,7 @@ vector<double>
 MonotCubicInterpolator::
 get_xVector() const
 {
-  map<double,double>::const_iterator xf_iterator = data.begin();
-
-  vector<double> outputvector;
-  outputvector.reserve(data.size());
-  for (xf_iterator = data.begin(); xf_iterator != data.end(); ++xf_iterator) {
-    outputvector.push_back(xf_iterator->first);
-  }
-  return outputvector;
+  return xdata;
 }
 
 
@@ -260,15 +334,7 @@ vector<double>
 MonotCubicInterpolator::
 get_fVector() const
 {
-
-  map<double,double>::const_iterator xf_iterator = data.begin();
-
-  vector<double> outputvector;
-  outputvector.reserve(data.size());
-  for (xf_iterator = data.begin(); xf_iterator != data.end(); ++xf_iterator) {
-    outputvector.push_back(xf_iterator->second);
-  }
-  return outputvector;
+  return fdata;
 }
 
 
@@ -279,19 +345,17 @@ toString() const
 {
   const int precision = 20;
   std::stringstream dataStringStream;
-  for (map<double,double>::const_iterator it = data.begin();
-       it != data.end(); ++it) {
-      dataStringStream << setprecision(precision) << it->first;
+  for (vector<double>::size_type i = 0; i < xdata.size(); ++i) {
+    dataStringStream << setprecision(precision) << xdata[i];
     dataStringStream << '\t';
-    dataStringStream << setprecision(precision) << it->second;
+    dataStringStream << setprecision(precision) << fdata[i];
     dataStringStream << '\n';
   }
   dataStringStream << "Derivative values:" << endl;
-  for (map<double,double>::const_iterator it = ddata.begin();
-       it != ddata.end(); ++it) {
-    dataStringStream << setprecision(precision) << it->first;
+  for (vector<double>::size_type i = 0; i < ddata.size(); ++i) {
+    dataStringStream << setprecision(precision) << xdata[i];
     dataStringStream << '\t';
-    dataStringStream << setprecision(precision) << it->second;
+    dataStringStream << setprecision(precision) << ddata[i];
     dataStringStream << '\n';
   }
 
@@ -304,30 +368,24 @@ pair<double,double>
 MonotCubicInterpolator::
 getMissingX() const
 {
-  if( data.size() < 2) {
+  if( xdata.size() < 2) {
     throw("MonotCubicInterpolator::getMissingX() only one datapoint.");
   }
 
   // Search for biggest difference value in function-datavalues:
 
-  map<double,double>::const_iterator  maxfDiffPair_iterator = data.begin();;
+  vector<double>::size_type maxfDiffIndex = 0;
   double maxfDiffValue = 0;
 
-  map<double,double>::const_iterator xf_iterator;
-  map<double,double>::const_iterator xf_next_iterator;
-
-  for (xf_iterator = data.begin(), xf_next_iterator = ++(data.begin());
-       xf_next_iterator != data.end();
-       ++xf_iterator, ++xf_next_iterator) {
-    double absfDiff = fabs((double)(*xf_next_iterator).second
-                           - (double)(*xf_iterator).second);
+  for (vector<double>::size_type i = 0; i + 1 < xdata.size(); ++i) {
+    double absfDiff = fabs(fdata[i + 1] - fdata[i]);
     if (absfDiff > maxfDiffValue) {
-      maxfDiffPair_iterator = xf_iterator;
+      maxfDiffIndex = i;
       maxfDiffValue = absfDiff;
     }
   }
 
-  double newXvalue = ((*maxfDiffPair_iterator).first + ((*(++maxfDiffPair_iterator)).first))/2;
+  double newXvalue = (xdata[maxfDiffIndex] + xdata[maxfDiffIndex + 1])/2;
   return make_pair(newXvalue, maxfDiffValue);
 
 }
@@ -337,19 +395,18 @@ getMissingX() const
 pair<double,double>
 MonotCubicInterpolator::
 getMaximumF() const {
-  if (data.size() <= 1) {
+  if (xdata.size() <= 1) {
     throw ("MonotCubicInterpolator::getMaximumF() empty data.") ;
   }
   if (strictlyIncreasing)
-    return *data.rbegin();
+    return getMaximumX();
   else if (strictlyDecreasing)
-    return *data.begin();
+    return getMinimumX();
   else {
-    pair<double,double> maxf = *data.rbegin() ;
-    map<double,double>::const_iterator xf_iterator;
-    for (xf_iterator = data.begin() ; xf_iterator != data.end(); ++xf_iterator) {
-      if (xf_iterator->second > maxf.second) {
-        maxf = *xf_iterator ;
+    pair<double,double> maxf = getMaximumX() ;
+    for (vector<double>::size_type i = 0; i < xdata.size(); ++i) {
+      if (fdata[i] > maxf.second) {
+        maxf = make_pair(xdata[i], fdata[i]) ;
       } ;
     }
     return maxf ;
@@ -360,20 +417,19 @@ getMaximumF() const {
 pair<double,double>
 MonotCubicInterpolator::
 getMinimumF() const {
-  if (data.size() <= 1) {
+  if (xdata.size() <= 1) {
     throw ("MonotCubicInterpolator::getMinimumF() empty data.") ;
   }
   if (strictlyIncreasing)
-    return *data.begin();
+    return getMinimumX();
   else if (strictlyDecreasing) {
-    return *data.rbegin();
+    return getMaximumX();
   }
   else {
-    pair<double,double> minf = *data.rbegin() ;
-    map<double,double>::const_iterator xf_iterator;
-    for (xf_iterator = data.begin() ; xf_iterator != data.end(); ++xf_iterator) {
-      if (xf_iterator->second < minf.second) {
-        minf = *xf_iterator ;
+    pair<double,double> minf = getMaximumX() ;
+    for (vector<double>::size_type i = 0; i < xdata.size(); ++i) {
+      if (fdata[i] < minf.second) {
+        minf = make_pair(xdata[i], fdata[i]) ;
       } ;
     }
     return minf ;
@@ -386,7 +442,7 @@ MonotCubicInterpolator::
 computeInternalFunctionData() const {
 
   /* The contents of this function is meaningless if there is only one datapoint */
-  if (data.size() <= 1) {
+  if (xdata.size() <= 1) {
     return;
   }
 
@@ -397,9 +453,7 @@ computeInternalFunctionData() const {
      monotoneness, and setting to false if the function is not for
      some value */
 
-  map<double,double>::const_iterator xf_iterator;
-  map<double,double>::const_iterator xf_next_iterator;
-
+  const vector<double>::size_type n = fdata.size();
 
   strictlyMonotone = true; // We assume this is true, and will set to false if not
   monotone = true;
@@ -409,56 +463,53 @@ computeInternalFunctionData() const {
   increasing = true;
 
   // Increasing or decreasing??
-  xf_iterator = data.begin();
-  xf_next_iterator = ++(data.begin());
+  vector<double>::size_type i = 0;
   /* Cater for non-strictness, search for direction for monotoneness */
-  while (xf_next_iterator != data.end() &&
-         xf_iterator->second == xf_next_iterator->second) {
+  while (i + 1 < n && fdata[i] == fdata[i + 1]) {
     /* Ok, equal values, this is not strict. */
     strictlyMonotone = false;
     strictlyIncreasing = false;
     strictlyDecreasing = false;
 
-    ++xf_iterator;
-    ++xf_next_iterator;
+    ++i;
   }
 
 
-  if (xf_next_iterator != data.end()) {
+  if (i + 1 < n) {
 
-    if ( xf_iterator->second > xf_next_iterator->second) {
+    if (fdata[i] > fdata[i + 1]) {
       // Ok, decreasing, check monotoneness:
       strictlyDecreasing = true;// if strictlyMonotone == false, this one should not be trusted anyway
       decreasing = true;
       strictlyIncreasing = false;
       increasing = false;
-      while(++xf_iterator, ++xf_next_iterator != data.end()) {
-        if ((*xf_iterator).second <  (*xf_next_iterator).second) {
+      while (++i + 1 < n) {
+        if (fdata[i] <  fdata[i + 1]) {
           monotone = false;
           strictlyMonotone = false;
           strictlyDecreasing = false; // meaningless now
           break; // out of while loop
         }
-        if ((*xf_iterator).second <= (*xf_next_iterator).second) {
+        if (fdata[i] <= fdata[i + 1]) {
           strictlyMonotone = false;
           strictlyDecreasing = false; // meaningless now
         }
       }
     }
-    else if (xf_iterator->second < xf_next_iterator->second) {
+    else if (fdata[i] < fdata[i + 1]) {
       // Ok, assume increasing, check monotoneness:
       strictlyDecreasing = false;
       strictlyIncreasing = true;
       decreasing = false;
       increasing = true;
-      while(++xf_iterator, ++xf_next_iterator != data.end()) {
-        if ((*xf_iterator).second >  (*xf_next_iterator).second) {
+      while (++i + 1 < n) {
+        if (fdata[i] >  fdata[i + 1]) {
           monotone = false;
           strictlyMonotone = false;
           strictlyIncreasing = false; // meaningless now
           break; // out of while loop
         }
-        if ((*xf_iterator).second >= (*xf_next_iterator).second) {
+        if (fdata[i] >= fdata[i + 1]) {
           strictlyMonotone = false;
           strictlyIncreasing = false; // meaningless now
         }
@@ -485,10 +536,53 @@ computeInternalFunctionData() const {
     adjustDerivativesForMonotoneness();
   }
 
+  computeCoefficients();
+
   strictlyMonotoneCached = true;
   monotoneCached = true;
 }
 
+
+void
+MonotCubicInterpolator::
+computeCoefficients() const {
+
+  coeffs.clear();
+  if (xdata.size() <= 1) {
+    return;
+  }
+
+  const bool hermite = (ddata.size() == xdata.size());
+
+  coeffs.resize(xdata.size() - 1);
+  for (vector<double>::size_type i = 0; i + 1 < xdata.size(); ++i) {
+    const double h     = xdata[i + 1] - xdata[i];
+    const double delta = (fdata[i + 1] - fdata[i]) / h;
+
+    Cubic& c = coeffs[i];
+    c.c0 = fdata[i];
+
+    if (hermite) {
+      // Cubic Hermite spline, the power form of
+      //   f1*H00(t) + h*d1*H10(t) + f2*H01(t) + h*d2*H11(t)
+      // with t = s/h, see
+      // http://en.wikipedia.org/w/index.php?title=Cubic_Hermite_spline&oldid=84495502
+      const double d1 = ddata[i];
+      const double d2 = ddata[i + 1];
+
+      c.c1 = d1;
+      c.c2 = (3*delta - 2*d1 - d2) / h;
+      c.c3 = (d1 + d2 - 2*delta) / (h*h);
+    }
+    else {
+      // Linear interpolation if derivative data is not available:
+      c.c1 = delta;
+      c.c2 = 0.0;
+      c.c3 = 0.0;
+    }
+  }
+}
+
 //       Checks if the function curve is flat (zero derivative) at the
 //       endpoints, chop off endpoint data points if that is the case.
 //
@@ -514,36 +608,32 @@ chopFlatEndpoints(const double epsilon) {
         return;
     }
 
-    map<double,double>::iterator xf_iterator;
-    map<double,double>::iterator xf_next_iterator;
-
     // Clear flags:
     strictlyMonotoneCached = false;
     monotoneCached = false;
 
+    const vector<double>::size_type n = xdata.size();
+
     // Chop left end:
-    xf_iterator = data.begin();
-    xf_next_iterator = ++(data.begin());
     // Erase data points that are similar to its right value from the left end.
-    while ((xf_next_iterator != data.end()) &&
-           (fabs(xf_iterator->second - xf_next_iterator->second) < epsilon )) {
-        ++xf_next_iterator;
-        data.erase(xf_iterator);
-        ++xf_iterator;
+    vector<double>::size_type first = 0;
+    while ((first + 1 < n) &&
+           (fabs(fdata[first] - fdata[first + 1]) < epsilon )) {
+        ++first;
     }
 
-    xf_iterator = data.end();
-    --xf_iterator;   // (data.end() points beyond the last element)
-    xf_next_iterator = xf_iterator;
-    --xf_next_iterator;
     // Erase data points that are similar to its left value from the right end.
-    while ((xf_next_iterator != data.begin()) &&
-           (fabs(xf_iterator->second - xf_next_iterator->second) < epsilon )) {
-        --xf_next_iterator;
-        data.erase(xf_iterator);
-        --xf_iterator;
+    vector<double>::size_type last = n - 1;
+    while ((last - 1 > first) &&
+           (fabs(fdata[last] - fdata[last - 1]) < epsilon )) {
+        --last;
     }
 
+    xdata.erase(xdata.begin() + last + 1, xdata.end());
+    fdata.erase(fdata.begin() + last + 1, fdata.end());
+    xdata.erase(xdata.begin(), xdata.begin() + first);
+    fdata.erase(fdata.begin(), fdata.begin() + first);
+
     // Finished chopping, so recompute function data:
     computeInternalFunctionData();
 }
@@ -572,10 +662,6 @@ shrinkFlatAreas(const double epsilon) {
         return;
     }
 
-    map<double,double>::iterator xf_iterator;
-    map<double,double>::iterator xf_next_iterator;
-
-
     // Nothing to do if we already are strictly monotone
     if (isStrictlyMonotone()) {
         return;
@@ -595,23 +681,29 @@ shrinkFlatAreas(const double epsilon) {
     // have equal values, delete one of the data pair.
     // Do not trust the source code on which data point is being
     // removed (x-values of equal y-points might be averaged in the future)
-    xf_iterator = data.begin();
-    xf_next_iterator = ++(data.begin());
-
-    while (xf_next_iterator != data.end()) {
-        //cout << xf_iterator->first << "," << xf_iterator->second << " " << xf_next_iterator->first << "," << xf_next_iterator->second << "\n";
-        if (fabs(xf_iterator->second - xf_next_iterator->second) < epsilon ) {
-            //cout << "erasing data pair" << xf_next_iterator->first << " " << xf_next_iterator->second << "\n";
-            map <double,double>::iterator xf_tobedeleted_iterator = xf_next_iterator;
-            ++xf_next_iterator;
-            data.erase(xf_tobedeleted_iterator);
+    vector<bool> keep(xdata.size(), true);
+    bool erased = false;
+
+    vector<double>::size_type i = 0;
+    for (vector<double>::size_type next = 1; next < xdata.size(); ++next) {
+        if (fabs(fdata[i] - fdata[next]) < epsilon ) {
+            keep[next] = false;
+            erased = true;
         }
         else {
-            ++xf_iterator;
-            ++xf_next_iterator;
+            i = next;
         }
     }
 
+    if (erased) {
+        eraseData(keep);
+
+        // The derivative values no longer match the data points, so
+        // fall back to linear interpolation until they are recomputed.
+        ddata.clear();
+        computeCoefficients();
+    }
+
 }
 
 
@@ -619,52 +711,32 @@ void
 MonotCubicInterpolator::
 computeSimpleDerivatives() const {
 
-  ddata.clear();
+  const vector<double>::size_type n = xdata.size();
+
+  ddata.assign(n, 0.0);
 
   // Do endpoints first:
-  map<double,double>::const_iterator xf_iterator;
-  map<double,double>::const_iterator xf_next_iterator;
-  double diff;
 
   // Leftmost interval:
-  xf_iterator = data.begin();
-  xf_next_iterator = ++(data.begin());
-  diff =
-    (xf_next_iterator->second - xf_iterator->second) /
-    (xf_next_iterator->first  - xf_iterator->first);
-  ddata[xf_iterator->first] = diff ;
+  ddata[0] = (fdata[1] - fdata[0]) / (xdata[1] - xdata[0]);
 
   // Rightmost interval:
-  xf_iterator = --(--(data.end()));
-  xf_next_iterator = --(data.end());
-  diff =
-    (xf_next_iterator->second - xf_iterator->second) /
-    (xf_next_iterator->first  - xf_iterator->first);
-  ddata[xf_next_iterator->first] = diff ;
+  ddata[n - 1] = (fdata[n - 1] - fdata[n - 2]) / (xdata[n - 1] - xdata[n - 2]);
 
   // If we have more than two intervals, loop over internal points:
-  if (data.size() > 2) {
-
-    map<double,double>::const_iterator intpoint;
-    for (intpoint = ++data.begin(); intpoint != --data.end(); ++intpoint) {
-      /*
-        diff = (f2 - f1)/(x2-x1)/w + (f3-f1)/(x3-x2)/2
-
-        average of the forward and backward difference.
-        Weights are equal, should we weigh with h_i?
-      */
-
-      map<double,double>::const_iterator lastpoint = intpoint; --lastpoint;
-      map<double,double>::const_iterator nextpoint = intpoint; ++nextpoint;
-
-      diff = (nextpoint->second - intpoint->second)/
-        (2*(nextpoint->first - intpoint->first))
-        +
-        (intpoint->second - lastpoint->second) /
-        (2*(intpoint->first - lastpoint->first));
-
-      ddata[intpoint->first] = diff ;
-    }
+  for (vector<double>::size_type i = 1; i + 1 < n; ++i) {
+    /*
+      diff = (f2 - f1)/(x2-x1)/w + (f3-f1)/(x3-x2)/2
+
+      average of the forward and backward difference.
+      Weights are equal, should we weigh with h_i?
+    */
+
+    ddata[i] = (fdata[i + 1] - fdata[i])/
+      (2*(xdata[i + 1] - xdata[i]))
+      +
+      (fdata[i] - fdata[i - 1]) /
+      (2*(xdata[i] - xdata[i - 1]));
   }
 }
 
@@ -673,32 +745,26 @@ computeSimpleDerivatives() const {
 void
 MonotCubicInterpolator::
 adjustDerivativesForMonotoneness() const {
-  map<double,double>::const_iterator point, dpoint;
 
   /* Loop over all intervals, ie. loop over all points and look
      at the interval to the right of the point */
-  for (point = data.begin(), dpoint = ddata.begin();
-       point != --data.end();
-       ++point, ++dpoint) {
-    map<double,double>::const_iterator nextpoint, nextdpoint;
-    nextpoint = point; ++nextpoint;
-    nextdpoint = dpoint; ++nextdpoint;
+  for (vector<double>::size_type i = 0; i + 1 < xdata.size(); ++i) {
 
     double delta =
-      (nextpoint->second - point->second) /
-      (nextpoint->first  - point->first);
+      (fdata[i + 1] - fdata[i]) /
+      (xdata[i + 1] - xdata[i]);
     if (fabs(delta) < 1e-14) {
-      ddata[point->first] = 0.0;
-      ddata[nextpoint->first] = 0.0;
+      ddata[i] = 0.0;
+      ddata[i + 1] = 0.0;
     } else {
-      double alpha = ddata[point->first] / delta;
-      double beta = ddata[nextpoint->first] / delta;
+      double alpha = ddata[i] / delta;
+      double beta = ddata[i + 1] / delta;
 
       if (! isMonotoneCoeff(alpha, beta)) {
         double tau = 3/sqrt(alpha*alpha + beta*beta);
 
-        ddata[point->first]     = tau*alpha*delta;
-        ddata[nextpoint->first] = tau*beta*delta;
+        ddata[i]     = tau*alpha*delta;
+        ddata[i + 1] = tau*beta*delta;
       }
     }
 
@@ -714,17 +780,15 @@ adjustDerivativesForMonotoneness() const {
 void
 MonotCubicInterpolator::
 scaleData(double factor) {
-  map<double,double>::iterator it , itd  ;
-  if (data.size() == ddata.size()) {
-    for (it = data.begin() , itd = ddata.begin() ; it != data.end() ; ++it , ++itd) {
-      it->second  *= factor ;
-      itd->second *= factor ;
-    } ;
-  } else {
-    for (it = data.begin() ; it != data.end() ; ++it ) {
-      it->second  *= factor ;
+  for (auto& f : fdata) {
+    f *= factor ;
+  }
+  if (fdata.size() == ddata.size()) {
+    for (auto& d : ddata) {
+      d *= factor ;
     }
   }
+  computeCoefficients();
 }
 
 
@@ -0,0 +1,622 @@
+/*
+  Copyright (c) 2019 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/Columnar.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <ios>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <boost/filesystem.hpp>
+
+namespace {
+
+    const char magic[] = "OPMCOL01";
+
+    const std::size_t magicSize = 8;
+
+    /// Number of elements generated by each call to a dataset's fill
+    /// callback.  Bounds the temporary storage of a write.
+    const std::size_t chunkSize = 64 * 1024;
+
+    const std::string indexFile = "INDEX";
+
+    bool hostIsLittleEndian()
+    {
+        const std::uint16_t one = 1;
+        unsigned char first;
+        std::memcpy(&first, &one, 1);
+
+        return first == 1;
+    }
+
+    /// Copy n elements of arithmetic type T from src to dst in
+    /// little-endian byte order.
+    template <typename T>
+    void toLittleEndian(const T* src, const std::size_t n, char* dst)
+    {
+        std::memcpy(dst, src, n * sizeof(T));
+
+        if (! hostIsLittleEndian()) {
+            for (auto i = 0*n; i < n; ++i)
+                std::reverse(dst + i*sizeof(T), dst + (i + 1)*sizeof(T));
+        }
+    }
+
+    /// Inverse of toLittleEndian().
+    template <typename T>
+    void fromLittleEndian(char* src, const std::size_t n, T* dst)
+    {
+        if (! hostIsLittleEndian()) {
+            for (auto i = 0*n; i < n; ++i)
+                std::reverse(src + i*sizeof(T), src + (i + 1)*sizeof(T));
+        }
+
+        std::memcpy(dst, src, n * sizeof(T));
+    }
+
+    template <typename T>
+    void writeInteger(std::ostream& os, const T value)
+    {
+        char bytes[sizeof(T)];
+        toLittleEndian(&value, 1, bytes);
+
+        os.write(bytes, sizeof(T));
+    }
+
+    template <typename T>
+    T readInteger(std::istream& is)
+    {
+        char bytes[sizeof(T)];
+        is.read(bytes, sizeof(T));
+
+        T value;
+        fromLittleEndian(bytes, 1, &value);
+
+        return value;
+    }
+
+    /// Offset of first element following a header with a keyword of
+    /// \p nameSize characters.
+    std::size_t dataOffset(const std::size_t nameSize)
+    {
+        const auto headerSize = magicSize + 4 + 4 + 8 + 4 + nameSize;
+
+        return 8 * ((headerSize + 7) / 8);
+    }
+
+    std::string typeName(const Opm::EclIO::eclArrType type)
+    {
+        switch (type) {
+        case Opm::EclIO::INTE: return "INTE";
+        case Opm::EclIO::REAL: return "REAL";
+        case Opm::EclIO::DOUB: return "DOUB";
+        case Opm::EclIO::CHAR: return "CHAR";
+        case Opm::EclIO::LOGI: return "LOGI";
+        case Opm::EclIO::MESS: return "MESS";
+        }
+
+        return "MESS";
+    }
+
+    Opm::EclIO::eclArrType arrayType(const std::string& name)
+    {
+        using Opm::EclIO::eclArrType;
+
+        for (const auto type : { eclArrType::INTE, eclArrType::REAL,
+                                 eclArrType::DOUB, eclArrType::CHAR,
+                                 eclArrType::LOGI, eclArrType::MESS })
+        {
+            if (typeName(type) == name)
+                return type;
+        }
+
+        OPM_THROW(std::runtime_error, "Unknown columnar array type " << name);
+    }
+
+    /// Dataset file name of occurrence \p n of keyword \p kw.
+    std::string datasetFile(const std::string& kw, const int n)
+    {
+        std::ostringstream fname;
+
+        for (const auto c : kw) {
+            const auto u = static_cast<unsigned char>(c);
+
+            if (std::isalnum(u) || (c == '_') || (c == '-'))
+                fname << c;
+            else
+                fname << '%' << std::hex << std::uppercase
+                      << std::setw(2) << std::setfill('0')
+                      << static_cast<int>(u) << std::dec;
+        }
+
+        if (n > 0)
+            fname << '.' << n;
+
+        fname << ".col";
+
+        return fname.str();
+    }
+
+    std::string sectionName(const Opm::EclIO::OutputStream::Columnar::Section section,
+                            const int                                         seqnum)
+    {
+        using Section = Opm::EclIO::OutputStream::Columnar::Section;
+
+        if (section == Section::Init)
+            return "INIT";
+
+        std::ostringstream name;
+        name << ((section == Section::Restart) ? "RESTART_" : "RFT_")
+             << std::setw(4) << std::setfill('0') << seqnum;
+
+        return name.str();
+    }
+} // Anonymous namespace
+
+// =====================================================================
+
+Opm::EclIO::OutputStream::Columnar::
+Columnar(const ResultSet& rset,
+         const Section    section,
+         const int        seqnum)
+    : dir_{ directory(rset, section, seqnum) }
+{
+    namespace fs = boost::filesystem;
+
+    const auto dir = fs::path{ this->dir_ };
+
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    std::ofstream index{ (dir / indexFile).string(), std::ios_base::trunc };
+    if (! index)
+        OPM_THROW(std::runtime_error,
+                  "Unable to create columnar section " << this->dir_);
+}
+
+Opm::EclIO::OutputStream::Columnar::~Columnar()
+{}
+
+Opm::EclIO::OutputStream::Columnar::Columnar(Columnar&& rhs)
+    : dir_  { std::move(rhs.dir_) }
+    , count_{ std::move(rhs.count_) }
+{}
+
+Opm::EclIO::OutputStream::Columnar&
+Opm::EclIO::OutputStream::Columnar::operator=(Columnar&& rhs)
+{
+    this->dir_   = std::move(rhs.dir_);
+    this->count_ = std::move(rhs.count_);
+
+    return *this;
+}
+
+std::string
+Opm::EclIO::OutputStream::Columnar::
+directory(const ResultSet& rset,
+          const Section    section,
+          const int        seqnum)
+{
+    return (boost::filesystem::path{ outputFileName(rset, "COLUMNS") }
+            / sectionName(section, seqnum)).generic_string();
+}
+
+void Opm::EclIO::OutputStream::Columnar::message(const std::string& msg)
+{
+    this->writeDataset(msg, MESS, 0, 0,
+        [](const std::size_t, const std::size_t, char*) {});
+}
+
+void
+Opm::EclIO::OutputStream::Columnar::
+write(const std::string& kw, const std::vector<int>& data)
+{
+    this->writeNumeric(kw, INTE, data.data(), data.size());
+}
+
+void
+Opm::EclIO::OutputStream::Columnar::
+write(const std::string& kw, const std::vector<bool>& data)
+{
+    this->writeDataset(kw, LOGI, 1, data.size(),
+        [&data](const std::size_t begin, const std::size_t end, char* bytes)
+    {
+        for (auto i = begin; i < end; ++i)
+            *bytes++ = data[i] ? 1 : 0;
+    });
+}
+
+void
+Opm::EclIO::OutputStream::Columnar::
+write(const std::string& kw, const std::vector<float>& data)
+{
+    this->writeNumeric(kw, REAL, data.data(), data.size());
+}
+
+void
+Opm::EclIO::OutputStream::Columnar::
+write(const std::string& kw, const std::vector<double>& data)
+{
+    this->writeNumeric(kw, DOUB, data.data(), data.size());
+}
+
+void
+Opm::EclIO::OutputStream::Columnar::
+write(const std::string&           kw,
+      const std::size_t            size,
+      const SinglePrecisionSource& source)
+{
+    auto values = std::vector<float>{};
+
+    this->writeDataset(kw, REAL, sizeof(float), size,
+        [&values, &source](const std::size_t begin, const std::size_t end, char* bytes)
+    {
+        values.resize(end - begin);
+        source(begin, end, values.data());
+
+        toLittleEndian(values.data(), values.size(), bytes);
+    });
+}
+
+void
+Opm::EclIO::OutputStream::Columnar::
+write(const std::string& kw, const std::vector<std::string>& data)
+{
+    auto width = std::size_t{1};
+    for (const auto& s : data)
+        width = std::max(width, s.size());
+
+    this->writeStrings(kw, data, width);
+}
+
+void
+Opm::EclIO::OutputStream::Columnar::
+write(const std::string&                        kw,
+      const std::vector<PaddedOutputString<8>>& data)
+{
+    auto strings = std::vector<std::string>{};
+    strings.reserve(data.size());
+
+    for (const auto& s : data)
+        strings.emplace_back(s.c_str());
+
+    this->writeStrings(kw, strings, 8);
+}
+
+void
+Opm::EclIO::OutputStream::Columnar::
+writeStrings(const std::string&              kw,
+             const std::vector<std::string>& data,
+             const std::size_t               width)
+{
+    this->writeDataset(kw, CHAR, width, data.size(),
+        [&data, width](const std::size_t begin, const std::size_t end, char* bytes)
+    {
+        std::fill(bytes, bytes + (end - begin)*width, ' ');
+
+        for (auto i = begin; i < end; ++i, bytes += width)
+            std::copy(data[i].begin(), data[i].end(), bytes);
+    });
+}
+
+namespace Opm { namespace EclIO { namespace OutputStream {
+
+    template <class Fill>
+    void Columnar::writeDataset(const std::string& kw,
+                                const eclArrType   type,
+                                const std::size_t  elemSize,
+                                const std::size_t  size,
+                                Fill&&             fill)
+    {
+        namespace fs = boost::filesystem;
+
+        auto& n = this->count_[kw];
+        const auto file = datasetFile(kw, n);
+        const auto path = (fs::path{ this->dir_ } / file).string();
+
+        {
+            std::ofstream os{ path, std::ios_base::binary | std::ios_base::trunc };
+            if (! os)
+                OPM_THROW(std::runtime_error,
+                          "Unable to create columnar dataset " << path);
+
+            os.write(magic, magicSize);
+            os.write(typeName(type).c_str(), 4);
+            writeInteger(os, static_cast<std::uint32_t>(elemSize));
+            writeInteger(os, static_cast<std::uint64_t>(size));
+            writeInteger(os, static_cast<std::uint32_t>(kw.size()));
+            os.write(kw.data(), kw.size());
+
+            const auto pad = dataOffset(kw.size()) - static_cast<std::size_t>(os.tellp());
+            os.write("\0\0\0\0\0\0\0", pad);
+
+            auto bytes = std::vector<char>{};
+            for (auto begin = std::size_t{0}; begin < size; begin += chunkSize) {
+                const auto end = std::min(size, begin + chunkSize);
+
+                bytes.resize((end - begin) * elemSize);
+                fill(begin, end, bytes.data());
+
+                os.write(bytes.data(), bytes.size());
+            }
+
+            if (! os)
+                OPM_THROW(std::runtime_error,
+                          "Failed to write columnar dataset " << path);
+        }
+
+        std::ofstream index{ (fs::path{ this->dir_ } / indexFile).string(),
+                             std::ios_base::app };
+
+        index << kw << '\t' << typeName(type) << '\t'
+              << size << '\t' << file << '\n';
+
+        if (! index)
+            OPM_THROW(std::runtime_error,
+                      "Failed to update index of columnar section " << this->dir_);
+
+        ++n;
+    }
+
+    template <typename T>
+    void Columnar::writeNumeric(const std::string& kw,
+                                const eclArrType   type,
+                                const T*           data,
+                                const std::size_t  size)
+    {
+        this->writeDataset(kw, type, sizeof(T), size,
+            [data](const std::size_t begin, const std::size_t end, char* bytes)
+        {
+            toLittleEndian(data + begin, end - begin, bytes);
+        });
+    }
+
+}}} // namespace Opm::EclIO::OutputStream
+
+// =====================================================================
+
+Opm::EclIO::EColumnar::EColumnar(const std::string& directory)
+    : dir_{ directory }
+{
+    const auto fname = (boost::filesystem::path{ directory } / indexFile).string();
+
+    std::ifstream index{ fname };
+    if (! index)
+        OPM_THROW(std::invalid_argument,
+                  "Unable to open columnar section index " << fname);
+
+    std::string line;
+    while (std::getline(index, line)) {
+        if (line.empty())
+            continue;
+
+        std::istringstream fields{ line };
+        std::string name, type, file;
+        std::size_t size;
+
+        if (! (std::getline(fields, name, '\t') &&
+               std::getline(fields, type, '\t') &&
+               (fields >> size) && fields.ignore() &&
+               std::getline(fields, file)))
+        {
+            OPM_THROW(std::runtime_error,
+                      "Malformed entry '" << line << "' in " << fname);
+        }
+
+        this->datasets_.push_back(Dataset{ name, arrayType(type), size, file });
+    }
+}
+
+std::vector<Opm::EclIO::EColumnar::EclEntry>
+Opm::EclIO::EColumnar::getList() const
+{
+    auto list = std::vector<EclEntry>{};
+    list.reserve(this->datasets_.size());
+
+    for (const auto& ds : this->datasets_)
+        list.emplace_back(ds.name, ds.type, static_cast<int>(ds.size));
+
+    return list;
+}
+
+bool Opm::EclIO::EColumnar::hasKey(const std::string& name) const
+{
+    return this->count(name) > 0;
+}
+
+int Opm::EclIO::EColumnar::count(const std::string& name) const
+{
+    return static_cast<int>(std::count_if(this->datasets_.begin(), this->datasets_.end(),
+        [&name](const Dataset& ds) { return ds.name == name; }));
+}
+
+const Opm::EclIO::EColumnar::Dataset&
+Opm::EclIO::EColumnar::dataset(const std::string& name, const int occurrence) const
+{
+    auto n = 0;
+    for (const auto& ds : this->datasets_) {
+        if ((ds.name == name) && (n++ == occurrence))
+            return ds;
+    }
+
+    OPM_THROW(std::invalid_argument,
+              "Array " << name << " (occurrence " << occurrence
+              << ") not found in columnar section " << this->dir_);
+}
+
+namespace {
+
+    template <typename T>
+    struct ElementType;
+
+    template <>
+    struct ElementType<int>
+    {
+        static constexpr Opm::EclIO::eclArrType type = Opm::EclIO::INTE;
+    };
+
+    template <>
+    struct ElementType<float>
+    {
+        static constexpr Opm::EclIO::eclArrType type = Opm::EclIO::REAL;
+    };
+
+    template <>
+    struct ElementType<double>
+    {
+        static constexpr Opm::EclIO::eclArrType type = Opm::EclIO::DOUB;
+    };
+
+    template <>
+    struct ElementType<bool>
+    {
+        static constexpr Opm::EclIO::eclArrType type = Opm::EclIO::LOGI;
+    };
+
+    template <>
+    struct ElementType<std::string>
+    {
+        static constexpr Opm::EclIO::eclArrType type = Opm::EclIO::CHAR;
+    };
+
+    template <typename T>
+    struct Tag {};
+
+    template <typename T>
+    std::vector<T> decode(std::vector<char>& bytes, const std::size_t n,
+                          const std::size_t, Tag<T>)
+    {
+        auto values = std::vector<T>(n);
+        fromLittleEndian(bytes.data(), n, values.data());
+
+        return values;
+    }
+
+    std::vector<bool> decode(std::vector<char>& bytes, const std::size_t n,
+                             const std::size_t, Tag<bool>)
+    {
+        auto values = std::vector<bool>(n);
+        std::transform(bytes.begin(), bytes.begin() + n, values.begin(),
+                       [](const char b) { return b != 0; });
+
+        return values;
+    }
+
+    std::vector<std::string> decode(std::vector<char>& bytes, const std::size_t n,
+                                    const std::size_t width, Tag<std::string>)
+    {
+        auto values = std::vector<std::string>(n);
+
+        auto* elm = bytes.data();
+        for (auto& value : values) {
+            auto end = elm + width;
+            while ((end != elm) && (*(end - 1) == ' '))
+                --end;
+
+            value.assign(elm, end);
+            elm += width;
+        }
+
+        return values;
+    }
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+    template <typename T>
+    std::vector<T> EColumnar::get(const std::string& name,
+                                  const std::size_t  begin,
+                                  const std::size_t  end,
+                                  const int          occurrence) const
+    {
+        const auto& ds = this->dataset(name, occurrence);
+
+        if (ds.type != ElementType<T>::type)
+            OPM_THROW(std::runtime_error,
+                      "Array " << name << " is of type " << typeName(ds.type)
+                      << ", not " << typeName(ElementType<T>::type));
+
+        if ((begin > end) || (end > ds.size))
+            OPM_THROW(std::invalid_argument,
+                      "Range [" << begin << ", " << end << ") outside array "
+                      << name << " of " << ds.size << " elements");
+
+        const auto fname = (boost::filesystem::path{ this->dir_ } / ds.file).string();
+
+        std::ifstream is{ fname, std::ios_base::binary };
+
+        char head[magicSize + 4];
+        is.read(head, sizeof head);
+
+        if (! is || (std::string(head, magicSize) != magic) ||
+            (std::string(head + magicSize, 4) != typeName(ds.type)))
+        {
+            OPM_THROW(std::runtime_error, "Invalid columnar dataset " << fname);
+        }
+
+        const auto elemSize = readInteger<std::uint32_t>(is);
+        const auto size     = readInteger<std::uint64_t>(is);
+        const auto nameSize = readInteger<std::uint32_t>(is);
+
+        if (size != ds.size)
+            OPM_THROW(std::runtime_error,
+                      "Size of columnar dataset " << fname << " differs from index");
+
+        auto bytes = std::vector<char>((end - begin) * elemSize);
+
+        is.seekg(dataOffset(nameSize) + begin*elemSize);
+        is.read(bytes.data(), bytes.size());
+
+        if (! is)
+            OPM_THROW(std::runtime_error, "Failed to read columnar dataset " << fname);
+
+        return decode(bytes, end - begin, elemSize, Tag<T>{});
+    }
+
+    template <typename T>
+    std::vector<T> EColumnar::get(const std::string& name,
+                                  const int          occurrence) const
+    {
+        return this->get<T>(name, 0, this->dataset(name, occurrence).size, occurrence);
+    }
+
+    template std::vector<int>         EColumnar::get(const std::string&, std::size_t, std::size_t, int) const;
+    template std::vector<float>       EColumnar::get(const std::string&, std::size_t, std::size_t, int) const;
+    template std::vector<double>      EColumnar::get(const std::string&, std::size_t, std::size_t, int) const;
+    template std::vector<bool>        EColumnar::get(const std::string&, std::size_t, std::size_t, int) const;
+    template std::vector<std::string> EColumnar::get(const std::string&, std::size_t, std::size_t, int) const;
+
+    template std::vector<int>         EColumnar::get(const std::string&, int) const;
+    template std::vector<float>       EColumnar::get(const std::string&, int) const;
+    template std::vector<double>      EColumnar::get(const std::string&, int) const;
+    template std::vector<bool>        EColumnar::get(const std::string&, int) const;
+    template std::vector<std::string> EColumnar::get(const std::string&, int) const;
+
+}} // namespace Opm::EclIO
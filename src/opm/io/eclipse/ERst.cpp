@@ -95,6 +95,25 @@ void ERst::loadReportStepNumber(int number)
 }
 
 
+void ERst::loadReportStepNumber(int number, const std::vector<std::string>& names)
+{
+    if (!hasReportStepNumber(number)) {
+        std::string message="Trying to load non existing report step number " + std::to_string(number);
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    const auto& range = arrIndexRange[number];
+
+    std::vector<int> arrayIndexList;
+    for (int i = range.first; i < range.second; i++) {
+        if (std::find(names.begin(), names.end(), array_name[i]) != names.end()) {
+            arrayIndexList.push_back(i);
+        }
+    }
+
+    loadData(arrayIndexList);
+}
+
 std::vector<EclFile::EclEntry> ERst::listOfRstArrays(int reportStepNumber)
 {
     std::vector<EclEntry> list;
@@ -147,6 +166,33 @@ void ERst::initUnified()
     for (int i = 0; i < nReports; i++) {
         reportLoaded[seqnum[i]] = false;
     }
+
+    resolveReferences();
+}
+
+void ERst::resolveReferences()
+{
+    // Arrays stored relative to an earlier report step refer to the first
+    // array of the same name and type in that report step, which must be
+    // a full array of the same size.  Other
+    // references are left unresolved and fail on loading.
+    for (size_t i = 0; i < array_name.size(); i++) {
+        const auto range_it = arrIndexRange.find(array_reference[i]);
+        if ((array_reference[i] < 0) || (range_it == arrIndexRange.end())) {
+            continue;
+        }
+
+        const auto& range = range_it->second;
+        for (int j = range.first; j < range.second; j++) {
+            if ((array_name[j] == array_name[i]) && (array_type[j] == array_type[i])) {
+                if ((array_reference[j] < 0) && (array_size[j] == array_size[i])) {
+                    array_base[i] = j;
+                }
+
+                break;
+            }
+        }
+    }
 }
 
 void ERst::initSeparate(const int number)
@@ -0,0 +1,379 @@
+/*
+  Copyright (c) 2019 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/EclCompress.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+    // First byte of each compressed block.
+    enum BlockMethod : char {
+        Stored    = 0,          // Byte planes of differences as is.
+        RunLength = 1,          // Run-length encoded byte planes.
+    };
+
+    // Runs of at least minRun equal bytes are stored as a control byte
+    // 128 + (length - minRun) followed by the repeated byte.  Other bytes
+    // are stored in literal runs of at most maxLiteral bytes, preceded by
+    // a control byte (length - 1).
+    const std::size_t minRun     = 3;
+    const std::size_t maxRun     = 127 + minRun;
+    const std::size_t maxLiteral = 128;
+
+    template <typename T>
+    struct Difference;
+
+    template <>
+    struct Difference<int>
+    {
+        using Bits = std::uint32_t;
+
+        static Bits forward (const Bits x, const Bits prev) { return x - prev; }
+        static Bits backward(const Bits d, const Bits prev) { return d + prev; }
+    };
+
+    template <>
+    struct Difference<float>
+    {
+        using Bits = std::uint32_t;
+
+        static Bits forward (const Bits x, const Bits prev) { return x ^ prev; }
+        static Bits backward(const Bits d, const Bits prev) { return d ^ prev; }
+    };
+
+    template <>
+    struct Difference<double>
+    {
+        using Bits = std::uint64_t;
+
+        static Bits forward (const Bits x, const Bits prev) { return x ^ prev; }
+        static Bits backward(const Bits d, const Bits prev) { return d ^ prev; }
+    };
+
+    void runLengthEncode(const std::vector<unsigned char>& in,
+                         std::vector<char>&                out)
+    {
+        const auto n = in.size();
+        auto literal = std::size_t{0};
+
+        auto flushLiteral = [&in, &out, &literal](const std::size_t end)
+        {
+            while (literal < end) {
+                const auto len = std::min(maxLiteral, end - literal);
+
+                out.push_back(static_cast<char>(len - 1));
+                out.insert(out.end(), in.begin() + literal, in.begin() + literal + len);
+
+                literal += len;
+            }
+        };
+
+        auto i = std::size_t{0};
+        while (i < n) {
+            auto run = std::size_t{1};
+            while ((i + run < n) && (run < maxRun) && (in[i + run] == in[i])) {
+                ++run;
+            }
+
+            if (run >= minRun) {
+                flushLiteral(i);
+
+                out.push_back(static_cast<char>(128 + (run - minRun)));
+                out.push_back(static_cast<char>(in[i]));
+
+                literal = i + run;
+            }
+
+            i += run;
+        }
+
+        flushLiteral(n);
+    }
+
+    void runLengthDecode(const std::vector<char>&     in,
+                         std::vector<unsigned char>& out)
+    {
+        auto pos = std::size_t{1};
+        auto o   = std::size_t{0};
+
+        while (pos < in.size()) {
+            const auto ctrl = static_cast<unsigned char>(in[pos++]);
+
+            if (ctrl < 128) {
+                const auto len = std::size_t{ctrl} + 1;
+
+                if ((pos + len > in.size()) || (o + len > out.size())) {
+                    OPM_THROW(std::runtime_error, "Error reading compressed array, literal run exceeds block");
+                }
+
+                std::memcpy(out.data() + o, in.data() + pos, len);
+                pos += len;
+                o   += len;
+            }
+            else {
+                const auto len = std::size_t{ctrl} - 128 + minRun;
+
+                if ((pos >= in.size()) || (o + len > out.size())) {
+                    OPM_THROW(std::runtime_error, "Error reading compressed array, repeated run exceeds block");
+                }
+
+                std::fill_n(out.begin() + o, len, static_cast<unsigned char>(in[pos++]));
+                o += len;
+            }
+        }
+
+        if (o != out.size()) {
+            OPM_THROW(std::runtime_error, "Error reading compressed array, block is too short");
+        }
+    }
+
+    // Differences are taken with respect to the corresponding elements of
+    // base, if any, and then with respect to the preceding element.
+    template <typename T>
+    std::vector<char> encodeBlock(const T* data, const T* base, const std::size_t size)
+    {
+        using Bits = typename Difference<T>::Bits;
+        const auto width = sizeof(Bits);
+
+        // Byte k of the difference of element i goes to planes[k*size + i].
+        std::vector<unsigned char> planes(width * size);
+
+        auto prev = Bits{0};
+        for (std::size_t i = 0; i < size; ++i) {
+            auto bits = Bits{0};
+            std::memcpy(&bits, data + i, width);
+
+            if (base != nullptr) {
+                auto baseBits = Bits{0};
+                std::memcpy(&baseBits, base + i, width);
+
+                bits = Difference<T>::forward(bits, baseBits);
+            }
+
+            const auto diff = Difference<T>::forward(bits, prev);
+            prev = bits;
+
+            for (std::size_t k = 0; k < width; ++k) {
+                planes[k*size + i] = static_cast<unsigned char>(diff >> (8 * k));
+            }
+        }
+
+        std::vector<char> block { RunLength };
+        block.reserve(planes.size() + 1);
+
+        runLengthEncode(planes, block);
+
+        if (block.size() > planes.size()) {
+            block.assign(1, Stored);
+            block.insert(block.end(), planes.begin(), planes.end());
+        }
+
+        return block;
+    }
+
+    template <typename T>
+    void decodeBlock(const std::vector<char>& block, T* data, const T* base, const std::size_t size)
+    {
+        using Bits = typename Difference<T>::Bits;
+        const auto width = sizeof(Bits);
+
+        std::vector<unsigned char> planes(width * size);
+
+        if (block.empty()) {
+            OPM_THROW(std::runtime_error, "Error reading compressed array, empty block");
+        }
+        else if (block[0] == Stored) {
+            if (block.size() != planes.size() + 1) {
+                OPM_THROW(std::runtime_error, "Error reading compressed array, incorrect block size");
+            }
+
+            std::memcpy(planes.data(), block.data() + 1, planes.size());
+        }
+        else if (block[0] == RunLength) {
+            runLengthDecode(block, planes);
+        }
+        else {
+            OPM_THROW(std::runtime_error, "Error reading compressed array, unknown block method");
+        }
+
+        auto prev = Bits{0};
+        for (std::size_t i = 0; i < size; ++i) {
+            auto diff = Bits{0};
+            for (std::size_t k = 0; k < width; ++k) {
+                diff |= Bits{planes[k*size + i]} << (8 * k);
+            }
+
+            prev = Difference<T>::backward(diff, prev);
+
+            auto bits = prev;
+            if (base != nullptr) {
+                auto baseBits = Bits{0};
+                std::memcpy(&baseBits, base + i, width);
+
+                bits = Difference<T>::backward(bits, baseBits);
+            }
+
+            std::memcpy(data + i, &bits, width);
+        }
+    }
+
+    template <typename T>
+    std::vector<std::vector<char>>
+    encodeBlocksImpl(const T* data, const T* base, const std::size_t size)
+    {
+        const auto blockSize = Opm::EclIO::Compress::blockSize;
+        const auto n = static_cast<int>(Opm::EclIO::Compress::numBlocks(size));
+
+        std::vector<std::vector<char>> blocks(n);
+
+#pragma omp parallel for schedule(dynamic)
+        for (int b = 0; b < n; ++b) {
+            const auto begin = b * blockSize;
+            const auto end   = std::min(size, begin + blockSize);
+
+            blocks[b] = encodeBlock(data + begin, (base != nullptr) ? base + begin : nullptr,
+                                    end - begin);
+        }
+
+        return blocks;
+    }
+
+    template <typename T>
+    void decodeBlocksImpl(const std::vector<std::vector<char>>& blocks,
+                          const std::size_t                     blockSize,
+                          T*                                    data,
+                          const T*                              base,
+                          const std::size_t                     size)
+    {
+        if ((blockSize == 0) ||
+            (blocks.size() != Opm::EclIO::Compress::numBlocks(size, blockSize)))
+        {
+            OPM_THROW(std::runtime_error, "Error reading compressed array, inconsistent block index");
+        }
+
+        const auto n = static_cast<int>(blocks.size());
+        std::exception_ptr error;
+
+#pragma omp parallel for schedule(dynamic)
+        for (int b = 0; b < n; ++b) {
+            const auto begin = b * blockSize;
+            const auto end   = std::min(size, begin + blockSize);
+
+            try {
+                decodeBlock(blocks[b], data + begin, (base != nullptr) ? base + begin : nullptr,
+                            end - begin);
+            }
+            catch (...) {
+#pragma omp critical(EclCompress_decodeError)
+                if (!error) { error = std::current_exception(); }
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO { namespace Compress {
+
+std::size_t numBlocks(const std::size_t size, const std::size_t elementsPerBlock)
+{
+    return (size + elementsPerBlock - 1) / elementsPerBlock;
+}
+
+std::vector<std::vector<char>> encodeBlocks(const int* data, const std::size_t size)
+{
+    return encodeBlocksImpl(data, static_cast<const int*>(nullptr), size);
+}
+
+std::vector<std::vector<char>> encodeBlocks(const float* data, const std::size_t size)
+{
+    return encodeBlocksImpl(data, static_cast<const float*>(nullptr), size);
+}
+
+std::vector<std::vector<char>> encodeBlocks(const double* data, const std::size_t size)
+{
+    return encodeBlocksImpl(data, static_cast<const double*>(nullptr), size);
+}
+
+void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                  const std::size_t elementsPerBlock, int* data, const std::size_t size)
+{
+    decodeBlocksImpl(blocks, elementsPerBlock, data, static_cast<const int*>(nullptr), size);
+}
+
+void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                  const std::size_t elementsPerBlock, float* data, const std::size_t size)
+{
+    decodeBlocksImpl(blocks, elementsPerBlock, data, static_cast<const float*>(nullptr), size);
+}
+
+void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                  const std::size_t elementsPerBlock, double* data, const std::size_t size)
+{
+    decodeBlocksImpl(blocks, elementsPerBlock, data, static_cast<const double*>(nullptr), size);
+}
+
+std::vector<std::vector<char>> encodeBlocks(const int* data, const int* base, const std::size_t size)
+{
+    return encodeBlocksImpl(data, base, size);
+}
+
+std::vector<std::vector<char>> encodeBlocks(const float* data, const float* base, const std::size_t size)
+{
+    return encodeBlocksImpl(data, base, size);
+}
+
+std::vector<std::vector<char>> encodeBlocks(const double* data, const double* base, const std::size_t size)
+{
+    return encodeBlocksImpl(data, base, size);
+}
+
+void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                  const std::size_t elementsPerBlock, int* data,
+                  const int* base, const std::size_t size)
+{
+    decodeBlocksImpl(blocks, elementsPerBlock, data, base, size);
+}
+
+void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                  const std::size_t elementsPerBlock, float* data,
+                  const float* base, const std::size_t size)
+{
+    decodeBlocksImpl(blocks, elementsPerBlock, data, base, size);
+}
+
+void decodeBlocks(const std::vector<std::vector<char>>& blocks,
+                  const std::size_t elementsPerBlock, double* data,
+                  const double* base, const std::size_t size)
+{
+    decodeBlocksImpl(blocks, elementsPerBlock, data, base, size);
+}
+
+}}} // namespace Opm::EclIO::Compress
@@ -17,10 +17,12 @@
    */
 
 #include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclCompress.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 
 #include <algorithm>
 #include <array>
+#include <exception>
 #include <cstring>
 #include <functional>
 #include <fstream>
@@ -28,6 +30,7 @@
 #include <iterator>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include <opm/common/ErrorMacros.hpp>
 
@@ -64,7 +67,8 @@ bool isEOF(std::fstream* fileH)
 
 
 void readBinaryHeader(std::fstream& fileH, std::string& arrName,
-                      int& size, Opm::EclIO::eclArrType &arrType)
+                      int& size, Opm::EclIO::eclArrType &arrType,
+                      char& layout)
 {
     int bhead;
     std::string tmpStrName(8,' ');
@@ -94,6 +98,8 @@ void readBinaryHeader(std::fstream& fileH, std::string& arrName,
     }
 
     arrName = tmpStrName;
+    layout = '\0';
+
     if (tmpStrType == "INTE")
         arrType = Opm::EclIO::INTE;
     else if (tmpStrType == "REAL")
@@ -106,8 +112,31 @@ void readBinaryHeader(std::fstream& fileH, std::string& arrName,
         arrType = Opm::EclIO::LOGI;
     else if (tmpStrType == "MESS")
         arrType = Opm::EclIO::MESS;
-    else
-        OPM_THROW(std::runtime_error, "Error, unknown array type '" + tmpStrType +"'");
+    else {
+        // Compressed and referencing arrays, see EclCompress.hpp.
+        const auto prefix = tmpStrType[0];
+        const auto elmType = tmpStrType.substr(1);
+        const auto numeric = (elmType == "INT") || (elmType == "REA") || (elmType == "DOU");
+
+        if (!(((prefix == 'Z' || prefix == 'D') && numeric) ||
+              ((prefix == 'R') && (numeric || elmType == "LOG" || elmType == "CHA"))))
+        {
+            OPM_THROW(std::runtime_error, "Error, unknown array type '" + tmpStrType +"'");
+        }
+
+        layout = prefix;
+
+        if (elmType == "INT")
+            arrType = Opm::EclIO::INTE;
+        else if (elmType == "REA")
+            arrType = Opm::EclIO::REAL;
+        else if (elmType == "DOU")
+            arrType = Opm::EclIO::DOUB;
+        else if (elmType == "LOG")
+            arrType = Opm::EclIO::LOGI;
+        else
+            arrType = Opm::EclIO::CHAR;
+    }
 }
 
 
@@ -287,6 +316,124 @@ std::vector<std::string> readBinaryCharArray(std::fstream& fileH, const int size
 }
 
 
+// Read the reference record of an array stored relative to an earlier
+// report step: the SEQNUM value of that report step.
+int readReferenceRecord(std::fstream& fileH)
+{
+    int dhead;
+    fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+    dhead = Opm::EclIO::flipEndianInt(dhead);
+
+    if (dhead != Opm::EclIO::sizeOfInte) {
+        OPM_THROW(std::runtime_error, "Error reading referencing array, inconsistent reference record");
+    }
+
+    int seqnum;
+    fileH.read(reinterpret_cast<char*>(&seqnum), sizeof(seqnum));
+    seqnum = Opm::EclIO::flipEndianInt(seqnum);
+
+    int dtail;
+    fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
+    dtail = Opm::EclIO::flipEndianInt(dtail);
+
+    if (!fileH || (dhead != dtail)) {
+        OPM_THROW(std::runtime_error, "Error reading referencing array, tail not matching header.");
+    }
+
+    return seqnum;
+}
+
+
+// Read the index record of a compressed array: the number of elements
+// per block followed by the number of bytes of each block.
+std::vector<int> readCompressedIndex(std::fstream& fileH)
+{
+    int dhead;
+    fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+    dhead = Opm::EclIO::flipEndianInt(dhead);
+
+    if ((dhead < Opm::EclIO::sizeOfInte) || (dhead % Opm::EclIO::sizeOfInte != 0)) {
+        OPM_THROW(std::runtime_error, "Error reading compressed array, inconsistent index record");
+    }
+
+    std::vector<int> index(dhead / Opm::EclIO::sizeOfInte);
+    fileH.read(reinterpret_cast<char*>(index.data()), dhead);
+
+    for (auto& value : index) {
+        value = Opm::EclIO::flipEndianInt(value);
+    }
+
+    int dtail;
+    fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
+    dtail = Opm::EclIO::flipEndianInt(dtail);
+
+    if (!fileH || (dhead != dtail)) {
+        OPM_THROW(std::runtime_error, "Error reading compressed array, tail not matching header.");
+    }
+
+    if (std::any_of(index.begin(), index.end(), [](const int value) { return value <= 0; })) {
+        OPM_THROW(std::runtime_error, "Error reading compressed array, inconsistent index record");
+    }
+
+    return index;
+}
+
+
+unsigned long int sizeOnDiskCompressedBlocks(const std::vector<int>& index)
+{
+    unsigned long int size = 0;
+
+    for (auto block = index.begin() + 1; block != index.end(); ++block) {
+        size += *block + 2 * Opm::EclIO::sizeOfInte;
+    }
+
+    return size;
+}
+
+
+template <typename T>
+std::vector<T> readCompressedArray(std::fstream& fileH, const int size,
+                                   const std::vector<T>* base = nullptr)
+{
+    const auto index = readCompressedIndex(fileH);
+
+    std::vector<std::vector<char>> blocks;
+    blocks.reserve(index.size() - 1);
+
+    for (auto bytes = index.begin() + 1; bytes != index.end(); ++bytes) {
+        int dhead;
+        fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        dhead = Opm::EclIO::flipEndianInt(dhead);
+
+        if (dhead != *bytes) {
+            OPM_THROW(std::runtime_error, "Error reading compressed array, block size not matching index");
+        }
+
+        blocks.emplace_back(dhead);
+        fileH.read(blocks.back().data(), dhead);
+
+        int dtail;
+        fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
+        dtail = Opm::EclIO::flipEndianInt(dtail);
+
+        if (!fileH || (dhead != dtail)) {
+            OPM_THROW(std::runtime_error, "Error reading compressed array, tail not matching header.");
+        }
+    }
+
+    std::vector<T> arr(size);
+
+    if (base == nullptr) {
+        Opm::EclIO::Compress::decodeBlocks(blocks, index[0], arr.data(), arr.size());
+    }
+    else {
+        Opm::EclIO::Compress::decodeBlocks(blocks, index[0], arr.data(), base->data(), arr.size());
+    }
+
+    return arr;
+}
+
+
 std::vector<std::string> split_string(const std::string& inputStr)
 {
     std::istringstream iss(inputStr);
@@ -521,15 +668,17 @@ EclFile::EclFile(const std::string& filename) : inputFilename(filename)
         std::string arrName(8,' ');
         eclArrType arrType;
         int num;
+        char layout = '\0';
 
         if (formatted) {
             readFormattedHeader(fileH,arrName,num,arrType);
         } else {
-            readBinaryHeader(fileH,arrName,num,arrType);
+            readBinaryHeader(fileH,arrName,num,arrType,layout);
         }
 
         array_size.push_back(num);
         array_type.push_back(arrType);
+        arrayLayout.push_back(layout);
 
         array_name.push_back(trimr(arrName));
         array_index[array_name[n]] = n;
@@ -539,9 +688,17 @@ EclFile::EclFile(const std::string& filename) : inputFilename(filename)
 
         arrayLoaded.push_back(false);
 
+        array_reference.push_back((layout == 'D' || layout == 'R') ? readReferenceRecord(fileH) : -1);
+        array_base.push_back(-1);
+
         if (formatted) {
             unsigned long int sizeOfNextArray = sizeOnDiskFormatted(num, arrType);
             fileH.ignore(sizeOfNextArray);
+        } else if (layout == 'R') {
+            // Nothing but the reference record.
+        } else if (layout == 'Z' || layout == 'D') {
+            unsigned long int sizeOfNextArray = sizeOnDiskCompressedBlocks(readCompressedIndex(fileH));
+            fileH.ignore(sizeOfNextArray);
         } else {
             unsigned long int sizeOfNextArray = sizeOnDiskBinary(num, arrType);
             fileH.ignore(sizeOfNextArray);
@@ -557,78 +714,173 @@ EclFile::EclFile(const std::string& filename) : inputFilename(filename)
 }
 
 
+void EclFile::openInputStream(std::fstream& fileH) const
+{
+    if (formatted) {
+        fileH.open(inputFilename, std::ios::in);
+    } else {
+        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+    }
+
+    if (!fileH) {
+        std::string message="Could not open file: '" + inputFilename +"'";
+        OPM_THROW(std::runtime_error, message);
+    }
+}
+
+
+template <typename T>
+void EclFile::storeArray(std::unordered_map<int, std::vector<T>>& array,
+                         int arrIndex, std::vector<T>&& data)
+{
+#pragma omp critical(EclFile_storeArray)
+    {
+        array[arrIndex] = std::move(data);
+        arrayLoaded[arrIndex] = true;
+    }
+}
+
+
 void EclFile::loadArray(std::fstream& fileH, int arrIndex)
 {
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
 
-    if (formatted) {
-        switch (array_type[arrIndex]) {
-        case INTE:
-            inte_array[arrIndex] = readFormattedInteArray(fileH, array_size[arrIndex]);
-            break;
-        case REAL:
-            real_array[arrIndex] = readFormattedRealArray(fileH, array_size[arrIndex]);
-            break;
-        case DOUB:
-            doub_array[arrIndex] = readFormattedDoubArray(fileH, array_size[arrIndex]);
-            break;
-        case LOGI:
-            logi_array[arrIndex] = readFormattedLogiArray(fileH, array_size[arrIndex]);
-            break;
-        case CHAR:
-            char_array[arrIndex] = readFormattedCharArray(fileH, array_size[arrIndex]);
-            break;
-        case MESS:
-            break;
-        default:
-            OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
-            break;
-        }
+    const auto size = array_size[arrIndex];
 
-    } else {
+    switch (arrayLayout[arrIndex]) {
+    case 'Z':
         switch (array_type[arrIndex]) {
         case INTE:
-            inte_array[arrIndex] = readBinaryInteArray(fileH, array_size[arrIndex]);
-            break;
+            storeArray(inte_array, arrIndex, readCompressedArray<int>(fileH, size));
+            return;
         case REAL:
-            real_array[arrIndex] = readBinaryRealArray(fileH, array_size[arrIndex]);
-            break;
+            storeArray(real_array, arrIndex, readCompressedArray<float>(fileH, size));
+            return;
         case DOUB:
-            doub_array[arrIndex] = readBinaryDoubArray(fileH, array_size[arrIndex]);
-            break;
-        case LOGI:
-            logi_array[arrIndex] = readBinaryLogiArray(fileH, array_size[arrIndex]);
-            break;
-        case CHAR:
-            char_array[arrIndex] = readBinaryCharArray(fileH, array_size[arrIndex]);
-            break;
-        case MESS:
-            break;
+            storeArray(doub_array, arrIndex, readCompressedArray<double>(fileH, size));
+            return;
         default:
-            OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
-            break;
+            OPM_THROW(std::runtime_error, "Asked to read unexpected compressed array type");
         }
+    case 'D':
+    case 'R':
+        loadReferencingArray(fileH, arrIndex);
+        return;
+    default:
+        break;
     }
 
-    arrayLoaded[arrIndex] = true;
+    switch (array_type[arrIndex]) {
+    case INTE:
+        storeArray(inte_array, arrIndex, formatted ? readFormattedInteArray(fileH, size)
+                                                   : readBinaryInteArray(fileH, size));
+        break;
+    case REAL:
+        storeArray(real_array, arrIndex, formatted ? readFormattedRealArray(fileH, size)
+                                                   : readBinaryRealArray(fileH, size));
+        break;
+    case DOUB:
+        storeArray(doub_array, arrIndex, formatted ? readFormattedDoubArray(fileH, size)
+                                                   : readBinaryDoubArray(fileH, size));
+        break;
+    case LOGI:
+        storeArray(logi_array, arrIndex, formatted ? readFormattedLogiArray(fileH, size)
+                                                   : readBinaryLogiArray(fileH, size));
+        break;
+    case CHAR:
+        storeArray(char_array, arrIndex, formatted ? readFormattedCharArray(fileH, size)
+                                                   : readBinaryCharArray(fileH, size));
+        break;
+    case MESS:
+#pragma omp critical(EclFile_storeArray)
+        arrayLoaded[arrIndex] = true;
+        break;
+    default:
+        OPM_THROW(std::runtime_error, "Asked to read unexpected array type");
+        break;
+    }
 }
 
 
-void EclFile::loadData()
+template <typename T>
+const std::vector<T>&
+EclFile::baseArray(std::fstream& fileH,
+                   const std::unordered_map<int, std::vector<T>>& array,
+                   int arrIndex)
 {
-    std::fstream fileH;
+    const auto base = array_base[arrIndex];
 
-    if (formatted) {
-        fileH.open(inputFilename, std::ios::in);
-    } else {
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+    if (base < 0) {
+        std::string message = "Array " + array_name[arrIndex] + " refers to report step "
+            + std::to_string(array_reference[arrIndex]) + " which is not available";
+        OPM_THROW(std::runtime_error, message);
     }
 
-    if (!fileH) {
-        std::string message="Could not open file: '" + inputFilename +"'";
-        OPM_THROW(std::runtime_error, message);
+    bool loaded;
+#pragma omp critical(EclFile_storeArray)
+    loaded = arrayLoaded[base];
+
+    if (!loaded) {
+        loadArray(fileH, base);
     }
 
+    // Other threads only ever insert other arrays, which leaves this
+    // element in place.
+    const std::vector<T>* data;
+#pragma omp critical(EclFile_storeArray)
+    data = &array.at(base);
+
+    return *data;
+}
+
+
+void EclFile::loadReferencingArray(std::fstream& fileH, int arrIndex)
+{
+    const auto size = array_size[arrIndex];
+    const auto delta = arrayLayout[arrIndex] == 'D';
+
+    switch (array_type[arrIndex]) {
+    case INTE:
+    {
+        const auto& base = baseArray(fileH, inte_array, arrIndex);
+        fileH.seekg(ifStreamPos[arrIndex] + 3 * sizeOfInte, fileH.beg);
+        storeArray(inte_array, arrIndex, delta ? readCompressedArray<int>(fileH, size, &base)
+                                               : std::vector<int>(base));
+        break;
+    }
+    case REAL:
+    {
+        const auto& base = baseArray(fileH, real_array, arrIndex);
+        fileH.seekg(ifStreamPos[arrIndex] + 3 * sizeOfInte, fileH.beg);
+        storeArray(real_array, arrIndex, delta ? readCompressedArray<float>(fileH, size, &base)
+                                               : std::vector<float>(base));
+        break;
+    }
+    case DOUB:
+    {
+        const auto& base = baseArray(fileH, doub_array, arrIndex);
+        fileH.seekg(ifStreamPos[arrIndex] + 3 * sizeOfInte, fileH.beg);
+        storeArray(doub_array, arrIndex, delta ? readCompressedArray<double>(fileH, size, &base)
+                                               : std::vector<double>(base));
+        break;
+    }
+    case LOGI:
+        storeArray(logi_array, arrIndex, std::vector<bool>(baseArray(fileH, logi_array, arrIndex)));
+        break;
+    case CHAR:
+        storeArray(char_array, arrIndex, std::vector<std::string>(baseArray(fileH, char_array, arrIndex)));
+        break;
+    default:
+        OPM_THROW(std::runtime_error, "Asked to read unexpected referencing array type");
+    }
+}
+
+
+void EclFile::loadData()
+{
+    std::fstream fileH;
+    openInputStream(fileH);
+
     for (size_t i = 0; i < array_name.size(); i++) {
         loadArray(fileH, i);
     }
@@ -640,17 +892,7 @@ void EclFile::loadData()
 void EclFile::loadData(const std::string& name)
 {
     std::fstream fileH;
-
-    if (formatted) {
-        fileH.open(inputFilename, std::ios::in);
-    } else {
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-    }
-
-    if (!fileH) {
-        std::string message="Could not open file: '" + inputFilename +"'";
-        OPM_THROW(std::runtime_error, message);
-    }
+    openInputStream(fileH);
 
     for (size_t i = 0; i < array_name.size(); i++) {
         if (array_name[i] == name) {
@@ -664,41 +906,84 @@ void EclFile::loadData(const std::string& name)
 
 void EclFile::loadData(const std::vector<int>& arrIndex)
 {
-    std::fstream fileH;
+    // Fail early, and on the calling thread, if the file is unreadable.
+    {
+        std::fstream fileH;
+        openInputStream(fileH);
+    }
 
-    if (formatted) {
-        fileH.open(inputFilename, std::ios::in);
-    } else {
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+    // The arrays are independent, so each thread reads its share of them
+    // through a stream of its own; only storing the arrays is serialised.
+    auto loadArrays = [this](const std::vector<int>& indices)
+    {
+        const auto numArrays = static_cast<int>(indices.size());
+        std::exception_ptr error;
+
+#pragma omp parallel
+        {
+            std::fstream fileH;
+
+            try {
+                openInputStream(fileH);
+            }
+            catch (...) {
+#pragma omp critical(EclFile_loadError)
+                if (!error) { error = std::current_exception(); }
+            }
+
+#pragma omp for schedule(dynamic)
+            for (int i = 0; i < numArrays; i++) {
+                if (!fileH.is_open()) { continue; }
+
+                try {
+                    loadArray(fileH, indices[i]);
+                }
+                catch (...) {
+#pragma omp critical(EclFile_loadError)
+                    if (!error) { error = std::current_exception(); }
+                }
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    };
+
+    // Arrays stored relative to an earlier report step need the array
+    // they refer to, which is therefore loaded first, and only once.
+    std::vector<int> bases;
+    for (const auto& ind : arrIndex) {
+        const auto base = array_base[ind];
+
+        if ((base >= 0) && !arrayLoaded[base] &&
+            (std::find(bases.begin(), bases.end(), base) == bases.end()))
+        {
+            bases.push_back(base);
+        }
     }
 
-    if (!fileH) {
-        std::string message="Could not open file: '" + inputFilename +"'";
-        OPM_THROW(std::runtime_error, message);
+    if (bases.empty()) {
+        loadArrays(arrIndex);
+        return;
     }
 
-    for (int ind : arrIndex) {
-        loadArray(fileH, ind);
+    std::vector<int> others;
+    for (const auto& ind : arrIndex) {
+        if (std::find(bases.begin(), bases.end(), ind) == bases.end()) {
+            others.push_back(ind);
+        }
     }
 
-    fileH.close();
+    loadArrays(bases);
+    loadArrays(others);
 }
 
 
 void EclFile::loadData(int arrIndex)
 {
     std::fstream fileH;
-
-    if (formatted) {
-        fileH.open(inputFilename, std::ios::in);
-    } else {
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-    }
-
-    if (!fileH) {
-        std::string message="Could not open file: '" + inputFilename +"'";
-        OPM_THROW(std::runtime_error, message);
-    }
+    openInputStream(fileH);
 
     loadArray(fileH, arrIndex);
 
@@ -25,6 +25,7 @@
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
@@ -87,43 +88,211 @@ void EclOutput::message(const std::string& msg)
 }
 
 
-void EclOutput::writeBinaryHeader(const std::string&arrName, int size, eclArrType arrType)
+std::size_t EclOutput::elementsPerBlock(eclArrType arrType) const
 {
-    std::string name = arrName + std::string(8 - arrName.size(),' ');
+    // Generated arrays are split on the record boundaries of the output
+    // file, so writing them block by block produces the same file as
+    // writing the complete array in one go.
+    if (isFormatted)
+        return std::get<0>(block_size_data_formatted(arrType));
 
-    int flippedSize = flipEndianInt(size);
-    int bhead = flipEndianInt(16);
+    const auto sizeData = block_size_data_binary(arrType);
+    return std::get<1>(sizeData) / std::get<0>(sizeData);
+}
 
-    ofileH.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
 
-    ofileH.write(name.c_str(), 8);
-    ofileH.write(reinterpret_cast<char*>(&flippedSize), sizeof(flippedSize));
+void EclOutput::compressArrays(const bool compress)
+{
+    this->isCompressed = compress;
+}
+
+
+bool EclOutput::compressible(eclArrType arrType, std::size_t size) const
+{
+    return !this->isFormatted && this->isCompressed
+        && ((arrType == INTE) || (arrType == REAL) || (arrType == DOUB))
+        && (size >= Compress::minArraySize);
+}
+
+
+bool EclOutput::writeCompressed(const std::string& name, const std::vector<int>& data)
+{
+    if (!this->compressible(INTE, data.size()))
+        return false;
+
+    writeBinaryHeader(name, data.size(), INTE, 'Z');
+    writeCompressedBlocks(Compress::encodeBlocks(data.data(), data.size()));
+
+    return true;
+}
+
+
+bool EclOutput::writeCompressed(const std::string& name, const std::vector<float>& data)
+{
+    if (!this->compressible(REAL, data.size()))
+        return false;
+
+    writeBinaryHeader(name, data.size(), REAL, 'Z');
+    writeCompressedBlocks(Compress::encodeBlocks(data.data(), data.size()));
+
+    return true;
+}
+
+
+bool EclOutput::writeCompressed(const std::string& name, const std::vector<double>& data)
+{
+    if (!this->compressible(DOUB, data.size()))
+        return false;
+
+    writeBinaryHeader(name, data.size(), DOUB, 'Z');
+    writeCompressedBlocks(Compress::encodeBlocks(data.data(), data.size()));
+
+    return true;
+}
+
+
+void EclOutput::writeCompressedBlocks(const std::vector<std::vector<char>>& blocks)
+{
+    std::vector<std::size_t> blockBytes;
+    blockBytes.reserve(blocks.size());
+
+    for (const auto& block : blocks)
+        blockBytes.push_back(block.size());
+
+    writeBlockIndex(blockBytes);
+
+    for (const auto& block : blocks)
+        writeBlock(block);
+}
+
+
+void EclOutput::writeBlockIndex(const std::vector<std::size_t>& blockBytes)
+{
+    if (!ofileH.is_open()) {
+        OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
+    }
+
+    // Index record: number of elements per block followed by the number
+    // of bytes of each block.
+    std::vector<int> index;
+    index.reserve(blockBytes.size() + 1);
 
+    index.push_back(flipEndianInt(static_cast<int>(Compress::blockSize)));
+    for (const auto& bytes : blockBytes)
+        index.push_back(flipEndianInt(static_cast<int>(bytes)));
+
+    int dhead = flipEndianInt(static_cast<int>(index.size() * sizeof(int)));
+
+    ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+    ofileH.write(reinterpret_cast<char*>(index.data()), index.size() * sizeof(int));
+    ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+}
+
+
+void EclOutput::writeBlock(const std::vector<char>& block)
+{
+    int dhead = flipEndianInt(static_cast<int>(block.size()));
+
+    ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+    ofileH.write(block.data(), block.size());
+    ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+}
+
+
+void EclOutput::writeBinaryHeader(const std::string&arrName, int size, eclArrType arrType,
+                                  const char layout)
+{
+    std::string name = arrName + std::string(8 - arrName.size(),' ');
+
+    std::string typeStr;
     switch(arrType) {
     case INTE:
-        ofileH.write("INTE", 4);
+        typeStr = "INTE";
         break;
     case REAL:
-        ofileH.write("REAL", 4);
+        typeStr = "REAL";
         break;
     case DOUB:
-        ofileH.write("DOUB", 4);
+        typeStr = "DOUB";
         break;
     case LOGI:
-        ofileH.write("LOGI", 4);
+        typeStr = "LOGI";
         break;
     case CHAR:
-        ofileH.write("CHAR", 4);
+        typeStr = "CHAR";
         break;
     case MESS:
-        ofileH.write("MESS", 4);
+        typeStr = "MESS";
         break;
     }
 
+    // Compressed and referencing arrays, see EclCompress.hpp.
+    if (layout != '\0')
+        typeStr = layout + typeStr.substr(0, 3);
+
+    int flippedSize = flipEndianInt(size);
+    int bhead = flipEndianInt(16);
+
+    ofileH.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
+
+    ofileH.write(name.c_str(), 8);
+    ofileH.write(reinterpret_cast<char*>(&flippedSize), sizeof(flippedSize));
+    ofileH.write(typeStr.c_str(), 4);
+
     ofileH.write(reinterpret_cast<char *>(&bhead), sizeof(bhead));
 }
 
 
+void EclOutput::writeReferenceRecord(const int seqnum)
+{
+    int dhead = flipEndianInt(sizeOfInte);
+    int value = flipEndianInt(seqnum);
+
+    ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+    ofileH.write(reinterpret_cast<char*>(&value), sizeof(value));
+    ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+}
+
+
+void EclOutput::writeReference(const std::string& name, const std::size_t size,
+                               const eclArrType arrType, const int seqnum)
+{
+    writeBinaryHeader(name, size, arrType, 'R');
+    writeReferenceRecord(seqnum);
+}
+
+
+void EclOutput::writeDelta(const std::string& name, const std::size_t size,
+                           const eclArrType arrType, const int seqnum,
+                           const std::vector<std::vector<char>>& blocks)
+{
+    writeBinaryHeader(name, size, arrType, 'D');
+    writeReferenceRecord(seqnum);
+    writeCompressedBlocks(blocks);
+}
+
+
+void EclOutput::writeDelta(const std::string& name, const std::size_t size,
+                           const eclArrType arrType, const int seqnum,
+                           const std::vector<std::size_t>& blockBytes,
+                           const std::function<std::vector<char>(std::size_t)>& block)
+{
+    writeBinaryHeader(name, size, arrType, 'D');
+    writeReferenceRecord(seqnum);
+    writeBlockIndex(blockBytes);
+
+    for (std::size_t i = 0; i < blockBytes.size(); ++i) {
+        const auto data = block(i);
+        if (data.size() != blockBytes[i]) {
+            OPM_THROW(std::logic_error, "Compressed block " << i << " of array " << name
+                      << " differs from its size in the index record");
+        }
+
+        writeBlock(data);
+    }
+}
+
+
 template <typename T>
 void EclOutput::writeBinaryArray(const std::vector<T>& data)
 {
@@ -158,6 +327,11 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
         OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
     }
 
+    // Each record is byte swapped into this buffer and written with a
+    // single call to ofileH.write().
+    std::vector<char> buffer;
+    buffer.reserve(std::min(size, maxNumberOfElements) * sizeOfElement);
+
     rest = size * sizeOfElement;
     while (rest > 0) {
         if (rest > maxBlockSize) {
@@ -172,32 +346,36 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
 
+        buffer.resize(num * sizeOfElement);
+        char* pos = buffer.data();
+
         for (int i = 0; i < num; i++) {
             if (arrType == INTE) {
                 rval = flipEndianInt(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&rval), sizeof(rval));
+                std::memcpy(pos, &rval, sizeof(rval));
             } else if (arrType == REAL) {
                 value_f = flipEndianFloat(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&value_f), sizeof(value_f));
+                std::memcpy(pos, &value_f, sizeof(value_f));
             } else if (arrType == DOUB) {
                 value_d = flipEndianDouble(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&value_d), sizeof(value_d));
+                std::memcpy(pos, &value_d, sizeof(value_d));
             } else if (arrType == LOGI) {
                 intVal = data[n] ? true_value : false_value;
-                ofileH.write(reinterpret_cast<char*>(&intVal), sizeOfElement);
+                std::memcpy(pos, &intVal, sizeOfElement);
             } else {
                 std::cerr << "type not supported in write binaryarray\n";
                 std::exit(EXIT_FAILURE);
             }
 
+            pos += sizeOfElement;
             n++;
         }
 
+        ofileH.write(buffer.data(), buffer.size());
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
 }
 
-
 template void EclOutput::writeBinaryArray<int>(const std::vector<int>& data);
 template void EclOutput::writeBinaryArray<float>(const std::vector<float>& data);
 template void EclOutput::writeBinaryArray<double>(const std::vector<double>& data);
@@ -19,9 +19,12 @@
 
 #include <opm/io/eclipse/OutputStream.hpp>
 
+#include <opm/io/eclipse/EclCompress.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <exception>
 #include <fstream>
 #include <iomanip>
@@ -30,6 +33,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <boost/filesystem.hpp>
@@ -59,6 +63,11 @@ namespace {
 
             return ext.str();
         }
+
+        std::string rft(const bool formatted)
+        {
+            return formatted ? "FRFT" : "RFT";
+        }
     } // namespace FileExtension
 
     namespace Open
@@ -128,11 +137,202 @@ namespace {
                 };
             }
         } // namespace Restart
+
+        namespace Rft
+        {
+            std::unique_ptr<Opm::EclIO::EclOutput>
+            write(const std::string& filename,
+                  const bool         isFmt,
+                  const bool         existing)
+            {
+                return std::unique_ptr<Opm::EclIO::EclOutput> {
+                    new Opm::EclIO::EclOutput {
+                        filename, isFmt,
+                        existing ? std::ios_base::app : std::ios_base::out
+                    }
+                };
+            }
+        } // namespace Rft
     } // namespace Open
+
+    namespace Delta
+    {
+        // Representation of output arrays in Restart's DeltaBase.
+        template <typename T>
+        const std::vector<T>& values(const std::vector<T>& data)
+        {
+            return data;
+        }
+
+        std::vector<std::string>
+        values(const std::vector<Opm::EclIO::PaddedOutputString<8>>& data)
+        {
+            auto strings = std::vector<std::string>{};
+            strings.reserve(data.size());
+
+            for (const auto& s : data) {
+                strings.emplace_back(s.c_str());
+            }
+
+            return strings;
+        }
+
+        // Size of the values of a retained array.
+        template <typename T>
+        std::size_t bytes(const std::vector<T>& data)
+        {
+            return data.size() * sizeof(T);
+        }
+
+        std::size_t bytes(const std::vector<bool>& data)
+        {
+            return (data.size() + 7) / 8;
+        }
+
+        std::size_t bytes(const std::vector<std::string>& data)
+        {
+            auto n = std::size_t{0};
+            for (const auto& s : data) {
+                n += s.size();
+            }
+
+            return n;
+        }
+
+        Opm::EclIO::eclArrType arrayType(const std::vector<int>&)         { return Opm::EclIO::INTE; }
+        Opm::EclIO::eclArrType arrayType(const std::vector<bool>&)        { return Opm::EclIO::LOGI; }
+        Opm::EclIO::eclArrType arrayType(const std::vector<float>&)       { return Opm::EclIO::REAL; }
+        Opm::EclIO::eclArrType arrayType(const std::vector<double>&)      { return Opm::EclIO::DOUB; }
+        Opm::EclIO::eclArrType arrayType(const std::vector<std::string>&) { return Opm::EclIO::CHAR; }
+
+        // Numeric arrays are compared bitwise, since the referencing
+        // array must reproduce the original values exactly.
+        template <typename T>
+        bool equal(const std::vector<T>& x, const std::vector<T>& y)
+        {
+            return x == y;
+        }
+
+        template <typename T>
+        bool equalBits(const std::vector<T>& x, const std::vector<T>& y)
+        {
+            return (x.size() == y.size())
+                && (std::memcmp(x.data(), y.data(), x.size() * sizeof(T)) == 0);
+        }
+
+        bool equal(const std::vector<int>& x, const std::vector<int>& y)
+        {
+            return equalBits(x, y);
+        }
+
+        bool equal(const std::vector<float>& x, const std::vector<float>& y)
+        {
+            return equalBits(x, y);
+        }
+
+        bool equal(const std::vector<double>& x, const std::vector<double>& y)
+        {
+            return equalBits(x, y);
+        }
+
+        // Compressed differences from base, or nothing if they do not
+        // reduce the array to at most half its size.
+        template <typename T>
+        std::vector<std::vector<char>>
+        encodeNumeric(const std::vector<T>& data, const std::vector<T>& base)
+        {
+            auto blocks = Opm::EclIO::Compress::encodeBlocks(data.data(), base.data(), data.size());
+
+            auto bytes = std::size_t{0};
+            for (const auto& block : blocks) {
+                bytes += block.size();
+            }
+
+            if (2 * bytes > data.size() * sizeof(T)) {
+                blocks.clear();
+            }
+
+            return blocks;
+        }
+
+        template <typename T>
+        std::vector<std::vector<char>>
+        encode(const std::vector<T>&, const std::vector<T>&)
+        {
+            return {};
+        }
+
+        std::vector<std::vector<char>>
+        encode(const std::vector<int>& data, const std::vector<int>& base)
+        {
+            return encodeNumeric(data, base);
+        }
+
+        std::vector<std::vector<char>>
+        encode(const std::vector<float>& data, const std::vector<float>& base)
+        {
+            return encodeNumeric(data, base);
+        }
+
+        std::vector<std::vector<char>>
+        encode(const std::vector<double>& data, const std::vector<double>& base)
+        {
+            return encodeNumeric(data, base);
+        }
+    } // namespace Delta
 } // Anonymous namespace
 
 // =====================================================================
 
+Opm::EclIO::OutputStream::ArrayWriter::~ArrayWriter()
+{}
+
+// =====================================================================
+
+Opm::EclIO::OutputStream::DeltaBase::DeltaBase(const std::size_t maxBytes)
+    : maxBytes_(maxBytes)
+{}
+
+std::size_t Opm::EclIO::OutputStream::DeltaBase::retainedBytes() const
+{
+    return this->retainedBytes_;
+}
+
+void Opm::EclIO::OutputStream::DeltaBase::clear()
+{
+    this->retainedBytes_ = 0;
+
+    this->inte_.clear();
+    this->logi_.clear();
+    this->real_.clear();
+    this->doub_.clear();
+    this->char_.clear();
+}
+
+void Opm::EclIO::OutputStream::DeltaBase::discardFrom(const int seqnum)
+{
+    auto discard = [this, seqnum](auto& entries)
+    {
+        for (auto e = entries.begin(); e != entries.end(); ) {
+            if (e->second.seqnum >= seqnum) {
+                this->retainedBytes_ -= Delta::bytes(e->second.data);
+                e = entries.erase(e);
+            }
+            else {
+                ++e;
+            }
+        }
+    };
+
+    discard(this->inte_);
+    discard(this->logi_);
+    discard(this->real_);
+    discard(this->doub_);
+    discard(this->char_);
+}
+
+// =====================================================================
+
 Opm::EclIO::OutputStream::Init::
 Init(const ResultSet& rset,
      const Formatted& fmt)
@@ -157,6 +357,11 @@ Opm::EclIO::OutputStream::Init::operator=(Init&& rhs)
     return *this;
 }
 
+void Opm::EclIO::OutputStream::Init::message(const std::string& msg)
+{
+    this->stream().message(msg);
+}
+
 void
 Opm::EclIO::OutputStream::Init::
 write(const std::string& kw, const std::vector<int>& data)
@@ -185,6 +390,30 @@ write(const std::string& kw, const std::vector<double>& data)
     this->writeImpl(kw, data);
 }
 
+void
+Opm::EclIO::OutputStream::Init::
+write(const std::string&           kw,
+      const std::size_t            size,
+      const SinglePrecisionSource& source)
+{
+    this->stream().write<float>(kw, size, source);
+}
+
+void
+Opm::EclIO::OutputStream::Init::
+write(const std::string& kw, const std::vector<std::string>& data)
+{
+    this->writeImpl(kw, data);
+}
+
+void
+Opm::EclIO::OutputStream::Init::
+write(const std::string&                        kw,
+      const std::vector<PaddedOutputString<8>>& data)
+{
+    this->writeImpl(kw, data);
+}
+
 void
 Opm::EclIO::OutputStream::Init::
 open(const std::string& fname,
@@ -217,6 +446,26 @@ Restart(const ResultSet& rset,
         const int        seqnum,
         const Formatted& fmt,
         const Unified&   unif)
+    : Restart(rset, seqnum, fmt, unif, Compressed{ false })
+{}
+
+Opm::EclIO::OutputStream::Restart::
+Restart(const ResultSet&  rset,
+        const int         seqnum,
+        const Formatted&  fmt,
+        const Unified&    unif,
+        const Compressed& compr)
+    : Restart(rset, seqnum, fmt, unif, compr, nullptr)
+{}
+
+Opm::EclIO::OutputStream::Restart::
+Restart(const ResultSet&  rset,
+        const int         seqnum,
+        const Formatted&  fmt,
+        const Unified&    unif,
+        const Compressed& compr,
+        DeltaBase*        deltas)
+    : seqnum_{ seqnum }
 {
     const auto ext = FileExtension::
         restart(seqnum, fmt.set, unif.set);
@@ -225,7 +474,23 @@ Restart(const ResultSet& rset,
 
     if (unif.set) {
         // Run uses unified restart files.
-        this->openUnified(fname, fmt.set, seqnum);
+        const auto isNew = this->openUnified(fname, fmt.set, seqnum);
+
+        if ((deltas != nullptr) && !fmt.set) {
+            // Arrays of this and later report steps replace those that
+            // may already exist in the file, and a new file has no
+            // arrays to refer to.
+            if (isNew) {
+                deltas->clear();
+            }
+            else {
+                deltas->discardFrom(seqnum);
+            }
+
+            this->deltas_ = deltas;
+        }
+
+        this->stream_->compressArrays(compr.set);
 
         // Write SEQNUM value to stream to start new output sequence.
         this->stream_->write("SEQNUM", std::vector<int>{ seqnum });
@@ -234,6 +499,8 @@ Restart(const ResultSet& rset,
         // Run uses separate, not unified, restart files.  Create a
         // new output file and open an output stream on it.
         this->openNew(fname, fmt.set);
+
+        this->stream_->compressArrays(compr.set);
     }
 }
 
@@ -242,12 +509,16 @@ Opm::EclIO::OutputStream::Restart::~Restart()
 
 Opm::EclIO::OutputStream::Restart::Restart(Restart&& rhs)
     : stream_{ std::move(rhs.stream_) }
+    , seqnum_{ rhs.seqnum_ }
+    , deltas_{ rhs.deltas_ }
 {}
 
 Opm::EclIO::OutputStream::Restart&
 Opm::EclIO::OutputStream::Restart::operator=(Restart&& rhs)
 {
     this->stream_ = std::move(rhs.stream_);
+    this->seqnum_ = rhs.seqnum_;
+    this->deltas_ = rhs.deltas_;
 
     return *this;
 }
@@ -285,6 +556,106 @@ write(const std::string& kw, const std::vector<double>& data)
     this->writeImpl(kw, data);
 }
 
+void
+Opm::EclIO::OutputStream::Restart::
+write(const std::string&           kw,
+      const std::size_t            size,
+      const SinglePrecisionSource& source)
+{
+    if ((this->deltas_ == nullptr) || (size < DeltaBase::minArraySize)) {
+        this->stream().write<float>(kw, size, source);
+        return;
+    }
+
+    if (this->writeReferencing(kw, size, source)) {
+        return;
+    }
+
+    if (! this->retainable<float>(kw, size * sizeof(float))) {
+        this->stream().write<float>(kw, size, source);
+        return;
+    }
+
+    // The retained copy is filled while the array is written, so the
+    // values are never held outside the DeltaBase.
+    auto retained = std::vector<float>(size);
+    this->stream().write<float>(kw, size,
+        [&source, &retained](const std::size_t begin,
+                             const std::size_t end,
+                             float*            block)
+    {
+        source(begin, end, block);
+        std::copy(block, block + (end - begin), retained.begin() + begin);
+    });
+
+    this->retain(kw, std::move(retained));
+}
+
+bool
+Opm::EclIO::OutputStream::Restart::
+writeReferencing(const std::string&           kw,
+                 const std::size_t            size,
+                 const SinglePrecisionSource& source)
+{
+    const auto& entries = this->deltas_->real_;
+
+    auto e = entries.find(kw);
+    if ((e == entries.end()) ||
+        (e->second.seqnum == this->seqnum_) ||
+        (e->second.data.size() != size))
+    {
+        return false;
+    }
+
+    const auto& base = e->second;
+
+    // First pass: compare and compress one block at a time, keeping only
+    // the size of each compressed block.  Give up as soon as the
+    // compressed differences exceed half the size of the array.
+    auto blockBytes = std::vector<std::size_t>{};
+    blockBytes.reserve(Compress::numBlocks(size));
+
+    auto block = std::vector<float>(std::min(size, Compress::blockSize));
+    auto bytes = std::size_t{0};
+    auto equal = true;
+
+    for (auto begin = std::size_t{0}; begin < size; begin += Compress::blockSize) {
+        const auto n = std::min(size - begin, Compress::blockSize);
+        const auto* baseBlock = base.data.data() + begin;
+
+        source(begin, begin + n, block.data());
+
+        equal = equal && (std::memcmp(block.data(), baseBlock, n * sizeof(float)) == 0);
+
+        const auto encoded = Compress::encodeBlocks(block.data(), baseBlock, n);
+        blockBytes.push_back(encoded.front().size());
+
+        bytes += blockBytes.back();
+        if (2 * bytes > size * sizeof(float)) {
+            return false;
+        }
+    }
+
+    if (equal) {
+        this->stream().writeReference(kw, size, REAL, base.seqnum);
+        return true;
+    }
+
+    // Second pass: regenerate and compress each block while writing it.
+    this->stream().writeDelta(kw, size, REAL, base.seqnum, blockBytes,
+        [&source, &base, &block, size](const std::size_t i)
+    {
+        const auto begin = i * Compress::blockSize;
+        const auto n = std::min(size - begin, Compress::blockSize);
+
+        source(begin, begin + n, block.data());
+
+        return std::move(Compress::encodeBlocks(block.data(), base.data.data() + begin, n).front());
+    });
+
+    return true;
+}
+
 void
 Opm::EclIO::OutputStream::Restart::
 write(const std::string& kw, const std::vector<std::string>& data)
@@ -300,7 +671,7 @@ write(const std::string&                        kw,
     this->writeImpl(kw, data);
 }
 
-void
+bool
 Opm::EclIO::OutputStream::Restart::
 openUnified(const std::string& fname,
             const bool         formatted,
@@ -314,6 +685,8 @@ openUnified(const std::string& fname,
     if (rst == nullptr) {
         // No such unified restart file exists.  Create new file.
         this->openNew(fname, formatted);
+
+        return true;
     }
     else if (! rst->hasKey("SEQNUM")) {
         // File with correct filename exists but does not appear
@@ -331,6 +704,8 @@ openUnified(const std::string& fname,
         this->openExisting(fname, formatted,
                            rst->restartStepWritePosition(seqnum));
     }
+
+    return false;
 }
 
 void
@@ -390,12 +765,212 @@ namespace Opm { namespace EclIO { namespace OutputStream {
     template <typename T>
     void Restart::writeImpl(const std::string&    kw,
                             const std::vector<T>& data)
+    {
+        if ((this->deltas_ == nullptr) || (data.size() < DeltaBase::minArraySize)) {
+            this->stream().write(kw, data);
+            return;
+        }
+
+        const auto& values = Delta::values(data);
+
+        if (! this->writeReferencing(kw, values)) {
+            this->stream().write(kw, data);
+
+            using Value = typename std::decay<decltype(values)>::type::value_type;
+
+            if (this->retainable<Value>(kw, Delta::bytes(values))) {
+                auto retained = values;
+                this->retain(kw, std::move(retained));
+            }
+        }
+    }
+
+    template <typename T>
+    bool Restart::writeReferencing(const std::string&    kw,
+                                   const std::vector<T>& values)
+    {
+        const auto& entries = this->deltas_->entries(values);
+
+        // Repeated arrays of the same name within a report step are
+        // written in full, since only the first one may be referenced.
+        auto e = entries.find(kw);
+        if ((e == entries.end()) ||
+            (e->second.seqnum == this->seqnum_) ||
+            (e->second.data.size() != values.size()))
+        {
+            return false;
+        }
+
+        const auto& base = e->second;
+        const auto arrType = Delta::arrayType(values);
+
+        if (Delta::equal(values, base.data)) {
+            this->stream().writeReference(kw, values.size(), arrType, base.seqnum);
+            return true;
+        }
+
+        const auto blocks = Delta::encode(values, base.data);
+        if (blocks.empty()) {
+            return false;
+        }
+
+        this->stream().writeDelta(kw, values.size(), arrType, base.seqnum, blocks);
+        return true;
+    }
+
+    template <typename T>
+    bool Restart::retainable(const std::string& kw,
+                             const std::size_t  bytes) const
+    {
+        const auto& entries = this->deltas_->entries(std::vector<T>{});
+
+        // The array replaces the retained array of the same name, unless
+        // that was written to this report step.
+        auto replaced = std::size_t{0};
+
+        auto e = entries.find(kw);
+        if (e != entries.end()) {
+            if (e->second.seqnum == this->seqnum_) {
+                return false;
+            }
+
+            replaced = Delta::bytes(e->second.data);
+        }
+
+        return this->deltas_->retainedBytes_ - replaced + bytes
+            <= this->deltas_->maxBytes_;
+    }
+
+    template <typename T>
+    void Restart::retain(const std::string& kw,
+                         std::vector<T>&&   values)
+    {
+        auto& entries = this->deltas_->entries(values);
+
+        auto e = entries.find(kw);
+        if (e != entries.end()) {
+            this->deltas_->retainedBytes_ -= Delta::bytes(e->second.data);
+        }
+
+        this->deltas_->retainedBytes_ += Delta::bytes(values);
+
+        entries[kw] = DeltaBase::Entry<T>{ this->seqnum_, std::move(values) };
+    }
+
+}}}
+
+
+// =====================================================================
+
+Opm::EclIO::OutputStream::RFT::
+RFT(const ResultSet&    rset,
+    const Formatted&    fmt,
+    const OpenExisting& existing)
+{
+    const auto fname = outputFileName(rset, FileExtension::rft(fmt.set));
+
+    this->open(fname, fmt.set, existing.set);
+}
+
+Opm::EclIO::OutputStream::RFT::~RFT()
+{}
+
+Opm::EclIO::OutputStream::RFT::RFT(RFT&& rhs)
+    : stream_{ std::move(rhs.stream_) }
+{}
+
+Opm::EclIO::OutputStream::RFT&
+Opm::EclIO::OutputStream::RFT::operator=(RFT&& rhs)
+{
+    this->stream_ = std::move(rhs.stream_);
+
+    return *this;
+}
+
+void Opm::EclIO::OutputStream::RFT::message(const std::string& msg)
+{
+    this->stream().message(msg);
+}
+
+void
+Opm::EclIO::OutputStream::RFT::
+write(const std::string& kw, const std::vector<int>& data)
+{
+    this->writeImpl(kw, data);
+}
+
+void
+Opm::EclIO::OutputStream::RFT::
+write(const std::string& kw, const std::vector<bool>& data)
+{
+    this->writeImpl(kw, data);
+}
+
+void
+Opm::EclIO::OutputStream::RFT::
+write(const std::string& kw, const std::vector<float>& data)
+{
+    this->writeImpl(kw, data);
+}
+
+void
+Opm::EclIO::OutputStream::RFT::
+write(const std::string& kw, const std::vector<double>& data)
+{
+    this->writeImpl(kw, data);
+}
+
+void
+Opm::EclIO::OutputStream::RFT::
+write(const std::string&           kw,
+      const std::size_t            size,
+      const SinglePrecisionSource& source)
+{
+    this->stream().write<float>(kw, size, source);
+}
+
+void
+Opm::EclIO::OutputStream::RFT::
+write(const std::string& kw, const std::vector<std::string>& data)
+{
+    this->writeImpl(kw, data);
+}
+
+void
+Opm::EclIO::OutputStream::RFT::
+write(const std::string&                        kw,
+      const std::vector<PaddedOutputString<8>>& data)
+{
+    this->writeImpl(kw, data);
+}
+
+void
+Opm::EclIO::OutputStream::RFT::
+open(const std::string& fname,
+     const bool         formatted,
+     const bool         existing)
+{
+    this->stream_ = Open::Rft::write(fname, formatted, existing);
+}
+
+Opm::EclIO::EclOutput&
+Opm::EclIO::OutputStream::RFT::stream()
+{
+    return *this->stream_;
+}
+
+namespace Opm { namespace EclIO { namespace OutputStream {
+
+    template <typename T>
+    void RFT::writeImpl(const std::string&    kw,
+                        const std::vector<T>& data)
     {
         this->stream().write(kw, data);
     }
 
 }}}
 
+// =====================================================================
 
 std::string
 Opm::EclIO::OutputStream::outputFileName(const ResultSet&   rsetDescriptor,
@@ -18,6 +18,9 @@
  */
 
 #include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
 
 #include <opm/output/data/Solution.hpp>
 #include <opm/output/data/Cells.hpp>
@@ -28,6 +31,10 @@ namespace data {
 
 Solution::Solution( bool init_si ) : si( init_si ) {}
 
+bool Solution::isSI() const {
+    return this->si;
+}
+
 bool Solution::has(const std::string& keyword) const {
     return this->count( keyword ) > 0;
 }
@@ -48,14 +55,35 @@ std::pair< Solution::iterator, bool > Solution::insert( std::string name,
     return this->emplace( name, CellData{ m, std::move( xs ), type } );
 }
 
+namespace {
+
+    /*
+      The fields are independent of each other, so they are converted
+      concurrently; the map itself is not modified.
+    */
+    template <typename Convert>
+    void convertFields( std::map< std::string, data::CellData >& fields, Convert&& convert ) {
+        std::vector< data::CellData* > cells;
+        for (auto& elm : fields) {
+            if (elm.second.dim != UnitSystem::measure::identity)
+                cells.push_back( &elm.second );
+        }
+
+        const int num_cells = static_cast< int >( cells.size() );
+
+#pragma omp parallel for schedule(dynamic)
+        for (int i = 0; i < num_cells; i++)
+            convert( cells[i]->dim , cells[i]->data );
+    }
+
+}
+
 void data::Solution::convertToSI( const UnitSystem& units ) {
     if (this->si) return;
 
-    for( auto& elm : *this ) {
-        UnitSystem::measure dim = elm.second.dim;
-        if (dim != UnitSystem::measure::identity)
-            units.to_si( dim , elm.second.data );
-    }
+    convertFields( *this, [&units]( UnitSystem::measure dim, std::vector< double >& data ) {
+        units.to_si( dim , data );
+    });
 
     this->si = true;
 }
@@ -63,11 +91,9 @@ void data::Solution::convertToSI( const UnitSystem& units ) {
 void data::Solution::convertFromSI( const UnitSystem& units ) {
     if (!this->si) return;
 
-    for (auto& elm : *this ) {
-        UnitSystem::measure dim = elm.second.dim;
-        if (dim != UnitSystem::measure::identity)
-            units.from_si( dim , elm.second.data );
-    }
+    convertFields( *this, [&units]( UnitSystem::measure dim, std::vector< double >& data ) {
+        units.from_si( dim , data );
+    });
 
     this->si = false;
 }
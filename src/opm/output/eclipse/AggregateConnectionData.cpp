@@ -18,6 +18,7 @@
 */
 
 #include <opm/output/eclipse/AggregateConnectionData.hpp>
+#include <opm/output/eclipse/StaticWellCache.hpp>
 
 #include <opm/output/eclipse/VectorItems/connection.hpp>
 #include <opm/output/eclipse/VectorItems/intehead.hpp>
@@ -30,11 +31,13 @@
 
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <exception>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 
 namespace VI = Opm::RestartIO::Helpers::VectorItems;
@@ -77,45 +80,6 @@ namespace {
     }
 
 
-    template <class ConnOp>
-    void connectionLoop(const std::vector<Opm::Well2>& wells,
-                        const Opm::EclipseGrid&        grid,
-                        ConnOp&&                       connOp)
-    {
-        for (auto nWell = wells.size(), wellID = 0*nWell;
-             wellID < nWell; ++wellID)
-        {
-            const auto& well = wells[wellID];
-            const auto& conn0 = well.getConnections();
-            const auto& conns = Opm::WellConnections( conn0, grid );
-            const int niSI = static_cast<int>(conn0.size());
-            std::map <std::size_t, const Opm::Connection*> sIToConn;
-
-            //Branch according to MSW well or not and
-            //sort active connections according to appropriate seqIndex
-            if (well.isMultiSegment()) {
-                //sort connections according to input sequence in COMPSEGS
-                sIToConn = mapCompSegSeqIndexToConnection(conns);
-            } else {
-                //sort connections according to input sequence in COMPDAT
-                sIToConn = mapSeqIndexToConnection(conns);
-            }
-
-            std::vector<const Opm::Connection*> connSI;
-            for (int iSI = 0; iSI < niSI; iSI++) {
-                const auto searchSI = sIToConn.find(static_cast<std::size_t>(iSI));
-                if (searchSI != sIToConn.end()) {
-                    connSI.push_back(searchSI->second);
-                }
-            }
-            for (auto nConn = connSI.size(), connID = 0*nConn;
-                 connID < nConn; ++connID)
-            {
-                connOp(well, wellID, *(connSI[connID]), connID);
-            }
-        }
-    }
-
     namespace IConn {
         std::size_t entriesPerConn(const std::vector<int>& inteHead)
         {
@@ -283,6 +247,69 @@ namespace {
             }
         }
     } // XConn
+
+    /// Static ICON and SCON windows of a well's active connections in
+    /// output order, i.e., the input order of COMPSEGS for multi-segment
+    /// wells and the input order of COMPDAT otherwise.
+    Opm::RestartIO::Helpers::StaticWellCache::ConnData
+    staticConnData(const std::shared_ptr<const Opm::Well2>& well,
+                   const Opm::EclipseGrid&                  grid,
+                   const Opm::UnitSystem&                   units,
+                   const std::size_t                        nICon,
+                   const std::size_t                        nSCon)
+    {
+        auto data = Opm::RestartIO::Helpers::StaticWellCache::ConnData{};
+        data.well = well;
+
+        const auto& conn0 = well->getConnections();
+        const auto& conns = Opm::WellConnections( conn0, grid );
+        const int niSI = static_cast<int>(conn0.size());
+
+        for (const auto& conn : conns) {
+            data.open.push_back(conn.state() == Opm::WellCompletion::StateEnum::OPEN);
+        }
+
+        //Branch according to MSW well or not and
+        //sort active connections according to appropriate seqIndex
+        const auto sIToConn = well->isMultiSegment()
+            ? mapCompSegSeqIndexToConnection(conns)  //sort connections according to input sequence in COMPSEGS
+            : mapSeqIndexToConnection(conns);        //sort connections according to input sequence in COMPDAT
+
+        std::vector<const Opm::Connection*> connSI;
+        for (int iSI = 0; iSI < niSI; iSI++) {
+            const auto searchSI = sIToConn.find(static_cast<std::size_t>(iSI));
+            if (searchSI != sIToConn.end()) {
+                connSI.push_back(searchSI->second);
+            }
+        }
+
+        data.iConn.resize(connSI.size() * nICon, 0);
+        data.sConn.resize(connSI.size() * nSCon, 0.0f);
+
+        for (auto nConn = connSI.size(), connID = 0*nConn;
+             connID < nConn; ++connID)
+        {
+            auto ic = boost::make_iterator_range(data.iConn.begin() + connID*nICon,
+                                                 data.iConn.begin() + (connID + 1)*nICon);
+            auto sc = boost::make_iterator_range(data.sConn.begin() + connID*nSCon,
+                                                 data.sConn.begin() + (connID + 1)*nSCon);
+
+            IConn::staticContrib(*connSI[connID], connID, ic);
+            SConn::staticContrib(*connSI[connID], units, sc);
+        }
+
+        return data;
+    }
+
+    bool cachedWindowsFit(const Opm::RestartIO::Helpers::StaticWellCache::ConnData& cached,
+                          const std::size_t                                         nICon,
+                          const std::size_t                                         nSCon)
+    {
+        const auto nConn = cached.iConn.size() / nICon;
+
+        return (cached.iConn.size() == nConn * nICon)
+            && (cached.sConn.size() == nConn * nSCon);
+    }
 } // Anonymous
 
 Opm::RestartIO::Helpers::AggregateConnectionData::
@@ -300,61 +327,71 @@ captureDeclaredConnData(const Schedule&        sched,
                         const EclipseGrid&     grid,
                         const UnitSystem&      units,
                         const data::WellRates& xw,
-                        const std::size_t      sim_step)
+                        const std::size_t      sim_step,
+                        StaticWellCache*       cache)
 {
-    const auto& wells = sched.getWells2(sim_step);
-    //
-    // construct a composite vector of connection objects  holding
-    // rates for all open connectons
-    //
-    std::map<std::string, std::vector<const Opm::data::Connection*> > allWellConnections;
-    for (const auto& wl : wells) {
-        const auto& conn0 = wl.getConnections();
-        const auto  conns = WellConnections(conn0, grid);
-        std::vector<const Opm::data::Connection*> initConn (conns.size(), nullptr);
-
-        allWellConnections.insert(std::make_pair(wl.name(), initConn));
-        const auto it = allWellConnections.find(wl.name());
-        const auto xr = xw.find(wl.name());
-        size_t rCInd = 0;
-        if ((it != allWellConnections.end()) && (xr != xw.end())) {
-            for (auto nConn = conns.size(), connID = 0*nConn; connID < nConn; connID++) {
-                //
-                // WellRates connections are only defined for OPEN connections
-                if ((conns[connID].state() == Opm::WellCompletion::StateEnum::OPEN) &&
-                    (rCInd < xr->second.connections.size())) {
-                    it->second[connID] = &(xr->second.connections[rCInd]);
-                    rCInd+= 1;
-                }
-                else if ((conns[connID].state() == Opm::WellCompletion::StateEnum::OPEN) && (rCInd >= xr->second.connections.size())) {
+    const auto wells = sched.getSharedWells2(sim_step);
+    if (cache != nullptr)
+        cache->retainConnData(wells);
+
+    const auto nICon = this->iConn_.windowSize();
+    const auto nSCon = this->sConn_.windowSize();
+
+    for (auto nWell = wells.size(), wellID = 0*nWell;
+         wellID < nWell; ++wellID)
+    {
+        const auto& well = *wells[wellID];
+
+        auto built = StaticWellCache::ConnData{};
+        const auto* data = (cache == nullptr) ? nullptr
+            : cache->connData(wells[wellID]);
+
+        if ((data == nullptr) || !cachedWindowsFit(*data, nICon, nSCon)) {
+            built = staticConnData(wells[wellID], grid, units, nICon, nSCon);
+            data  = &built;
+        }
+
+        const auto nConn = data->iConn.size() / nICon;
+        for (auto connID = 0*nConn; connID < nConn; ++connID) {
+            auto ic = this->iConn_(wellID, connID);
+            auto sc = this->sConn_(wellID, connID);
+
+            std::copy_n(data->iConn.begin() + connID*nICon, nICon, ic.begin());
+            std::copy_n(data->sConn.begin() + connID*nSCon, nSCon, sc.begin());
+        }
+
+        //
+        // WellRates connections are only defined for OPEN connections,
+        // and are assigned to the active connections in WellConnections
+        // order.
+        //
+        const auto xr = xw.find(well.name());
+        if (xr != xw.end()) {
+            const auto& xconns = xr->second.connections;
+            auto rCInd = std::size_t{0};
+
+            for (auto connID = 0*data->open.size(); connID < data->open.size(); ++connID) {
+                if (! data->open[connID])
+                    continue;
+
+                if (rCInd >= xconns.size()) {
                     throw std::invalid_argument {
                         "Inconsistent number of open connections I in vector<Opm::data::Connection*> (" +
-                        std::to_string(xr->second.connections.size()) + ") in Well " + wl.name()
+                        std::to_string(xconns.size()) + ") in Well " + well.name()
                     };
                 }
-            }
-        }
-    }
-
-    connectionLoop(wells, grid, [&units, &allWellConnections, this]
-        (const Well2&      well, const std::size_t wellID,
-         const Connection& conn, const std::size_t connID) -> void
-    {
-        auto ic = this->iConn_(wellID, connID);
-        auto sc = this->sConn_(wellID, connID);
 
-        IConn::staticContrib(conn, connID, ic);
-        SConn::staticContrib(conn, units, sc);
+                if (connID < nConn) {
+                    auto xc = this->xConn_(wellID, connID);
+                    XConn::dynamicContrib(xconns[rCInd], units, xc);
+                }
 
-        auto xi = allWellConnections.find(well.name());
-        if ((xi != allWellConnections.end()) &&
-            (connID < xi->second.size()))
-            //(connID < xi->second.connections.size()))
-        {
-            auto xc = this->xConn_(wellID, connID);
+                rCInd += 1;
+            }
+        }
 
-            //XConn::dynamicContrib(xi->second.connections[connID],
-            if (xi->second[connID]) XConn::dynamicContrib(*(xi->second[connID]), units, xc);
+        if ((cache != nullptr) && (data == &built)) {
+            cache->storeConnData(std::move(built));
         }
-    });
+    }
 }
@@ -26,6 +26,7 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/ScheduleEnums.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Group/GTNode.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Group/GroupTopology.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Group/Group2.hpp>
 
 #include <algorithm>
@@ -74,14 +75,8 @@ void groupLoop(const std::vector<const Opm::Group2*>& groups,
 int currentGroupLevel(const Opm::Schedule& sched, const Opm::Group2& group, const size_t simStep)
 {
     if (group.defined( simStep )) {
-        auto current = group;
-        int level = 0;
-        while (current.name() != "FIELD") {
-            level += 1;
-            current = sched.getGroup2(current.parent(), simStep);
-        }
-
-        return level;
+        const auto& topology = sched.groupTopology(simStep);
+        return static_cast<int>(topology.level(topology.groupIndex(group.name())));
     } else {
         std::stringstream str;
         str << "actual group has not been defined at report time: " << simStep;
@@ -18,6 +18,7 @@
 */
 
 #include <opm/output/eclipse/AggregateWellData.hpp>
+#include <opm/output/eclipse/StaticWellCache.hpp>
 
 #include <opm/output/eclipse/VectorItems/intehead.hpp>
 #include <opm/output/eclipse/VectorItems/well.hpp>
@@ -39,6 +40,7 @@
 #include <cstring>
 #include <exception>
 #include <iterator>
+#include <memory>
 #include <stdexcept>
 #include <string>
 
@@ -75,13 +77,13 @@ namespace {
     }
 
     template <typename WellOp>
-    void wellLoop(const std::vector<Opm::Well2>& wells,
-                  WellOp&&                       wellOp)
+    void wellLoop(const std::vector<std::shared_ptr<const Opm::Well2>>& wells,
+                  WellOp&&                                              wellOp)
     {
         for (auto nWell = wells.size(), wellID = 0*nWell;
              wellID < nWell; ++wellID)
         {
-            const auto& well = wells[wellID];
+            const auto& well = *wells[wellID];
 
             wellOp(well, wellID);
         }
@@ -771,6 +773,28 @@ namespace {
             zWell[Ix::WellName] = well.name();
         }
     } // ZWell
+
+    // The controls evaluate UDAs through the summary state, and SWEL
+    // reports the summary voidage rate of producers in history mode.
+    bool staticContribDependsOnSummary(const Opm::Well2& well)
+    {
+        return well.hasUDAControls()
+            || (well.isProducer() && !well.predictionMode());
+    }
+
+    template <class IWellArray, class SWellArray,
+              class XWellArray, class ZWellArray>
+    bool cachedWindowsFit(const Opm::RestartIO::Helpers::StaticWellCache::WellData& cached,
+                          const IWellArray& iWell,
+                          const SWellArray& sWell,
+                          const XWellArray& xWell,
+                          const ZWellArray& zWell)
+    {
+        return (cached.iWell.size() == static_cast<std::size_t>(iWell.size()))
+            && (cached.sWell.size() == static_cast<std::size_t>(sWell.size()))
+            && (cached.xWell.size() == static_cast<std::size_t>(xWell.size()))
+            && (cached.zWell.size() == static_cast<std::size_t>(zWell.size()));
+    }
 } // Anonymous
 
 // =====================================================================
@@ -792,52 +816,54 @@ captureDeclaredWellData(const Schedule&   sched,
                         const UnitSystem& units,
                         const std::size_t sim_step,
                         const ::Opm::SummaryState&  smry,
-                        const std::vector<int>& inteHead)
+                        const std::vector<int>& inteHead,
+                        StaticWellCache*  cache)
 {
-    const auto& wells = sched.getWells2(sim_step);
+    const auto wells = sched.getSharedWells2(sim_step);
+    if (cache != nullptr)
+        cache->retainWellData(wells);
 
-    // Static contributions to IWEL array.
-    {
-        //const auto grpNames = groupNames(sched.getGroups());
-        const auto groupMapNameIndex = IWell::currentGroupMapNameIndex(sched, sim_step, inteHead);
-        auto msWellID       = std::size_t{0};
+    const auto groupMapNameIndex = IWell::currentGroupMapNameIndex(sched, sim_step, inteHead);
+    auto msWellID       = std::size_t{0};
 
-        wellLoop(wells, [&groupMapNameIndex, &msWellID, &smry, this]
-            (const Well2& well, const std::size_t wellID) -> void
-        {
-            msWellID += well.isMultiSegment();  // 1-based index.
-            auto iw   = this->iWell_[wellID];
-
-            IWell::staticContrib(well, smry, msWellID, groupMapNameIndex, iw);
-        });
-    }
-
-    // Static contributions to SWEL array.
-    wellLoop(wells, [&units, &smry, this]
-        (const Well2& well, const std::size_t wellID) -> void
+    for (auto nWell = wells.size(), wellID = 0*nWell;
+         wellID < nWell; ++wellID)
     {
-        auto sw = this->sWell_[wellID];
+        const auto& well = *wells[wellID];
 
-        SWell::staticContrib(well, units, smry, sw);
-    });
+        msWellID += well.isMultiSegment();  // 1-based index.
+        const auto groupIndex =
+            IWell::groupIndex(trim(well.groupName()), groupMapNameIndex);
 
-    // Static contributions to XWEL array.
-    wellLoop(wells, [&units, &smry, this]
-        (const Well2& well, const std::size_t wellID) -> void
-    {
+        auto iw = this->iWell_[wellID];
+        auto sw = this->sWell_[wellID];
         auto xw = this->xWell_[wellID];
+        auto zw = this->zWell_[wellID];
 
-        XWell::staticContrib(well, smry, units, xw);
-    });
+        const auto* cached = (cache == nullptr) ? nullptr
+            : cache->wellData(wells[wellID], msWellID, groupIndex);
 
-    // Static contributions to ZWEL array.
-    wellLoop(wells,
-        [this](const Well2& well, const std::size_t wellID) -> void
-    {
-        auto zw = this->zWell_[wellID];
+        if ((cached != nullptr) && cachedWindowsFit(*cached, iw, sw, xw, zw)) {
+            std::copy(cached->iWell.begin(), cached->iWell.end(), iw.begin());
+            std::copy(cached->sWell.begin(), cached->sWell.end(), sw.begin());
+            std::copy(cached->xWell.begin(), cached->xWell.end(), xw.begin());
+            std::copy(cached->zWell.begin(), cached->zWell.end(), zw.begin());
+            continue;
+        }
 
+        IWell::staticContrib(well, smry, msWellID, groupMapNameIndex, iw);
+        SWell::staticContrib(well, units, smry, sw);
+        XWell::staticContrib(well, smry, units, xw);
         ZWell::staticContrib(well, zw);
-    });
+
+        if ((cache != nullptr) && !staticContribDependsOnSummary(well)) {
+            cache->storeWellData({
+                wells[wellID], msWellID, groupIndex,
+                { iw.begin(), iw.end() }, { sw.begin(), sw.end() },
+                { xw.begin(), xw.end() }, { zw.begin(), zw.end() }
+            });
+        }
+    }
 }
 
 // ---------------------------------------------------------------------
@@ -849,7 +875,7 @@ captureDynamicWellData(const Schedule&             sched,
                        const Opm::data::WellRates& xw,
                        const ::Opm::SummaryState&  smry)
 {
-    const auto& wells = sched.getWells2(sim_step);
+    const auto wells = sched.getSharedWells2(sim_step);
 
     // Dynamic contributions to IWEL array.
     wellLoop(wells, [this, &xw]
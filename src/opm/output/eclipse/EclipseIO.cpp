@@ -38,9 +38,12 @@
 #include <opm/parser/eclipse/Utility/Functional.hpp>
 
 #include <opm/output/eclipse/RestartIO.hpp>
+#include <opm/output/eclipse/StaticWellCache.hpp>
 #include <opm/output/eclipse/Summary.hpp>
 #include <opm/output/eclipse/WriteInit.hpp>
+#include <opm/output/eclipse/WriteRFT.hpp>
 
+#include <opm/io/eclipse/Columnar.hpp>
 #include <opm/io/eclipse/OutputStream.hpp>
 
 #include <cstdlib>
@@ -48,6 +51,8 @@
 #include <unordered_map>
 #include <utility>    // move
 
+#include <boost/filesystem.hpp>
+
 #include <ert/ecl/EclKW.hpp>
 #include <ert/ecl/EclFilename.hpp>
 
@@ -56,12 +61,10 @@
 #include <ert/ecl/ecl_init_file.h>
 #include <ert/ecl/ecl_file.h>
 #include <ert/ecl/ecl_grid.h>
-#include <ert/ecl/ecl_rft_file.h>
 #include <ert/ecl/ecl_rst_file.h>
 #include <ert/ecl_well/well_const.h>
 #include <ert/ecl/ecl_rsthead.h>
 #include <ert/util/util.h>
-#include <ert/ecl/fortio.h>
 
 #define OPM_XWEL      "OPM_XWEL"
 #define OPM_IWEL      "OPM_IWEL"
@@ -70,99 +73,6 @@
 namespace Opm {
 namespace {
 
-class RFT {
-    public:
-    RFT( const std::string&  output_dir,
-         const std::string&  basename,
-         bool format );
-
-        void writeTimeStep( const Schedule& schedule,
-                            const EclipseGrid& grid,
-                            std::size_t report_step,
-                            time_t current_time,
-                            double days,
-                            const UnitSystem& units,
-                            data::Wells wellData);
-    private:
-        std::string filename;
-        bool fmt_file;
-};
-
-
-    RFT::RFT( const std::string& output_dir,
-              const std::string& basename,
-              bool format ) :
-        filename( ERT::EclFilename( output_dir, basename, ECL_RFT_FILE, format ) ),
-        fmt_file( format )
-{}
-
-
-void RFT::writeTimeStep( const Schedule& schedule,
-                         const EclipseGrid& grid,
-                         std::size_t report_step,
-                         time_t current_time,
-                         double days,
-                         const UnitSystem& units,
-                         data::Wells wellDatas) {
-    using rft = ERT::ert_unique_ptr< ecl_rft_node_type, ecl_rft_node_free >;
-    const auto& rft_config = schedule.rftConfig();
-    auto well_names = schedule.wellNames(report_step);
-    if (!rft_config.active(report_step))
-        return;
-
-    fortio_type * fortio;
-
-    if (report_step > rft_config.firstRFTOutput())
-        fortio = fortio_open_append( filename.c_str() , fmt_file , ECL_ENDIAN_FLIP );
-    else
-        fortio = fortio_open_writer( filename.c_str() , fmt_file , ECL_ENDIAN_FLIP );
-
-    for ( const auto& well_name : well_names ) {
-
-        if (!(rft_config.rft(well_name, report_step) || rft_config.plt(well_name, report_step)))
-            continue;
-
-        rft rft_node(ecl_rft_node_alloc_new( well_name.c_str(), "RFT", current_time, days ));
-        const auto& wellData = wellDatas.at(well_name);
-
-        if (wellData.connections.empty())
-            continue;
-
-        const auto& well = schedule.getWell2(well_name, report_step);
-        for( const auto& connection : well.getConnections() ) {
-
-            const size_t i = size_t( connection.getI() );
-            const size_t j = size_t( connection.getJ() );
-            const size_t k = size_t( connection.getK() );
-
-            if( !grid.cellActive( i, j, k ) ) continue;
-
-            const auto index = grid.getGlobalIndex( i, j, k );
-            const double depth = grid.getCellDepth( i, j, k );
-
-            const auto& connectionData = std::find_if( wellData.connections.begin(),
-                                                   wellData.connections.end(),
-                                                   [=]( const data::Connection& c ) {
-                                                        return c.index == index;
-                                                   } );
-
-
-            const double press = units.from_si(UnitSystem::measure::pressure,connectionData->cell_pressure);
-            const double satwat = units.from_si(UnitSystem::measure::identity, connectionData->cell_saturation_water);
-            const double satgas = units.from_si(UnitSystem::measure::identity, connectionData->cell_saturation_gas);
-
-            auto* cell = ecl_rft_cell_alloc_RFT(
-                            i, j, k, depth, press, satwat, satgas );
-
-            ecl_rft_node_append_cell( rft_node.get(), cell );
-        }
-
-        ecl_rft_node_fwrite( rft_node.get(), fortio, units.getEclType() );
-    }
-
-    fortio_fclose( fortio );
-}
-
 inline std::string uppercase( std::string x ) {
     std::transform( x.begin(), x.end(), x.begin(),
         []( char c ) { return std::toupper( c ); } );
@@ -174,46 +84,115 @@ inline std::string uppercase( std::string x ) {
 
 class EclipseIO::Impl {
     public:
-    Impl( const EclipseState&, EclipseGrid, const Schedule&, const SummaryConfig& );
+    Impl( const EclipseState&, EclipseGrid, const Schedule&, const SummaryConfig&, EclipseIO::Backend );
         void writeINITFile( const data::Solution& simProps, std::map<std::string, std::vector<int> > int_data, const NNC& nnc) const;
         void writeEGRIDFile( const NNC& nnc );
 
+        std::unique_ptr<EclIO::OutputStream::ArrayWriter> openInit() const;
+        std::unique_ptr<EclIO::OutputStream::ArrayWriter> openRestart( int report_step );
+        std::unique_ptr<EclIO::OutputStream::ArrayWriter> openRFT( int report_step ) const;
+
         const EclipseState& es;
         EclipseGrid grid;
         const Schedule& schedule;
         std::string outputDir;
         std::string baseName;
         out::Summary summary;
-        RFT rft;
         bool output_enabled;
+        RestartIO::Helpers::StaticWellCache wellCache;
+        EclIO::OutputStream::DeltaBase restartDeltas;
+        EclipseIO::Backend backend;
 };
 
 EclipseIO::Impl::Impl( const EclipseState& eclipseState,
                        EclipseGrid grid_,
                        const Schedule& schedule_,
-                       const SummaryConfig& summary_config)
+                       const SummaryConfig& summary_config,
+                       EclipseIO::Backend backend_)
     : es( eclipseState )
     , grid( std::move( grid_ ) )
     , schedule( schedule_ )
     , outputDir( eclipseState.getIOConfig().getOutputDir() )
     , baseName( uppercase( eclipseState.getIOConfig().getBaseName() ) )
     , summary( eclipseState, summary_config, grid , schedule )
-    , rft( outputDir.c_str(), baseName.c_str(), es.getIOConfig().getFMTOUT() )
     , output_enabled( eclipseState.getIOConfig().getOutputEnabled() )
+    , backend( backend_ )
 {}
 
+std::unique_ptr<EclIO::OutputStream::ArrayWriter>
+EclipseIO::Impl::openInit() const
+{
+    using namespace EclIO::OutputStream;
+
+    const auto rset = ResultSet { this->outputDir, this->baseName };
+
+    if (this->backend == EclipseIO::Backend::Columnar)
+        return std::unique_ptr<ArrayWriter> {
+            new Columnar { rset, Columnar::Section::Init }
+        };
+
+    return std::unique_ptr<ArrayWriter> {
+        new Init { rset, Formatted { this->es.cfg().io().getFMTOUT() } }
+    };
+}
+
+std::unique_ptr<EclIO::OutputStream::ArrayWriter>
+EclipseIO::Impl::openRestart( int report_step )
+{
+    using namespace EclIO::OutputStream;
+
+    const auto  rset     = ResultSet { this->outputDir, this->baseName };
+    const auto& ioConfig = this->es.getIOConfig();
+
+    if (this->backend == EclipseIO::Backend::Columnar)
+        return std::unique_ptr<ArrayWriter> {
+            new Columnar { rset, Columnar::Section::Restart, report_step }
+        };
+
+    return std::unique_ptr<ArrayWriter> {
+        new Restart {
+            rset, report_step,
+            Formatted  { ioConfig.getFMTOUT() },
+            Unified    { ioConfig.getUNIFOUT() },
+            Compressed { ioConfig.getCompressedRST() },
+            ioConfig.getDeltaRST() ? &this->restartDeltas : nullptr
+        }
+    };
+}
+
+std::unique_ptr<EclIO::OutputStream::ArrayWriter>
+EclipseIO::Impl::openRFT( int report_step ) const
+{
+    using namespace EclIO::OutputStream;
+
+    const auto rset = ResultSet { this->outputDir, this->baseName };
+
+    if (this->backend == EclipseIO::Backend::Columnar)
+        return std::unique_ptr<ArrayWriter> {
+            new Columnar { rset, Columnar::Section::RFT, report_step }
+        };
+
+    // All RFT data of a run goes to the same file, which is created at
+    // the first report step with RFT output.
+    const auto firstRFT = this->schedule.rftConfig().firstRFTOutput();
+
+    return std::unique_ptr<ArrayWriter> {
+        new RFT {
+            rset, Formatted { this->es.getIOConfig().getFMTOUT() },
+            RFT::OpenExisting { static_cast<std::size_t>(report_step) > firstRFT }
+        }
+    };
+}
+
 
 void EclipseIO::Impl::writeINITFile(const data::Solution&                   simProps,
                                     std::map<std::string, std::vector<int>> int_data,
                                     const NNC&                              nnc) const
 {
-    EclIO::OutputStream::Init initFile {
-        EclIO::OutputStream::ResultSet { this->outputDir, this->baseName },
-        EclIO::OutputStream::Formatted { this->es.cfg().io().getFMTOUT() }
-    };
+    auto initFile = this->openInit();
 
     InitIO::write(this->es, this->grid, this->schedule,
-                  simProps, std::move(int_data), nnc, initFile);
+                  simProps, std::move(int_data), nnc, *initFile);
 }
 
 
@@ -257,7 +236,7 @@ void EclipseIO::writeTimeStep(const SummaryState& st,
                               int report_step,
                               bool  isSubstep,
                               double secs_elapsed,
-                              RestartValue value,
+                              const RestartValue& value,
                               const bool write_double)
  {
 
@@ -269,14 +248,14 @@ void EclipseIO::writeTimeStep(const SummaryState& st,
     const auto& grid = this->impl->grid;
     const auto& schedule = this->impl->schedule;
     const auto& units = es.getUnits();
-    const auto& ioConfig = es.getIOConfig();
     const auto& restart = es.cfg().restart();
 
 
 
     /*
       Summary data is written unconditionally for every timestep except for the
-      very intial report_step==0 call, which is only garbage.
+      very intial report_step==0 call, which is only garbage.  The summary
+      is always written in the ECLIPSE format, see EclipseIO::Backend.
     */
     if (report_step > 0) {
         this->impl->summary.add_timestep( st,
@@ -291,16 +270,10 @@ void EclipseIO::writeTimeStep(const SummaryState& st,
     */
     if(!isSubstep && restart.getWriteRestartFile(report_step))
     {
-        EclIO::OutputStream::Restart rstFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
-            report_step,
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
-        };
+        auto rstFile = this->impl->openRestart(report_step);
 
-        RestartIO::save(rstFile, report_step, secs_elapsed, value, es, grid, schedule,
-                        st, write_double);
+        RestartIO::save(*rstFile, report_step, secs_elapsed, value, es, grid, schedule,
+                        st, write_double, &this->impl->wellCache);
     }
 
 
@@ -310,13 +283,11 @@ void EclipseIO::writeTimeStep(const SummaryState& st,
     if( isSubstep )
         return;
 
-    this->impl->rft.writeTimeStep( schedule,
-                                   grid,
-                                   report_step,
-                                   secs_elapsed + this->impl->schedule.posixStartTime(),
-                                   units.from_si( UnitSystem::measure::time, secs_elapsed ),
-                                   units,
-                                   value.wells );
+    if (schedule.rftConfig().active(report_step)) {
+        auto rftFile = this->impl->openRFT(report_step);
+
+        RftIO::write(report_step, secs_elapsed, units, grid, schedule, value.wells, *rftFile);
+    }
 
  }
 
@@ -328,6 +299,23 @@ RestartValue EclipseIO::loadRestart(SummaryState& summary_state, const std::vect
     const InitConfig& initConfig         = es.getInitConfig();
     const auto& ioConfig                 = es.getIOConfig();
     const int report_step                = initConfig.getRestartStep();
+
+    if (this->impl->backend == EclipseIO::Backend::Columnar) {
+        // The restart root name is a path to the case, relative to the
+        // current directory, without extension.
+        const auto root = boost::filesystem::path { initConfig.getRestartRootName() };
+        const auto rset = EclIO::OutputStream::ResultSet {
+            root.has_parent_path() ? root.parent_path().string() : std::string { "." },
+            root.filename().string()
+        };
+
+        const auto directory = EclIO::OutputStream::Columnar::directory
+            (rset, EclIO::OutputStream::Columnar::Section::Restart, report_step);
+
+        return RestartIO::loadColumnar(directory, report_step, summary_state, solution_keys,
+                                       es, grid, schedule, extra_keys);
+    }
+
     const std::string filename           = ioConfig.getRestartFileName( initConfig.getRestartRootName(),
                                                                         report_step,
                                                                         false );
@@ -339,8 +327,9 @@ RestartValue EclipseIO::loadRestart(SummaryState& summary_state, const std::vect
 EclipseIO::EclipseIO( const EclipseState& es,
                       EclipseGrid grid,
                       const Schedule& schedule,
-                      const SummaryConfig& summary_config)
-    : impl( new Impl( es, std::move( grid ), schedule , summary_config) )
+                      const SummaryConfig& summary_config,
+                      const Backend backend)
+    : impl( new Impl( es, std::move( grid ), schedule , summary_config, backend ) )
 {
     if( !this->impl->output_enabled )
         return;
@@ -46,20 +46,39 @@ LinearisedOutputTable(const std::size_t numTables0,
     , numRows   (numRows0)
 {}
 
+Opm::LinearisedOutputTable::
+LinearisedOutputTable(std::vector<double>& buffer,
+                      const std::size_t    numTables0,
+                      const std::size_t    numPrimary0,
+                      const std::size_t    numRows0,
+                      const std::size_t    numCols0,
+                      const double         fillValue)
+    : numTables (numTables0)
+    , numPrimary(numPrimary0)
+    , numRows   (numRows0)
+    , external  (&buffer)
+    , offset    (buffer.size())
+{
+    buffer.resize(this->offset + numTables0*numPrimary0*numRows0*numCols0,
+                  fillValue);
+}
+
 std::vector<double>::iterator
 Opm::LinearisedOutputTable::column(const std::size_t tableID,
                                    const std::size_t primID,
                                    const std::size_t colID)
 {
+    auto& buffer = (this->external != nullptr) ? *this->external : this->data;
+
     // Table format: numRows * numPrimary * numTables values for first
     // column (ID == 0), followed by same number of entries for second
     // column &c.
-    const auto offset =
-        0 + this->numRows*(primID + this->numPrimary*(tableID + this->numTables*colID));
+    const auto start = this->offset +
+        this->numRows*(primID + this->numPrimary*(tableID + this->numTables*colID));
 
-    assert (offset + this->numRows <= this->data.size());
+    assert (start + this->numRows <= buffer.size());
 
-    return this->data.begin() + offset;
+    return buffer.begin() + start;
 }
 
 const std::vector<double>&
@@ -87,48 +106,25 @@ Opm::DifferentiateOutputTable::calcSlopes(const std::size_t      nDep,
         return;
     }
 
-    auto x = table.column(desc.tableID, desc.primID, 0);
-
-    using colIT = decltype(x);
-
-    auto y  = std::vector<colIT>{};  y .reserve(nDep);
-    auto dy = std::vector<colIT>{};  dy.reserve(nDep);
-    auto y0 = std::vector<double>(nDep);
-    auto y1 = y0;
-    for (auto j = 0*nDep; j < nDep; ++j) {
-        y .push_back(table.column(desc.tableID, desc.primID, j + 1 + 0*nDep));
-        dy.push_back(table.column(desc.tableID, desc.primID, j + 1 + 1*nDep));
-
-        y1[j] = *y.back();  ++y.back();
-
-        // Store derivatives at right interval end-point.
-        ++dy.back();
-    }
-
-    using std::swap;
-
-    auto x1 = *x;  ++x;  auto x0 = 0 * x1;
+    const auto* x = &*table.column(desc.tableID, desc.primID, 0);
 
     // Recall: Number of slope intervals one less than number of active
     // table rows.
-    for (auto n = desc.numActRows - 1, i = 0*n; i < n; ++i) {
-        // Save previous right-hand point as this left-hand point, clear
-        // space for new right-hand point.
-        swap(x0, x1);  x1 = *x;  ++x;
-        swap(y0, y1);
+    const auto n = desc.numActRows - 1;
 
-        const auto dx = x1 - x0;
+    for (auto j = 0*nDep; j < nDep; ++j) {
+        const auto* y  = &*table.column(desc.tableID, desc.primID, j + 1 + 0*nDep);
 
-        for (auto j = 0*nDep; j < nDep; ++j) {
-            y1[j] = *y[j];
+        // Store derivatives at right interval end-point.
+        auto*       dy = &*table.column(desc.tableID, desc.primID, j + 1 + 1*nDep) + 1;
 
-            const auto delta = y1[j] - y0[j];
+        // One column at a time, without loop-carried dependencies, so
+        // that the compiler is free to vectorise the loop.
+        for (auto i = 0*n; i < n; ++i) {
+            const auto dx = x[i + 1] - x[i];
 
             // Choice for dx==0 somewhat debatable.
-            *dy[j] = (std::abs(dx) > 0.0) ? (delta / dx) : 0.0;
-
-            // Advance column iterators;
-            ++y[j];  ++dy[j];
+            dy[i] = (std::abs(dx) > 0.0) ? ((y[i + 1] - y[i]) / dx) : 0.0;
         }
     }
 }
@@ -24,6 +24,7 @@
 
 #include <opm/output/eclipse/RestartIO.hpp>
 
+#include <opm/io/eclipse/Columnar.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 
@@ -51,6 +52,7 @@
 #include <functional>
 #include <initializer_list>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <tuple>
@@ -95,6 +97,10 @@ public:
     explicit RestartFileView(const std::string& filename,
                              const int          report_step);
 
+    // View of the restart section of a columnar result set.
+    explicit RestartFileView(Opm::EclIO::EColumnar section,
+                             const int             report_step);
+
     ~RestartFileView() = default;
 
     RestartFileView(const RestartFileView& rhs) = delete;
@@ -116,7 +122,9 @@ public:
     template <typename ElmType>
     bool hasKeyword(const std::string& vector) const
     {
-        if (this->rst_file_ == nullptr) { return false; }
+        if ((this->rst_file_ == nullptr) && (this->col_file_ == nullptr)) {
+            return false;
+        }
 
         return this->vectors_
             .at(ArrayType<ElmType>::T).count(vector) > 0;
@@ -126,9 +134,31 @@ public:
     const std::vector<ElmType>&
     getKeyword(const std::string& vector)
     {
+        if (this->col_file_ != nullptr) {
+            auto& arrays = std::get<ArrayCache<ElmType>>(this->col_arrays_);
+
+            auto pos = arrays.find(vector);
+            if (pos == arrays.end()) {
+                pos = arrays.emplace(vector, this->col_file_->get<ElmType>(vector)).first;
+            }
+
+            return pos->second;
+        }
+
         return this->rst_file_->getRst<ElmType>(vector, this->report_step_);
     }
 
+    // Read the named arrays of the report step concurrently.  Arrays
+    // which are not loaded this way are read on first use.  Arrays of a
+    // columnar section are separate files and are always read on first
+    // use.
+    void prefetch(const std::vector<std::string>& vectors)
+    {
+        if (this->rst_file_ == nullptr) { return; }
+
+        this->rst_file_->loadReportStepNumber(this->report_step_, vectors);
+    }
+
     const std::vector<int>& intehead()
     {
         const auto& ihkw = std::string { "INTEHEAD" };
@@ -144,6 +174,10 @@ public:
 
 private:
     using RstFile = std::unique_ptr<Opm::EclIO::ERst>;
+    using ColFile = std::unique_ptr<Opm::EclIO::EColumnar>;
+
+    template <typename ElmType>
+    using ArrayCache = std::unordered_map<std::string, std::vector<ElmType>>;
 
     using VectorColl = std::unordered_set<std::string>;
     using TypedColl  = std::unordered_map<
@@ -151,9 +185,15 @@ private:
         >;
 
     RstFile     rst_file_;
+    ColFile     col_file_;
     int         report_step_;
     std::size_t sim_step_;
     TypedColl   vectors_;
+
+    // Arrays loaded from col_file_.
+    std::tuple<ArrayCache<int>, ArrayCache<float>, ArrayCache<double>> col_arrays_;
+
+    void registerVectors(const std::vector<Opm::EclIO::EColumnar::EclEntry>& vectors);
 };
 
 RestartFileView::RestartFileView(const std::string& filename,
@@ -167,9 +207,21 @@ RestartFileView::RestartFileView(const std::string& filename,
         return;
     }
 
-    this->rst_file_->loadReportStepNumber(this->report_step_);
+    this->registerVectors(this->rst_file_->listOfRstArrays(this->report_step_));
+}
 
-    for (const auto& vector : this->rst_file_->listOfRstArrays(this->report_step_)) {
+RestartFileView::RestartFileView(Opm::EclIO::EColumnar section,
+                                 const int             report_step)
+    : col_file_   { new Opm::EclIO::EColumnar{std::move(section)} }
+    , report_step_(report_step)
+    , sim_step_   (std::max(report_step - 1, 0))
+{
+    this->registerVectors(this->col_file_->getList());
+}
+
+void RestartFileView::registerVectors(const std::vector<Opm::EclIO::EColumnar::EclEntry>& vectors)
+{
+    for (const auto& vector : vectors) {
         const auto& type = std::get<1>(vector);
 
         switch (type) {
@@ -188,17 +240,21 @@ RestartFileView::RestartFileView(const std::string& filename,
 
 RestartFileView::RestartFileView(RestartFileView&& rhs)
     : rst_file_   (std::move(rhs.rst_file_))
+    , col_file_   (std::move(rhs.col_file_))
     , report_step_(rhs.report_step_)
     , sim_step_   (rhs.sim_step_)            // Scalar (size_t)
     , vectors_    (std::move(rhs.vectors_))
+    , col_arrays_ (std::move(rhs.col_arrays_))
 {}
 
 RestartFileView& RestartFileView::operator=(RestartFileView&& rhs)
 {
     this->rst_file_    = std::move(rhs.rst_file_);
+    this->col_file_    = std::move(rhs.col_file_);
     this->report_step_ = rhs.report_step_;         // Scalar (int)
     this->sim_step_    = rhs.sim_step_;            // Scalar (size_t)
     this->vectors_     = std::move(rhs.vectors_);
+    this->col_arrays_  = std::move(rhs.col_arrays_);
 
     return *this;
 }
@@ -511,7 +567,7 @@ namespace {
         return {};
     }
 
-    void insertSolutionVector(const std::vector<double>&           vector,
+    void insertSolutionVector(std::vector<double>                  vector,
                               const Opm::RestartKey&               value,
                               const std::vector<double>::size_type numcells,
                               Opm::data::Solution&                 sol)
@@ -524,7 +580,7 @@ namespace {
             };
         }
 
-        sol.insert(value.key, value.dim, vector,
+        sol.insert(value.key, value.dim, std::move(vector),
                    Opm::data::TargetType::RESTART_SOLUTION);
     }
 
@@ -533,7 +589,7 @@ namespace {
                          RestartFileView&                     rst_view,
                          Opm::data::Solution&                 sol)
     {
-        const auto& kwdata = double_vector(value.key, rst_view);
+        auto kwdata = double_vector(value.key, rst_view);
 
         if (kwdata.empty()) {
             throwIfMissingRequired(value);
@@ -544,7 +600,7 @@ namespace {
             return;
         }
 
-        insertSolutionVector(kwdata, value, numcells, sol);
+        insertSolutionVector(std::move(kwdata), value, numcells, sol);
     }
 
     void loadHysteresisIfAvailable(const std::string&                   primary,
@@ -569,7 +625,7 @@ namespace {
             std::transform(std::begin(smax), std::end(smax), std::begin(smax),
                            [](const double s) { return 1.0 - s; });
 
-            insertSolutionVector(smax, fallback_key, numcells, sol);
+            insertSolutionVector(std::move(smax), fallback_key, numcells, sol);
         }
     }
 
@@ -648,6 +704,38 @@ namespace {
         return sol;
     }
 
+    // Arrays of the report step which are used to restore the solution,
+    // the well state, the extra data and the cumulatives.
+    std::vector<std::string>
+    requiredVectors(const std::vector<Opm::RestartKey>& solution_keys,
+                    const std::vector<Opm::RestartKey>& extra_keys)
+    {
+        auto vectors = std::vector<std::string> {
+            "INTEHEAD", "DOUBHEAD",
+            "IWEL", "XWEL", "ICON", "XCON",
+            "IGRP", "XGRP", "ISEG", "RSEG",
+            "OPM_IWEL", "OPM_XWEL",
+        };
+
+        for (const auto& value : solution_keys) {
+            vectors.push_back(value.key);
+
+            if (isHysteresis(value.key)) {
+                vectors.push_back("SOMAX");
+                vectors.push_back("SGMAX");
+            }
+        }
+
+        for (const auto& extra : extra_keys) {
+            vectors.push_back(extra.key);
+        }
+
+        std::sort(vectors.begin(), vectors.end());
+        vectors.erase(std::unique(vectors.begin(), vectors.end()), vectors.end());
+
+        return vectors;
+    }
+
     void restoreExtra(const std::vector<Opm::RestartKey>& extra_keys,
                       const Opm::UnitSystem&              usys,
                       RestartFileView&                    rst_view,
@@ -1201,22 +1289,19 @@ namespace {
             }
         }
     }
-} // Anonymous namespace
-
-namespace Opm { namespace RestartIO  {
 
-    RestartValue
-    load(const std::string&             filename,
-         int                            report_step,
-         SummaryState&                  summary_state,
-         const std::vector<RestartKey>& solution_keys,
-         const EclipseState&            es,
-         const EclipseGrid&             grid,
-         const Schedule&                schedule,
-         const std::vector<RestartKey>& extra_keys)
+    Opm::RestartValue
+    restore(std::shared_ptr<RestartFileView>    rst_view,
+            Opm::SummaryState&                  summary_state,
+            const std::vector<Opm::RestartKey>& solution_keys,
+            const Opm::EclipseState&            es,
+            const Opm::EclipseGrid&             grid,
+            const Opm::Schedule&                schedule,
+            const std::vector<Opm::RestartKey>& extra_keys)
     {
-        auto rst_view =
-            std::make_shared<RestartFileView>(filename, report_step);
+        // Read only the arrays which are needed, and read them
+        // concurrently.
+        rst_view->prefetch(requiredVectors(solution_keys, extra_keys));
 
         auto xr = restoreSOLUTION(solution_keys,
                                   grid.getNumActive(), *rst_view);
@@ -1227,7 +1312,7 @@ namespace Opm { namespace RestartIO  {
             ? restore_wells_opm(es, grid, schedule, *rst_view)
             : restore_wells_ecl(es, grid, schedule,  rst_view);
 
-        auto rst_value = RestartValue{ std::move(xr), std::move(xw) };
+        auto rst_value = Opm::RestartValue{ std::move(xr), std::move(xw) };
 
         if (! extra_keys.empty()) {
             restoreExtra(extra_keys, es.getUnits(), *rst_view, rst_value);
@@ -1237,5 +1322,39 @@ namespace Opm { namespace RestartIO  {
 
         return rst_value;
     }
+} // Anonymous namespace
+
+namespace Opm { namespace RestartIO  {
+
+    RestartValue
+    load(const std::string&             filename,
+         int                            report_step,
+         SummaryState&                  summary_state,
+         const std::vector<RestartKey>& solution_keys,
+         const EclipseState&            es,
+         const EclipseGrid&             grid,
+         const Schedule&                schedule,
+         const std::vector<RestartKey>& extra_keys)
+    {
+        return restore(std::make_shared<RestartFileView>(filename, report_step),
+                       summary_state, solution_keys, es, grid, schedule, extra_keys);
+    }
+
+    RestartValue
+    loadColumnar(const std::string&             directory,
+                 int                            report_step,
+                 SummaryState&                  summary_state,
+                 const std::vector<RestartKey>& solution_keys,
+                 const EclipseState&            es,
+                 const EclipseGrid&             grid,
+                 const Schedule&                schedule,
+                 const std::vector<RestartKey>& extra_keys)
+    {
+        auto rst_view = std::make_shared<RestartFileView>
+            (EclIO::EColumnar{ directory }, report_step);
+
+        return restore(std::move(rst_view), summary_state, solution_keys,
+                       es, grid, schedule, extra_keys);
+    }
 
 }} // Opm::RestartIO
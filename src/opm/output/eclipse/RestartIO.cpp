@@ -30,6 +30,8 @@
 #include <opm/output/eclipse/AggregateMSWData.hpp>
 #include <opm/output/eclipse/WriteRestartHelpers.hpp>
 
+#include <opm/common/OpmLog/OpmLog.hpp>
+
 #include <opm/io/eclipse/OutputStream.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
 
@@ -42,13 +44,19 @@
 #include <opm/parser/eclipse/EclipseState/Tables/Eqldims.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
+#include <exception>
 #include <fstream>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace Opm { namespace RestartIO {
@@ -74,11 +82,16 @@ namespace {
         return extra_solution.count(vector) > 0;
     }
 
-    double nextStepSize(const Opm::RestartValue& rst_value)
+    double nextStepSize(const Opm::RestartValue& rst_value,
+                        const UnitSystem&        units)
     {
-        return rst_value.hasExtra("OPMEXTRA")
-            ? rst_value.getExtra("OPMEXTRA")[0]
-            : 0.0;
+        for (const auto& extra_value : rst_value.extra) {
+            if (extra_value.first.key == "OPMEXTRA") {
+                return units.from_si(extra_value.first.dim, extra_value.second[0]);
+            }
+        }
+
+        return 0.0;
     }
 
     std::vector<int>
@@ -192,44 +205,95 @@ namespace {
         }
     }
 
-    std::vector<int>
-    writeHeader(const int                     sim_step,
-                const double                  next_step_size,
-                const double                  simTime,
-                const Schedule&               schedule,
-                const EclipseGrid&            grid,
-                const EclipseState&           es,
-                EclIO::OutputStream::Restart& rstFile)
+    /*
+      The restart file is assembled in two phases. First the header and the
+      well, group, segment and connection arrays are calculated; these stages
+      are independent of each other and are run concurrently when OpenMP is
+      available. Then the arrays are written to the output stream in the
+      fixed keyword order of the restart file. The solution and extra
+      vectors are converted from SI to output units as they are written. The RestartStages structure
+      holds the calculated arrays between the two phases, and the wall clock
+      time spent in each stage.
+    */
+    struct RestartStages
     {
-        // write INTEHEAD to restart file
-        const auto ih = Helpers::createInteHead(es, grid, schedule,
-                                                simTime, sim_step, sim_step);
-        rstFile.write("INTEHEAD", ih);
+        enum Stage : std::size_t {
+            Header, Groups, MSW, Wells, Connections, Write, NumStages
+        };
 
-        // write LOGIHEAD to restart file
-        rstFile.write("LOGIHEAD", Helpers::createLogiHead(es));
+        explicit RestartStages(std::vector<int> ih)
+            : inteHD(std::move(ih))
+        {
+            this->seconds.fill(0.0);
+        }
 
-        // write DOUBHEAD to restart file
-        const auto dh = Helpers::createDoubHead(es, schedule, sim_step,
-                                                simTime, next_step_size);
-        rstFile.write("DOUBHEAD", dh);
+        template <class Function>
+        void run(const Stage stage, Function&& function)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            try {
+                function();
+            }
+            catch (...) {
+                this->error[stage] = std::current_exception();
+            }
 
-        // return the inteHead vector
-        return ih;
-    }
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+            this->seconds[stage] += elapsed.count();
+        }
 
-    void writeGroup(int                           sim_step,
-                    const Schedule&               schedule,
-                    const Opm::SummaryState&      sumState,
-                    const std::vector<int>&       ih,
-                    EclIO::OutputStream::Restart& rstFile)
-    {
-        // write IGRP to restart file
-        const size_t simStep = static_cast<size_t> (sim_step);
+        void rethrow() const
+        {
+            for (const auto& e : this->error) {
+                if (e) { std::rethrow_exception(e); }
+            }
+        }
+
+        std::string report(const int report_step) const
+        {
+            static const std::array<const char*, NumStages> names = {
+                "header", "groups", "msw", "wells", "connections", "write"
+            };
+
+            std::ostringstream os;
+            os << "Restart file assembly, report step " << report_step << ':';
+            for (std::size_t stage = 0; stage < NumStages; ++stage) {
+                os << ' ' << names[stage] << '=' << this->seconds[stage] << 's';
+            }
+
+            return os.str();
+        }
+
+        std::vector<int> inteHD;
+        std::vector<double> doubHD;
+
+        // Only allocated when the corresponding stage applies.
+        std::unique_ptr<Helpers::AggregateGroupData>      groupData;
+        std::unique_ptr<Helpers::AggregateMSWData>        mswData;
+        std::unique_ptr<Helpers::AggregateWellData>       wellData;
+        std::unique_ptr<Helpers::AggregateConnectionData> connectionData;
+
+        std::vector<int>    opm_iwel;
+        std::vector<double> opm_xwel;
 
-        auto  groupData = Helpers::AggregateGroupData(ih);
+        std::array<double, NumStages> seconds;
+        std::array<std::exception_ptr, NumStages> error;
+    };
 
-        groupData.captureDeclaredGroupData(schedule, simStep, sumState, ih);
+    void writeHeader(const RestartStages&              stages,
+                     const EclipseState&               es,
+                     EclIO::OutputStream::ArrayWriter& rstFile)
+    {
+        rstFile.write("INTEHEAD", stages.inteHD);
+        rstFile.write("LOGIHEAD", Helpers::createLogiHead(es));
+        rstFile.write("DOUBHEAD", stages.doubHD);
+    }
+
+    void writeGroup(const RestartStages&              stages,
+                    EclIO::OutputStream::ArrayWriter& rstFile)
+    {
+        const auto& groupData = *stages.groupData;
 
         rstFile.write("IGRP", groupData.getIGroup());
         rstFile.write("SGRP", groupData.getSGroup());
@@ -237,21 +301,10 @@ namespace {
         rstFile.write("ZGRP", groupData.getZGroup());
     }
 
-    void writeMSWData(int                           sim_step,
-                      const UnitSystem&             units,
-                      const Schedule&               schedule,
-                      const EclipseGrid&            grid,
-                      const Opm::SummaryState&      sumState,
-                      const Opm::data::Wells&       wells,
-                      const std::vector<int>&       ih,
-                      EclIO::OutputStream::Restart& rstFile)
+    void writeMSWData(const RestartStages&              stages,
+                      EclIO::OutputStream::ArrayWriter& rstFile)
     {
-        // write ISEG, RSEG, ILBS and ILBR to restart file
-        const auto simStep = static_cast<std::size_t> (sim_step);
-
-        auto  MSWData = Helpers::AggregateMSWData(ih);
-        MSWData.captureDeclaredMSWData(schedule, simStep, units,
-                                       ih, grid, sumState, wells);
+        const auto& MSWData = *stages.mswData;
 
         rstFile.write("ISEG", MSWData.getISeg());
         rstFile.write("ILBS", MSWData.getILBs());
@@ -259,21 +312,11 @@ namespace {
         rstFile.write("RSEG", MSWData.getRSeg());
     }
 
-    void writeWell(int                           sim_step,
-                   const bool                    ecl_compatible_rst,
-                   const Phases&                 phases,
-                   const UnitSystem&             units,
-                   const EclipseGrid&            grid,
-                   const Schedule&               schedule,
-                   const data::Wells&            wells,
-                   const Opm::SummaryState&      sumState,
-                   const std::vector<int>&       ih,
-                   EclIO::OutputStream::Restart& rstFile)
+    void writeWell(const RestartStages&              stages,
+                   const bool                        ecl_compatible_rst,
+                   EclIO::OutputStream::ArrayWriter& rstFile)
     {
-        auto wellData = Helpers::AggregateWellData(ih);
-        wellData.captureDeclaredWellData(schedule, units, sim_step, sumState, ih);
-        wellData.captureDynamicWellData(schedule, sim_step,
-                                        wells, sumState);
+        const auto& wellData = *stages.wellData;
 
         rstFile.write("IWEL", wellData.getIWell());
         rstFile.write("SWEL", wellData.getSWell());
@@ -283,21 +326,11 @@ namespace {
         // Extended set of OPM well vectors
         if (!ecl_compatible_rst)
         {
-            const auto sched_wells = schedule.getWells2(sim_step);
-            const auto sched_well_names = schedule.wellNames(sim_step);
-
-            const auto opm_xwel =
-                serialize_OPM_XWEL(wells, sched_wells, phases, grid);
-
-            const auto opm_iwel = serialize_OPM_IWEL(wells, sched_well_names);
-
-            rstFile.write("OPM_IWEL", opm_iwel);
-            rstFile.write("OPM_XWEL", opm_xwel);
+            rstFile.write("OPM_IWEL", stages.opm_iwel);
+            rstFile.write("OPM_XWEL", stages.opm_xwel);
         }
 
-        auto connectionData = Helpers::AggregateConnectionData(ih);
-        connectionData.captureDeclaredConnData(schedule, grid, units,
-                                               wells, sim_step);
+        const auto& connectionData = *stages.connectionData;
 
         rstFile.write("ICON", connectionData.getIConn());
         rstFile.write("SCON", connectionData.getSConn());
@@ -315,18 +348,31 @@ namespace {
         return false;
     }
 
+    // Unit of solution field in the restart value's current units.
+    UnitSystem::measure solutionDim(const RestartValue&    value,
+                                    const data::CellData& field)
+    {
+        return value.solution.isSI()
+            ? field.dim : UnitSystem::measure::identity;
+    }
+
     std::vector<double>
     convertedHysteresisSat(const RestartValue& value,
+                           const UnitSystem&   units,
                            const std::string&  primary,
                            const std::string&  fallback)
     {
         auto smax = std::vector<double>{};
 
-        if (value.solution.has(primary)) {
-            smax = value.solution.data(primary);
-        }
-        else if (value.solution.has(fallback)) {
-            smax = value.solution.data(fallback);
+        for (const auto* key : { &primary, &fallback }) {
+            if (value.solution.has(*key)) {
+                const auto& field = value.solution.at(*key);
+
+                smax.resize(field.data.size());
+                units.from_si(solutionDim(value, field), field.data.data(),
+                              smax.data(), smax.size());
+                break;
+            }
         }
 
         if (! smax.empty()) {
@@ -339,6 +385,7 @@ namespace {
 
     template <class OutputVector>
     void writeEclipseCompatHysteresis(const RestartValue& value,
+                                      const UnitSystem&   units,
                                       const bool          write_double,
                                       OutputVector&&      writeVector)
     {
@@ -347,10 +394,10 @@ namespace {
         // Sufficient for Norne.
         {
             const auto somax =
-                convertedHysteresisSat(value, "KRNSW_OW", "PCSWM_OW");
+                convertedHysteresisSat(value, units, "KRNSW_OW", "PCSWM_OW");
 
             if (! somax.empty()) {
-                writeVector("SOMAX", somax, write_double);
+                writeVector("SOMAX", somax, UnitSystem::measure::identity, write_double);
             }
         }
 
@@ -359,40 +406,67 @@ namespace {
         // Sufficient for Norne.
         {
             const auto sgmax =
-                convertedHysteresisSat(value, "KRNSW_GO", "PCSWM_GO");
+                convertedHysteresisSat(value, units, "KRNSW_GO", "PCSWM_GO");
 
             if (! sgmax.empty()) {
-                writeVector("SGMAX", sgmax, write_double);
+                writeVector("SGMAX", sgmax, UnitSystem::measure::identity, write_double);
             }
         }
     }
 
-    void writeSolution(const RestartValue&           value,
-                       const bool                    ecl_compatible_rst,
-                       const bool                    write_double_arg,
-                       EclIO::OutputStream::Restart& rstFile)
+    // Write vector of SI values in output units.  Double precision
+    // vectors are converted into a temporary copy, one vector at a time,
+    // while single precision vectors are converted and narrowed one
+    // output block at a time.
+    void writeConverted(const std::string&                key,
+                        const std::vector<double>&        data,
+                        const UnitSystem::measure         dim,
+                        const UnitSystem&                 units,
+                        const bool                        write_double,
+                        EclIO::OutputStream::ArrayWriter& rstFile)
+    {
+        if (! write_double) {
+            rstFile.write(key, data.size(),
+                [&data, dim, &units](const std::size_t begin,
+                                     const std::size_t end,
+                                     float*            block)
+            {
+                units.from_si(dim, data.data() + begin, block, end - begin);
+            });
+        }
+        else if (dim == UnitSystem::measure::identity) {
+            rstFile.write(key, data);
+        }
+        else {
+            auto converted = std::vector<double>(data.size());
+            units.from_si(dim, data.data(), converted.data(), data.size());
+
+            rstFile.write(key, converted);
+        }
+    }
+
+    void writeSolution(const RestartValue&               value,
+                       const UnitSystem&                 units,
+                       const bool                        ecl_compatible_rst,
+                       const bool                        write_double_arg,
+                       EclIO::OutputStream::ArrayWriter& rstFile)
     {
         rstFile.message("STARTSOL");
 
-        auto write = [&rstFile]
+        auto write = [&rstFile, &units]
             (const std::string&         key,
              const std::vector<double>& data,
+             const UnitSystem::measure  dim,
              const bool                 write_double) -> void
         {
-            if (write_double) {
-                rstFile.write(key, data);
-            }
-            else {
-                rstFile.write(key, std::vector<float> {
-                    data.begin(), data.end()
-                });
-            }
+            writeConverted(key, data, dim, units, write_double, rstFile);
         };
 
         for (const auto& elm : value.solution) {
             if (elm.second.target == data::TargetType::RESTART_SOLUTION)
             {
-                write(elm.first, elm.second.data, write_double_arg);
+                write(elm.first, elm.second.data,
+                      solutionDim(value, elm.second), write_double_arg);
             }
         }
 
@@ -401,12 +475,12 @@ namespace {
             if (extraInSolution(key)) {
                 // Observe that the extra data is unconditionally
                 // output as double precision.
-                write(key, elm.second, true);
+                write(key, elm.second, elm.first.dim, true);
             }
         }
 
         if (ecl_compatible_rst && haveHysteresis(value)) {
-            writeEclipseCompatHysteresis(value, write_double_arg, write);
+            writeEclipseCompatHysteresis(value, units, write_double_arg, write);
         }
 
         rstFile.message("ENDSOL");
@@ -417,34 +491,38 @@ namespace {
 
         for (const auto& elm : value.solution) {
             if (elm.second.target == data::TargetType::RESTART_AUXILIARY) {
-                write(elm.first, elm.second.data, write_double_arg);
+                write(elm.first, elm.second.data,
+                      solutionDim(value, elm.second), write_double_arg);
             }
         }
     }
 
-    void writeExtraData(const RestartValue::ExtraVector& extra_data,
-                        EclIO::OutputStream::Restart&    rstFile)
+    void writeExtraData(const RestartValue::ExtraVector&  extra_data,
+                        const UnitSystem&                 units,
+                        EclIO::OutputStream::ArrayWriter& rstFile)
     {
         for (const auto& extra_value : extra_data) {
             const std::string& key = extra_value.first.key;
 
             if (! extraInSolution(key)) {
-                rstFile.write(key, extra_value.second);
+                writeConverted(key, extra_value.second, extra_value.first.dim,
+                               units, true, rstFile);
             }
         }
     }
 
 } // Anonymous namespace
 
-void save(EclIO::OutputStream::Restart& rstFile,
-          int                           report_step,
-          double                        seconds_elapsed,
-          RestartValue                  value,
-          const EclipseState&           es,
-          const EclipseGrid&            grid,
-          const Schedule&               schedule,
-          const SummaryState&           sumState,
-          bool                          write_double)
+void save(EclIO::OutputStream::ArrayWriter& rstFile,
+          int                               report_step,
+          double                            seconds_elapsed,
+          const RestartValue&               value,
+          const EclipseState&               es,
+          const EclipseGrid&                grid,
+          const Schedule&                   schedule,
+          const SummaryState&               sumState,
+          bool                              write_double,
+          Helpers::StaticWellCache*         wellCache)
 {
     ::Opm::RestartIO::checkSaveArguments(es, value, grid);
 
@@ -452,49 +530,115 @@ void save(EclIO::OutputStream::Restart& rstFile,
     const auto ecl_compatible_rst = ioCfg.getEclCompatibleRST();
 
     const auto  sim_step = std::max(report_step - 1, 0);
+    const auto  simStep  = static_cast<std::size_t>(sim_step);
     const auto& units    = es.getUnits();
 
     if (ecl_compatible_rst) {
         write_double = false;
     }
 
-    // Convert solution fields and extra values from SI to user units.
-    value.convertFromSI(units);
+    const auto& wells = schedule.getWells2(sim_step);
+    const auto haveWells = ! wells.empty();
+    const auto haveMSW =
+        std::any_of(std::begin(wells), std::end(wells),
+            [](const Well2& well)
+    {
+        return well.isMultiSegment();
+    });
+
+    const auto header_start = std::chrono::steady_clock::now();
+    RestartStages stages {
+        Helpers::createInteHead(es, grid, schedule,
+                                seconds_elapsed, sim_step, sim_step)
+    };
+    stages.seconds[RestartStages::Header] =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - header_start).count();
+
+    // All stages only read from the schedule, grid, summary state and
+    // value.wells.
+#pragma omp parallel sections
+    {
+#pragma omp section
+        stages.run(RestartStages::Groups, [&]()
+        {
+            stages.groupData.reset(new Helpers::AggregateGroupData(stages.inteHD));
+            stages.groupData->captureDeclaredGroupData(schedule, simStep,
+                                                       sumState, stages.inteHD);
+        });
+
+#pragma omp section
+        stages.run(RestartStages::MSW, [&]()
+        {
+            if (! haveMSW) { return; }
+
+            stages.mswData.reset(new Helpers::AggregateMSWData(stages.inteHD));
+            stages.mswData->captureDeclaredMSWData(schedule, simStep, units,
+                                                   stages.inteHD, grid,
+                                                   sumState, value.wells);
+        });
+
+#pragma omp section
+        stages.run(RestartStages::Wells, [&]()
+        {
+            if (! haveWells) { return; }
+
+            stages.wellData.reset(new Helpers::AggregateWellData(stages.inteHD));
+            stages.wellData->captureDeclaredWellData(schedule, units, sim_step,
+                                                     sumState, stages.inteHD,
+                                                     wellCache);
+            stages.wellData->captureDynamicWellData(schedule, sim_step,
+                                                    value.wells, sumState);
+
+            if (! ecl_compatible_rst) {
+                stages.opm_xwel = serialize_OPM_XWEL(value.wells, wells,
+                                                     es.runspec().phases(), grid);
+                stages.opm_iwel = serialize_OPM_IWEL(value.wells,
+                                                     schedule.wellNames(sim_step));
+            }
+        });
+
+#pragma omp section
+        stages.run(RestartStages::Connections, [&]()
+        {
+            if (! haveWells) { return; }
 
-    const auto inteHD =
-        writeHeader(sim_step, nextStepSize(value), seconds_elapsed,
-                    schedule, grid, es, rstFile);
+            stages.connectionData.reset(new Helpers::AggregateConnectionData(stages.inteHD));
+            stages.connectionData->captureDeclaredConnData(schedule, grid, units,
+                                                           value.wells, sim_step,
+                                                           wellCache);
+        });
+    }
 
-    writeGroup(sim_step, schedule, sumState, inteHD, rstFile);
+    stages.rethrow();
 
-    // Write well and MSW data only when applicable (i.e., when present)
+    stages.run(RestartStages::Write, [&]()
     {
-        const auto& wells = schedule.getWells2(sim_step);
+        // DOUBHEAD uses the next step size from the OPMEXTRA vector.
+        stages.doubHD = Helpers::createDoubHead(es, schedule, sim_step,
+                                                seconds_elapsed, nextStepSize(value, units));
 
-        if (! wells.empty()) {
-            const auto haveMSW =
-                std::any_of(std::begin(wells), std::end(wells),
-                    [](const Well2& well)
-            {
-                return well.isMultiSegment();
-            });
+        writeHeader(stages, es, rstFile);
+        writeGroup(stages, rstFile);
 
+        // Write well and MSW data only when applicable (i.e., when present)
+        if (haveWells) {
             if (haveMSW) {
-                writeMSWData(sim_step, units, schedule, grid, sumState,
-                             value.wells, inteHD, rstFile);
+                writeMSWData(stages, rstFile);
             }
 
-            writeWell(sim_step, ecl_compatible_rst,
-                      es.runspec().phases(), units, grid, schedule,
-                      value.wells, sumState, inteHD, rstFile);
+            writeWell(stages, ecl_compatible_rst, rstFile);
         }
-    }
 
-    writeSolution(value, ecl_compatible_rst, write_double, rstFile);
+        writeSolution(value, units, ecl_compatible_rst, write_double, rstFile);
 
-    if (! ecl_compatible_rst) {
-        writeExtraData(value.extra, rstFile);
-    }
+        if (! ecl_compatible_rst) {
+            writeExtraData(value.extra, units, rstFile);
+        }
+    });
+
+    stages.rethrow();
+
+    OpmLog::debug(stages.report(report_step));
 }
 
 }} // Opm::RestartIO
@@ -0,0 +1,119 @@
+/*
+  Copyright (c) 2019 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/output/eclipse/StaticWellCache.hpp>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/Well/Well2.hpp>
+
+#include <unordered_map>
+#include <utility>
+
+namespace {
+    template <class Entries>
+    void retainEntries(const std::vector<std::shared_ptr<const Opm::Well2>>& wells,
+                       Entries&                                               entries)
+    {
+        auto current = std::unordered_map<std::string, const Opm::Well2*>{};
+        for (const auto& well : wells)
+            current.emplace(well->name(), well.get());
+
+        for (auto pos = entries.begin(); pos != entries.end(); ) {
+            auto well = current.find(pos->first);
+            if ((well == current.end()) || (well->second != pos->second.well.get()))
+                pos = entries.erase(pos);
+            else
+                ++pos;
+        }
+    }
+} // Anonymous
+
+const Opm::RestartIO::Helpers::StaticWellCache::WellData*
+Opm::RestartIO::Helpers::StaticWellCache::
+wellData(const std::shared_ptr<const Well2>& well,
+         const std::size_t                   msWellID,
+         const int                           groupIndex) const
+{
+    auto pos = this->wells_.find(well->name());
+    if (pos == this->wells_.end())
+        return nullptr;
+
+    const auto& data = pos->second;
+    if ((data.well != well) || (data.msWellID != msWellID) || (data.groupIndex != groupIndex))
+        return nullptr;
+
+    return &data;
+}
+
+const Opm::RestartIO::Helpers::StaticWellCache::ConnData*
+Opm::RestartIO::Helpers::StaticWellCache::
+connData(const std::shared_ptr<const Well2>& well) const
+{
+    auto pos = this->conns_.find(well->name());
+    if ((pos == this->conns_.end()) || (pos->second.well != well))
+        return nullptr;
+
+    return &pos->second;
+}
+
+void
+Opm::RestartIO::Helpers::StaticWellCache::storeWellData(WellData data)
+{
+    auto name = data.well->name();
+    this->wells_[name] = std::move(data);
+}
+
+void
+Opm::RestartIO::Helpers::StaticWellCache::storeConnData(ConnData data)
+{
+    auto name = data.well->name();
+    this->conns_[name] = std::move(data);
+}
+
+void
+Opm::RestartIO::Helpers::StaticWellCache::
+retainWellData(const std::vector<std::shared_ptr<const Well2>>& wells)
+{
+    retainEntries(wells, this->wells_);
+}
+
+void
+Opm::RestartIO::Helpers::StaticWellCache::
+retainConnData(const std::vector<std::shared_ptr<const Well2>>& wells)
+{
+    retainEntries(wells, this->conns_);
+}
+
+std::size_t
+Opm::RestartIO::Helpers::StaticWellCache::numWellData() const
+{
+    return this->wells_.size();
+}
+
+std::size_t
+Opm::RestartIO::Helpers::StaticWellCache::numConnData() const
+{
+    return this->conns_.size();
+}
+
+void
+Opm::RestartIO::Helpers::StaticWellCache::clear()
+{
+    this->wells_.clear();
+    this->conns_.clear();
+}
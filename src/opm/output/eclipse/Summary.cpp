@@ -39,6 +39,7 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQInput.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQContext.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Group/Group2.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Group/GroupTopology.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
 #include <opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
@@ -1184,7 +1185,7 @@ void eval_udq(const Schedule& schedule, std::size_t sim_step, SummaryState& st)
         }
     }
 
-    for (const auto& def : udq.definitions(UDQVarType::WELL_VAR)) {
+    for (const auto& def : udq.eval_order(UDQVarType::WELL_VAR)) {
         auto ws = def.eval(context);
         for (const auto& well : wells) {
             const auto& udq_value = ws[well];
@@ -1193,7 +1194,7 @@ void eval_udq(const Schedule& schedule, std::size_t sim_step, SummaryState& st)
         }
     }
 
-    for (const auto& def : udq.definitions(UDQVarType::FIELD_VAR)) {
+    for (const auto& def : udq.eval_order(UDQVarType::FIELD_VAR)) {
         auto field_udq = def.eval(context);
         if (field_udq[0])
             st.update(def.keyword(), field_udq[0].value());
@@ -1432,27 +1433,18 @@ well_efficiency_factors( const ecl::smspec_node* node,
 
     const bool is_group = (var_type == ECL_SMSPEC_GROUP_VAR);
     const bool is_rate = !node->is_total();
-    const auto groupTree = schedule.groupTree(sim_step);
+    const auto& topology = schedule.groupTopology(sim_step);
+
+    auto stop_group = Opm::GroupTopology::npos;
+    if (is_group && is_rate && topology.hasGroup(node->get_wgname()))
+        stop_group = topology.groupIndex(node->get_wgname());
 
     for( const auto& well : schedule_wells ) {
         if (!well.hasBeenDefined(sim_step))
             continue;
 
-        double eff_factor = well.getEfficiencyFactor();
-        const auto* group_ptr = std::addressof(schedule.getGroup2(well.groupName(), sim_step));
-
-        while(true){
-            if((   is_group
-                && is_rate
-                && group_ptr->name() == node->get_wgname() ))
-                break;
-            eff_factor *= group_ptr->getGroupEfficiencyFactor();
-
-            if (group_ptr->name() == "FIELD")
-                break;
-            group_ptr = std::addressof( schedule.getGroup2( group_ptr->parent(), sim_step ) );
-        }
-        efac.emplace_back( well.name(), eff_factor );
+        const auto well_index = topology.wellIndex(well.name());
+        efac.emplace_back( well.name(), topology.cumulativeEfficiencyFactor(well_index, stop_group) );
     }
 
     return efac;
@@ -47,6 +47,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <numeric>
@@ -68,10 +69,48 @@ namespace {
                     ::Opm::LinearisedOutputTable& table)
         >;
 
+    /// Minimum number of table elements for which the tables of a single
+    /// keyword are linearised in parallel.
+    const std::size_t parallelTableSize = 16 * 1024;
+
+    /// Call \code linearise(tableID) \endcode for all tables of a single
+    /// keyword, in parallel if the output block has at least \c
+    /// parallelTableSize elements.  The tables occupy disjoint parts of
+    /// the output block so \p linearise must only write to the table it
+    /// is asked for.  Errors are rethrown for the lowest failing table ID,
+    /// as in a sequential loop.
+    template <class Linearise>
+    void forEachTable(const std::size_t numTab,
+                      const std::size_t blockSize,
+                      Linearise&&       linearise)
+    {
+        auto errors = std::vector<std::exception_ptr>(numTab);
+
+        const auto n = static_cast<std::ptrdiff_t>(numTab);
+
+#pragma omp parallel for schedule(dynamic) if (blockSize >= parallelTableSize)
+        for (std::ptrdiff_t tableID = 0; tableID < n; ++tableID) {
+            try {
+                linearise(static_cast<std::size_t>(tableID));
+            }
+            catch (...) {
+                errors[tableID] = std::current_exception();
+            }
+        }
+
+        for (const auto& error : errors) {
+            if (error) { std::rethrow_exception(error); }
+        }
+    }
+
     /// Create linearised, padded TAB vector entries for a collection of
     /// tabulated saturation functions corresponding to a single input
     /// keyword.
     ///
+    /// \param[in,out] tab TAB vector.  The linearised, padded entries,
+    ///    with derivatives included as additional columns, are appended in
+    ///    place.
+    ///
     /// \param[in] numTab Number of tables in this table collection.
     ///
     /// \param[in] numPrim Number of primary look-up keys for each table.
@@ -92,38 +131,30 @@ namespace {
     ///
     /// \param[in] buildDeps Function object that implements the
     ///    protocol outlined for \code BuildDep::operator()()
-    ///    \endcode.  Typically initialised from a lambda expression.
-    ///
-    /// \return Linearised, padded TAB vector entries for a collection of
-    ///    tabulated property functions (e.g., saturation functions or PVT
-    ///    functions) corresponding to a single input keyword.  Derivatives
-    ///    included as additional columns.
-    std::vector<double>
-    createPropfuncTable(const std::size_t numTab,
-                        const std::size_t numPrim,
-                        const std::size_t numRows,
-                        const std::size_t numDep,
-                        const double      fillVal,
-                        const BuildDep&   buildDeps)
+    ///    \endcode.  Typically initialised from a lambda expression.  The
+    ///    tables are independent and may be processed concurrently, so
+    ///    \p buildDeps must only write to the sub-table it is asked for.
+    void
+    createPropfuncTable(std::vector<double>& tab,
+                        const std::size_t    numTab,
+                        const std::size_t    numPrim,
+                        const std::size_t    numRows,
+                        const std::size_t    numDep,
+                        const double         fillVal,
+                        const BuildDep&      buildDeps)
     {
         const auto numCols = 1 + 2*numDep;
 
-        auto descr = ::Opm::DifferentiateOutputTable::Descriptor{};
-
         auto linTable = ::Opm::LinearisedOutputTable {
-            numTab, numPrim, numRows, numCols, fillVal
+            tab, numTab, numPrim, numRows, numCols, fillVal
         };
 
-        // Note unusual loop counters here.  Specifically, we mutate the
-        // members of 'descr' rather than using separate counters, which is
-        // the custom construction.  The reason for this is that these
-        // members are also used in calcSlopes() to indicate which table
-        // subsection to analyse and compute derivatives for.  With separate
-        // loop counters, we would need to form a new table descriptor for
-        // each call to calcSlopes().
-        for (descr.tableID = 0*numTab;
-             descr.tableID < 1*numTab; ++descr.tableID)
+        forEachTable(numTab, numTab*numPrim*numRows*numCols,
+            [numPrim, numDep, &buildDeps, &linTable](const std::size_t tableID)
         {
+            auto descr = ::Opm::DifferentiateOutputTable::Descriptor{};
+            descr.tableID = tableID;
+
             for (descr.primID = 0*numPrim;
                  descr.primID < 1*numPrim; ++descr.primID)
             {
@@ -139,9 +170,7 @@ namespace {
                 //    from namespace ::Opm::DifferentiateOutputTable.
                 calcSlopes(numDep, descr, linTable);
             }
-        }
-
-        return linTable.getDataDestructively();
+        });
     }
 } // Anonymous
 
@@ -186,23 +215,25 @@ namespace { namespace SatFunc {
         ///    protocol outlined for \code BuildDependent::operator()()
         ///    \endcode.  Typically a lambda expression.
         ///
-        /// \return Linearised, padded TAB vector entries for a collection
-        ///    of tabulated saturation functions corresponding to a single
-        ///    input keyword.  Derivatives included as additional columns.
+        /// \param[in,out] tab Receives linearised, padded TAB vector entries
+        ///    for a collection of tabulated saturation functions corresponding
+        ///    to a single input keyword.  Derivatives included as additional
+        ///    columns.
         template <class BuildDependent>
-        std::vector<double>
-        createSatfuncTable(const std::size_t numTab,
-                           const std::size_t numRows,
-                           const std::size_t numDep,
-                           BuildDependent&&  buildDeps)
+        void
+        createSatfuncTable(std::vector<double>& tab,
+                           const std::size_t    numTab,
+                           const std::size_t    numRows,
+                           const std::size_t    numDep,
+                           BuildDependent&&     buildDeps)
         {
             // Saturation functions do not have sub-tables so the number of
             // primary look-up keys is one.
             const auto numPrim = std::size_t{1};
             const auto fillVal = 1.0e20;
 
-            return createPropfuncTable(numTab, numPrim, numRows, numDep, fillVal,
-                                       std::forward<BuildDependent>(buildDeps));
+            createPropfuncTable(tab, numTab, numPrim, numRows, numDep, fillVal,
+                                std::forward<BuildDependent>(buildDeps));
         }
     } // detail
 
@@ -225,20 +256,21 @@ namespace { namespace SatFunc {
         /// \param[in] sgfn Collection of SGFN tables for all saturation
         ///    regions.
         ///
-        /// \return Linearised and padded 'TAB' vector values for output
-        ///    SGFN tables.  A unit-converted copy of the input table \p
-        ///    sgfn with added derivatives.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+        ///    values for output SGFN tables.  A unit-converted copy of the
+        ///    input table \p sgfn with added derivatives.
+        void
         fromSGFN(const std::size_t          numRows,
                  const Opm::UnitSystem&     units,
-                 const Opm::TableContainer& sgfn)
+                 const Opm::TableContainer& sgfn,
+                 std::vector<double>&       tab)
         {
             using SGFN = ::Opm::SgfnTable;
 
             const auto numTab = sgfn.size();
             const auto numDep = std::size_t{2}; // Krg, Pcgo
 
-            return detail::createSatfuncTable(numTab, numRows, numDep,
+            detail::createSatfuncTable(tab, numTab, numRows, numDep,
                 [&units, &sgfn](const std::size_t           tableID,
                                 const std::size_t           primID,
                                 Opm::LinearisedOutputTable& linTable)
@@ -300,20 +332,22 @@ namespace { namespace SatFunc {
         /// \param[in] swof Collection of SGOF tables for all saturation
         ///    regions.
         ///
-        /// \return Linearised and padded 'TAB' vector values for output
-        ///    SGFN tables.  Corresponds to unit-converted copies of columns
-        ///    1, 2, and 4--with added derivatives--of the input SGOF tables.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+        ///    values for output SGFN tables.  Corresponds to unit-converted
+        ///    copies of columns 1, 2, and 4--with added derivatives--of the
+        ///    input SGOF tables.
+        void
         fromSGOF(const std::size_t          numRows,
                  const Opm::UnitSystem&     units,
-                 const Opm::TableContainer& sgof)
+                 const Opm::TableContainer& sgof,
+                 std::vector<double>&       tab)
         {
             using SGOF = ::Opm::SgofTable;
 
             const auto numTab = sgof.size();
             const auto numDep = std::size_t{2}; // Krg, Pcgo
 
-            return detail::createSatfuncTable(numTab, numRows, numDep,
+            detail::createSatfuncTable(tab, numTab, numRows, numDep,
                 [&units, &sgof](const std::size_t           tableID,
                                 const std::size_t           primID,
                                 Opm::LinearisedOutputTable& linTable)
@@ -378,19 +412,20 @@ namespace { namespace SatFunc {
             /// \param[in] sof2 Collection of SOF2 tables for all saturation
             ///   regions.
             ///
-            /// \return Linearised and padded 'TAB' vector values for
-            ///   three-phase SOFN tables.  Essentially just a padded copy
-            ///   of the input SOF2 table--with added derivatives.
-            std::vector<double>
+            /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+            ///    values for three-phase SOFN tables.  Essentially just a
+            ///    padded copy of the input SOF2 table--with added derivatives.
+            void
             fromSOF2(const std::size_t          numRows,
-                     const Opm::TableContainer& sof2)
+                     const Opm::TableContainer& sof2,
+                     std::vector<double>&       tab)
             {
                 using SOF2 = ::Opm::Sof2Table;
 
                 const auto numTab = sof2.size();
                 const auto numDep = std::size_t{1}; // Kro
 
-                return detail::createSatfuncTable(numTab, numRows, numDep,
+                detail::createSatfuncTable(tab, numTab, numRows, numDep,
                     [&sof2](const std::size_t           tableID,
                             const std::size_t           primID,
                             Opm::LinearisedOutputTable& linTable)
@@ -435,21 +470,22 @@ namespace { namespace SatFunc {
             /// \param[in] sgof Collection of SGOF tables for all saturation
             ///    regions.
             ///
-            /// \return Linearised and padded 'TAB' vector values for
-            ///    two-phase SOFN tables.  Corresponds to translated (1-Sg),
-            ///    reverse saturation column (column 1) and reverse column
-            ///    of relative permeability for oil (column 3) from the
+            /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+            ///    values for two-phase SOFN tables.  Corresponds to translated
+            ///    (1-Sg), reverse saturation column (column 1) and reverse
+            ///    column of relative permeability for oil (column 3) from the
             ///    input SGOF table--with added derivatives.
-            std::vector<double>
+            void
             fromSGOF(const std::size_t          numRows,
-                     const Opm::TableContainer& sgof)
+                     const Opm::TableContainer& sgof,
+                     std::vector<double>&       tab)
             {
                 using SGOF = ::Opm::SgofTable;
 
                 const auto numTab = sgof.size();
                 const auto numDep = std::size_t{1}; // Kro
 
-                return detail::createSatfuncTable(numTab, numRows, numDep,
+                detail::createSatfuncTable(tab, numTab, numRows, numDep,
                     [&sgof](const std::size_t           tableID,
                             const std::size_t           primID,
                             Opm::LinearisedOutputTable& linTable)
@@ -510,21 +546,22 @@ namespace { namespace SatFunc {
             /// \param[in] swof Collection of SWOF tables for all saturation
             ///    regions.
             ///
-            /// \return Linearised and padded 'TAB' vector values for
-            ///    two-phase SOFN tables.  Corresponds to translated (1-Sw),
-            ///    reverse saturation column (column 1) and reverse column
-            ///    of relative permeability for oil (column 3) from the
+            /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+            ///    values for two-phase SOFN tables.  Corresponds to translated
+            ///    (1-Sw), reverse saturation column (column 1) and reverse
+            ///    column of relative permeability for oil (column 3) from the
             ///    input SWOF table--with added derivatives.
-            std::vector<double>
+            void
             fromSWOF(const std::size_t          numRows,
-                     const Opm::TableContainer& swof)
+                     const Opm::TableContainer& swof,
+                     std::vector<double>&       tab)
             {
                 using SWOF = ::Opm::SwofTable;
 
                 const auto numTab = swof.size();
                 const auto numDep = std::size_t{1}; // Kro
 
-                return detail::createSatfuncTable(numTab, numRows, numDep,
+                detail::createSatfuncTable(tab, numTab, numRows, numDep,
                     [&swof](const std::size_t           tableID,
                             const std::size_t           primID,
                             Opm::LinearisedOutputTable& linTable)
@@ -808,16 +845,17 @@ namespace { namespace SatFunc {
             /// \param[in] swof Collection of SWOF tables for all saturation
             ///    regions.
             ///
-            /// \return Linearised and padded 'TAB' vector values for
-            ///    three-phase SOFN tables.  Corresponds to column 1 from
-            ///    both of the input SGOF and SWOF tables, as well as column
-            ///    3 from the input SWOF table and column 3 from the input
-            ///    SGOF table--expanded so as to have values for all oil
+            /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+            ///    values for three-phase SOFN tables.  Corresponds to column 1
+            ///    from both of the input SGOF and SWOF tables, as well as
+            ///    column 3 from the input SWOF table and column 3 from the
+            ///    input SGOF table--expanded so as to have values for all oil
             ///    saturation nodes.  Derivatives added in columns 4 and 5.
-            std::vector<double>
+            void
             fromSGOFandSWOF(const std::size_t          numRows,
                             const Opm::TableContainer& sgof,
-                            const Opm::TableContainer& swof)
+                            const Opm::TableContainer& swof,
+                            std::vector<double>&       tab)
             {
                 using SGOF = ::Opm::SgofTable;
                 using SWOF = ::Opm::SwofTable;
@@ -825,7 +863,7 @@ namespace { namespace SatFunc {
                 const auto numTab = sgof.size();
                 const auto numDep = std::size_t{2}; // Krow, Krog
 
-                return detail::createSatfuncTable(numTab, numRows, numDep,
+                detail::createSatfuncTable(tab, numTab, numRows, numDep,
                      [&sgof, &swof](const std::size_t           tableID,
                                     const std::size_t           primID,
                                     Opm::LinearisedOutputTable& linTable)
@@ -879,19 +917,21 @@ namespace { namespace SatFunc {
             /// \param[in] sof3 Collection of SOF3 tables for all saturation
             ///    regions.
             ///
-            /// \return Linearised and padded 'TAB' vector values for output
-            ///    three-phase SOFN tables.  Essentially a padded copy of
-            ///    the input SOF3 tables, \p sof3, with added derivatives.
-            std::vector<double>
+            /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+            ///    values for output three-phase SOFN tables.  Essentially a
+            ///    padded copy of the input SOF3 tables, \p sof3, with added
+            ///    derivatives.
+            void
             fromSOF3(const std::size_t          numRows,
-                     const Opm::TableContainer& sof3)
+                     const Opm::TableContainer& sof3,
+                     std::vector<double>&       tab)
             {
                 using SOF3 = ::Opm::Sof3Table;
 
                 const auto numTab = sof3.size();
                 const auto numDep = std::size_t{2}; // Krow, Krog
 
-                return detail::createSatfuncTable(numTab, numRows, numDep,
+                detail::createSatfuncTable(tab, numTab, numRows, numDep,
                     [&sof3](const std::size_t           tableID,
                             const std::size_t           primID,
                             Opm::LinearisedOutputTable& linTable)
@@ -952,20 +992,21 @@ namespace { namespace SatFunc {
         /// \param[in] swfn Collection of SWFN tables for all saturation
         ///    regions.
         ///
-        /// \return Linearised and padded 'TAB' vector values for output
-        ///    SWFN tables.  A unit-converted copy of the input table \p
-        ///    swfn with added derivatives.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+        ///    values for output SWFN tables.  A unit-converted copy of the
+        ///    input table \p swfn with added derivatives.
+        void
         fromSWFN(const std::size_t          numRows,
                  const Opm::UnitSystem&     units,
-                 const Opm::TableContainer& swfn)
+                 const Opm::TableContainer& swfn,
+                 std::vector<double>&       tab)
         {
             using SWFN = ::Opm::SwfnTable;
 
             const auto numTab = swfn.size();
             const auto numDep = std::size_t{2}; // Krw, Pcow
 
-            return detail::createSatfuncTable(numTab, numRows, numDep,
+            detail::createSatfuncTable(tab, numTab, numRows, numDep,
                 [&swfn, &units](const std::size_t           tableID,
                                 const std::size_t           primID,
                                 Opm::LinearisedOutputTable& linTable)
@@ -1027,20 +1068,22 @@ namespace { namespace SatFunc {
         /// \param[in] swof Collection of SWOF tables for all saturation
         ///    regions.
         ///
-        /// \return Linearised and padded 'TAB' vector values for output
-        ///    SWFN tables.  Corresponds to unit-converted copies of columns
-        ///    1, 2, and 4--with added derivatives--of the input SWOF tables.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+        ///    values for output SWFN tables.  Corresponds to unit-converted
+        ///    copies of columns 1, 2, and 4--with added derivatives--of the
+        ///    input SWOF tables.
+        void
         fromSWOF(const std::size_t          numRows,
                  const Opm::UnitSystem&     units,
-                 const Opm::TableContainer& swof)
+                 const Opm::TableContainer& swof,
+                 std::vector<double>&       tab)
         {
             using SWOF = ::Opm::SwofTable;
 
             const auto numTab = swof.size();
             const auto numDep = std::size_t{2}; // Krw, Pcow
 
-            return detail::createSatfuncTable(numTab, numRows, numDep,
+            detail::createSatfuncTable(tab, numTab, numRows, numDep,
                 [&swof, &units](const std::size_t           tableID,
                                 const std::size_t           primID,
                                 Opm::LinearisedOutputTable& linTable)
@@ -1111,13 +1154,14 @@ namespace { namespace PVTFunc {
         ///
         /// \param[in] pvdg Collection of PVDG tables for all PVT regions.
         ///
-        /// \return Linearised and padded 'TAB' vector values for output gas
-        ///    PVT tables.  A unit-converted copy of the input table \p pvdg
-        ///    with added derivatives.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+        ///    values for output gas PVT tables.  A unit-converted copy of the
+        ///    input table \p pvdg with added derivatives.
+        void
         fromPVDG(const std::size_t          numPressNodes,
                  const Opm::UnitSystem&     units,
-                 const Opm::TableContainer& pvdg)
+                 const Opm::TableContainer& pvdg,
+                 std::vector<double>&       tab)
         {
             // Columns [ Pg, 1/Bg, 1/(Bg*mu_g), derivatives ]
             using PVDG = ::Opm::PvdgTable;
@@ -1130,7 +1174,7 @@ namespace { namespace PVTFunc {
             // PVDG fill value = +2.0e20
             const auto fillVal = +2.0e20;
 
-            return createPropfuncTable(numTab, numPrim, numRows, numDep, fillVal,
+            createPropfuncTable(tab, numTab, numPrim, numRows, numDep, fillVal,
                 [&units, &pvdg](const std::size_t           tableID,
                                 const std::size_t           primID,
                                 Opm::LinearisedOutputTable& linTable)
@@ -1219,14 +1263,15 @@ namespace { namespace PVTFunc {
         ///
         /// \param[in] pvtg Collection of PVTG tables for all PVT regions.
         ///
-        /// \return Linearised and padded 'TAB' vector values for output gas
-        ///    PVT tables.  A unit-converted copy of the input table \p pvtg
-        ///    with added derivatives.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+        ///    values for output gas PVT tables.  A unit-converted copy of the
+        ///    input table \p pvtg with added derivatives.
+        void
         fromPVTG(const std::size_t                  numCompNodes,
                  const std::size_t                  numPressNodes,
                  const Opm::UnitSystem&             units,
-                 const std::vector<Opm::PvtgTable>& pvtg)
+                 const std::vector<Opm::PvtgTable>& pvtg,
+                 std::vector<double>&               tab)
         {
             // Columns [ Rv, 1/Bg, 1/(Bg*mu_g), derivatives ]
             const auto numTab  = pvtg.size();
@@ -1237,7 +1282,7 @@ namespace { namespace PVTFunc {
             // PVTG fill value = -2.0e20
             const auto fillVal = -2.0e20;
 
-            return createPropfuncTable(numTab, numPrim, numRows, numDep, fillVal,
+            createPropfuncTable(tab, numTab, numPrim, numRows, numDep, fillVal,
                 [&units, &pvtg](const std::size_t           tableID,
                                 const std::size_t           primID,
                                 Opm::LinearisedOutputTable& linTable)
@@ -1326,13 +1371,14 @@ namespace { namespace PVTFunc {
         ///
         /// \param[in] pvtg Collection of PVTG tables for all PVT regions.
         ///
-        /// \return Linearised and padded 'TAB' vector values for output gas
-        ///    PVT tables.  A unit-converted copy of the primary keys in
-        ///    input table \p pvtg.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+        ///    values for output gas PVT tables.  A unit-converted copy of the
+        ///    primary keys in input table \p pvtg.
+        void
         pressureNodes(const std::size_t                  numPressNodes,
                       const Opm::UnitSystem&             units,
-                      const std::vector<Opm::PvtgTable>& pvtg)
+                      const std::vector<Opm::PvtgTable>& pvtg,
+                      std::vector<double>&               tab)
         {
             // Columns [ Pg ]
             const auto numTab = pvtg.size();
@@ -1348,7 +1394,7 @@ namespace { namespace PVTFunc {
             // Pressure node fill value = +2.0e20
             const auto fillVal = +2.0e20;
 
-            return createPropfuncTable(numTab, numPrim, numRows, numDep, fillVal,
+            createPropfuncTable(tab, numTab, numPrim, numRows, numDep, fillVal,
                 [&units, &pvtg](const std::size_t           tableID,
                                 const std::size_t           primID,
                                 Opm::LinearisedOutputTable& linTable)
@@ -1456,13 +1502,14 @@ namespace { namespace PVTFunc {
         ///
         /// \param[in] pvcdo Collection of PVCDO tables for all PVT regions.
         ///
-        /// \return Linearised and padded 'TAB' vector values for output oil
-        ///    PVT tables.  A unit-converted copy of the input table \p
-        ///    pvcdo.  No derivative information added.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+        ///    values for output oil PVT tables.  A unit-converted copy of the
+        ///    input table \p pvcdo.  No derivative information added.
+        void
         fromPVCDO(const std::size_t      numPressNodes,
                   const Opm::UnitSystem& units,
-                  const Opm::PvcdoTable& pvcdo)
+                  const Opm::PvcdoTable& pvcdo,
+                  std::vector<double>&   tab)
         {
             // Recall: PvcdoTable is essentially vector<PVCDORecord> with
             //
@@ -1479,8 +1526,8 @@ namespace { namespace PVTFunc {
             // Columns [ Po, Bo, Co, mu_o, Cv ]
             //
             // Single active row per table.  No derivatives.  Can't reuse
-            // createPropfuncTable here, so implement the return value
-            // directly in terms of LinearisedOutputTable.
+            // createPropfuncTable here, so implement the table directly
+            // in terms of LinearisedOutputTable.
 
             const auto numTab  = pvcdo.size();
             const auto numPrim = std::size_t{1};
@@ -1490,7 +1537,7 @@ namespace { namespace PVTFunc {
             const auto fillVal = -1.0e20;
 
             auto lintable = ::Opm::LinearisedOutputTable {
-                numTab, numPrim, numPressNodes, numCols, fillVal
+                tab, numTab, numPrim, numPressNodes, numCols, fillVal
             };
 
             // Note unit hack for compressibility and viscosibility.  The
@@ -1526,8 +1573,6 @@ namespace { namespace PVTFunc {
                 // Viscosibility unit hack here (*to_si()*)
                 *iCv = units.to_si(uPress, t.viscosibility);
             }
-
-            return lintable.getDataDestructively();
         }
 
         /// Create linearised and padded 'TAB' vector entries of normalised
@@ -1546,13 +1591,14 @@ namespace { namespace PVTFunc {
         ///
         /// \param[in] pvdo Collection of PVDO tables for all PVT regions.
         ///
-        /// \return Linearised and padded 'TAB' vector values for output gas
-        ///    PVT tables.  A unit-converted copy of the input table \p pvdo
-        ///    with added derivatives.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+        ///    values for output gas PVT tables.  A unit-converted copy of the
+        ///    input table \p pvdo with added derivatives.
+        void
         fromPVDO(const std::size_t          numPressNodes,
                  const Opm::UnitSystem&     units,
-                 const Opm::TableContainer& pvdo)
+                 const Opm::TableContainer& pvdo,
+                 std::vector<double>&       tab)
         {
             // Columns [ Po, 1/Bo, 1/(Bo*mu_o), derivatives ]
             using PVDO = ::Opm::PvdoTable;
@@ -1565,7 +1611,7 @@ namespace { namespace PVTFunc {
             // PVDO fill value = +2.0e20
             const auto fillVal = +2.0e20;
 
-            return createPropfuncTable(numTab, numPrim, numRows, numDep, fillVal,
+            createPropfuncTable(tab, numTab, numPrim, numRows, numDep, fillVal,
                 [&units, &pvdo](const std::size_t           tableID,
                                 const std::size_t           primID,
                                 Opm::LinearisedOutputTable& linTable)
@@ -1655,14 +1701,15 @@ namespace { namespace PVTFunc {
         ///
         /// \param[in] pvto Collection of PVTO tables for all PVT regions.
         ///
-        /// \return Linearised and padded 'TAB' vector values for output gas
-        ///    PVT tables.  A unit-converted copy of the input table \p pvto
-        ///    with added derivatives.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+        ///    values for output gas PVT tables.  A unit-converted copy of the
+        ///    input table \p pvto with added derivatives.
+        void
         fromPVTO(const std::size_t                  numCompNodes,
                  const std::size_t                  numPressNodes,
                  const Opm::UnitSystem&             units,
-                 const std::vector<Opm::PvtoTable>& pvto)
+                 const std::vector<Opm::PvtoTable>& pvto,
+                 std::vector<double>&               tab)
         {
             // Columns [ Po, 1/Bo, 1/(Bo*mu_o), derivatives ]
             const auto numTab  = pvto.size();
@@ -1673,7 +1720,7 @@ namespace { namespace PVTFunc {
             // PVTO fill value = +2.0e20
             const auto fillVal = +2.0e20;
 
-            return createPropfuncTable(numTab, numPrim, numRows, numDep, fillVal,
+            createPropfuncTable(tab, numTab, numPrim, numRows, numDep, fillVal,
                 [&units, &pvto](const std::size_t           tableID,
                                 const std::size_t           primID,
                                 Opm::LinearisedOutputTable& linTable)
@@ -1762,13 +1809,14 @@ namespace { namespace PVTFunc {
         ///
         /// \param[in] pvto Collection of PVTO tables for all PVT regions.
         ///
-        /// \return Linearised and padded 'TAB' vector values for output oil
-        ///    PVT tables.  A unit-converted copy of the primary keys in
-        ///    input table \p pvto.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised and padded 'TAB' vector
+        ///    values for output oil PVT tables.  A unit-converted copy of the
+        ///    primary keys in input table \p pvto.
+        void
         compositionNodes(const std::size_t                  numCompNodes,
                          const Opm::UnitSystem&             units,
-                         const std::vector<Opm::PvtoTable>& pvto)
+                         const std::vector<Opm::PvtoTable>& pvto,
+                         std::vector<double>&               tab)
         {
             // Columns [ Rs ]
             const auto numTab = pvto.size();
@@ -1783,7 +1831,7 @@ namespace { namespace PVTFunc {
             // PVTO fill value = +2.0e20
             const auto fillVal = +2.0e20;
 
-            return createPropfuncTable(numTab, numPrim, numRows, numDep, fillVal,
+            createPropfuncTable(tab, numTab, numPrim, numRows, numDep, fillVal,
                 [&units, &pvto](const std::size_t           tableID,
                                 const std::size_t           primID,
                                 Opm::LinearisedOutputTable& linTable)
@@ -1883,12 +1931,13 @@ namespace { namespace PVTFunc {
         ///
         /// \param[in] pvtw Collection of PVTW tables for all PVT regions.
         ///
-        /// \return Linearised 'TAB' vector values for output water PVT
-        ///    tables.  A unit-converted, transformed version of the input
-        ///    table \p pvtw.  No derivative information added.
-        std::vector<double>
+        /// \param[in,out] tab Receives linearised 'TAB' vector values for
+        ///    output water PVT tables.  A unit-converted, transformed version
+        ///    of the input table \p pvtw.  No derivative information added.
+        void
         fromPVTW(const Opm::UnitSystem& units,
-                 const Opm::PvtwTable&  pvtw)
+                 const Opm::PvtwTable&  pvtw,
+                 std::vector<double>&   tab)
         {
             // Recall: PvtwTable is essentially vector<PVTWRecord> in which
             //
@@ -1905,8 +1954,8 @@ namespace { namespace PVTFunc {
             // Columns [ Pw, 1/Bw, Cw, 1/(Bw*mu_w), Cw - Cv ]
             //
             // Single row per table.  No derivatives.  Can't reuse
-            // createPropfuncTable here, so implement the return value
-            // directly in terms of LinearisedOutputTable.
+            // createPropfuncTable here, so implement the table directly
+            // in terms of LinearisedOutputTable.
 
             const auto numTab  = pvtw.size();
             const auto numPrim = std::size_t{1};
@@ -1914,7 +1963,7 @@ namespace { namespace PVTFunc {
             const auto numCols = std::size_t{5};
 
             auto lintable = ::Opm::LinearisedOutputTable {
-                numTab, numPrim, numRows, numCols
+                tab, numTab, numPrim, numRows, numCols, 1.0e20
             };
 
             // Note unit hack for compressibility and viscosibility.  The
@@ -1951,8 +2000,6 @@ namespace { namespace PVTFunc {
                 *idiffCwCv =
                     units.to_si(uPress, t.compressibility - t.viscosibility);
             }
-
-            return lintable.getDataDestructively();
         }
     } // Water
 
@@ -1980,6 +2027,16 @@ namespace Opm {
         this->m_tabdims[ TABDIMS_TAB_SIZE_ITEM ] = this->data.size();
     }
 
+    void Tables::addData(const std::size_t                                 offset_index,
+                         const std::function<void(std::vector<double>&)>& appendData)
+    {
+        this->m_tabdims[ offset_index ] = this->data.size() + 1;
+
+        appendData(this->data);
+
+        this->m_tabdims[ TABDIMS_TAB_SIZE_ITEM ] = this->data.size();
+    }
+
 
     namespace {
         struct PvtxDims {
@@ -2016,48 +2073,57 @@ namespace Opm {
         this->m_tabdims[ TABDIMS_NRPVTO_ITEM ] = dims.outer_size;
         this->m_tabdims[ TABDIMS_NPPVTO_ITEM ] = dims.inner_size;
 
+        const size_t composition_stride = dims.inner_size;
+        const size_t table_stride = dims.outer_size * composition_stride;
+        const size_t column_stride = table_stride * dims.num_tables;
+
+        this->addData( TABDIMS_IBPVTO_OFFSET_ITEM , [&](std::vector<double>& tab)
         {
-            std::vector<double> pvtoData( dims.data_size , default_value );
-            std::vector<double> rs_values( dims.num_tables * dims.outer_size  , default_value );
-            size_t composition_stride = dims.inner_size;
-            size_t table_stride = dims.outer_size * composition_stride;
-            size_t column_stride = table_stride * pvtoTables.size();
-
-            size_t table_index = 0;
-            for (const auto& table : pvtoTables) {
+            const size_t offset = tab.size();
+            tab.resize( offset + dims.data_size , default_value );
+            double* pvtoData = tab.data() + offset;
+
+            forEachTable( dims.num_tables , dims.data_size , [&](size_t table_index)
+            {
                 size_t composition_index = 0;
-                for (const auto& underSatTable : table) {
+                for (const auto& underSatTable : pvtoTables[table_index]) {
                     const auto& p  = underSatTable.getColumn("P");
                     const auto& bo = underSatTable.getColumn("BO");
                     const auto& mu = underSatTable.getColumn("MU");
+                    const size_t num_rows = p.size();
 
-                    for (size_t row = 0; row < p.size(); row++) {
-                        size_t data_index = row + composition_stride * composition_index + table_stride * table_index;
+                    double* p_out  = pvtoData + composition_stride * composition_index + table_stride * table_index;
+                    double* bo_out = p_out + column_stride;
+                    double* mu_out = p_out + 2*column_stride;
 
-                        pvtoData[ data_index ]                  = this->units.from_si( UnitSystem::measure::pressure, p[row]);
-                        pvtoData[ data_index + column_stride ]  = 1.0 / bo[row];
-                        pvtoData[ data_index + 2*column_stride] = this->units.from_si( UnitSystem::measure::viscosity , mu[row]) / bo[row];
-                    }
                     composition_index++;
+                    if (num_rows == 0)
+                        continue;
+
+                    this->units.from_si( UnitSystem::measure::pressure , &*p.begin() , p_out , num_rows );
+                    this->units.from_si( UnitSystem::measure::viscosity , &*mu.begin() , mu_out , num_rows );
+                    for (size_t row = 0; row < num_rows; row++) {
+                        bo_out[row] = 1.0 / bo[row];
+                        mu_out[row] /= bo[row];
+                    }
                 }
+            });
+        });
 
-                /*
-                  The RS values which apply for one inner table each
-                  are added as a separate data vector to the TABS
-                  array.
-                */
-                {
-                    const auto& sat_table = table.getSaturatedTable();
-                    const auto& rs = sat_table.getColumn("RS");
-                    for (size_t index = 0; index < rs.size(); index++)
-                        rs_values[index + table_index * dims.outer_size ] = rs[index];
-                }
-                table_index++;
-            }
+        /*
+          The RS values which apply for one inner table each are added as
+          a separate data vector to the TABS array.
+        */
+        this->addData( TABDIMS_JBPVTO_OFFSET_ITEM , [&](std::vector<double>& tab)
+        {
+            const size_t offset = tab.size();
+            tab.resize( offset + dims.num_tables * dims.outer_size , default_value );
 
-            this->addData( TABDIMS_IBPVTO_OFFSET_ITEM , pvtoData );
-            this->addData( TABDIMS_JBPVTO_OFFSET_ITEM , rs_values );
-        }
+            for (size_t table_index = 0; table_index < dims.num_tables; table_index++) {
+                const auto& rs = pvtoTables[table_index].getSaturatedTable().getColumn("RS");
+                std::copy( rs.begin() , rs.end() , tab.begin() + offset + table_index * dims.outer_size );
+            }
+        });
     }
 
     void Tables::addPVTG( const std::vector<PvtgTable>& pvtgTables) {
@@ -2067,46 +2133,50 @@ namespace Opm {
         this->m_tabdims[ TABDIMS_NRPVTG_ITEM ] = dims.outer_size;
         this->m_tabdims[ TABDIMS_NPPVTG_ITEM ] = dims.inner_size;
 
-        {
-            std::vector<double> pvtgData( dims.data_size , default_value );
-            std::vector<double> p_values( dims.num_tables * dims.outer_size  , default_value );
-            size_t composition_stride = dims.inner_size;
-            size_t table_stride = dims.outer_size * composition_stride;
-            size_t column_stride = table_stride * dims.num_tables;
-
-            size_t table_index = 0;
-            for (const auto& table : pvtgTables) {
-                size_t composition_index = 0;
-                for (const auto& underSatTable : table) {
-                    const auto& col0 = underSatTable.getColumn(0);
-                    const auto& col1 = underSatTable.getColumn(1);
-                    const auto& col2 = underSatTable.getColumn(2);
+        const size_t composition_stride = dims.inner_size;
+        const size_t table_stride = dims.outer_size * composition_stride;
+        const size_t column_stride = table_stride * dims.num_tables;
 
-                    for (size_t row = 0; row < col0.size(); row++) {
-                        size_t data_index = row + composition_stride * composition_index + table_stride * table_index;
+        this->addData( TABDIMS_IBPVTG_OFFSET_ITEM , [&](std::vector<double>& tab)
+        {
+            const size_t offset = tab.size();
+            tab.resize( offset + dims.data_size , default_value );
+            double* pvtgData = tab.data() + offset;
 
-                        pvtgData[ data_index ]                  = this->units.from_si( UnitSystem::measure::gas_oil_ratio, col0[row]);
-                        pvtgData[ data_index + column_stride ]  = this->units.from_si( UnitSystem::measure::gas_oil_ratio, col1[row]);
-                        pvtgData[ data_index + 2*column_stride] = this->units.from_si( UnitSystem::measure::viscosity , col2[row]);
+            forEachTable( dims.num_tables , dims.data_size , [&](size_t table_index)
+            {
+                size_t composition_index = 0;
+                for (const auto& underSatTable : pvtgTables[table_index]) {
+                    double* out = pvtgData + composition_stride * composition_index + table_stride * table_index;
+                    const auto measures = { UnitSystem::measure::gas_oil_ratio,
+                                            UnitSystem::measure::gas_oil_ratio,
+                                            UnitSystem::measure::viscosity };
+
+                    size_t column_index = 0;
+                    for (const auto measure : measures) {
+                        const auto& column = underSatTable.getColumn( column_index );
+                        if (column.size() > 0)
+                            this->units.from_si( measure , &*column.begin() , out + column_index * column_stride , column.size() );
+
+                        column_index++;
                     }
 
                     composition_index++;
                 }
+            });
+        });
 
-                {
-                    const auto& sat_table = table.getSaturatedTable();
-                    const auto& p = sat_table.getColumn("PG");
-                    for (size_t index = 0; index < p.size(); index++)
-                        p_values[index + table_index * dims.outer_size ] =
-                            this->units.from_si( UnitSystem::measure::pressure , p[index]);
-                }
+        this->addData( TABDIMS_JBPVTG_OFFSET_ITEM , [&](std::vector<double>& tab)
+        {
+            const size_t offset = tab.size();
+            tab.resize( offset + dims.num_tables * dims.outer_size , default_value );
 
-                table_index++;
+            for (size_t table_index = 0; table_index < dims.num_tables; table_index++) {
+                const auto& p = pvtgTables[table_index].getSaturatedTable().getColumn("PG");
+                if (p.size() > 0)
+                    this->units.from_si( UnitSystem::measure::pressure , &*p.begin() , tab.data() + offset + table_index * dims.outer_size , p.size() );
             }
-
-            this->addData( TABDIMS_IBPVTG_OFFSET_ITEM , pvtgData );
-            this->addData( TABDIMS_JBPVTG_OFFSET_ITEM , p_values );
-        }
+        });
     }
 
     void Tables::addPVTW( const PvtwTable& pvtwTable)
@@ -2217,10 +2287,10 @@ namespace Opm {
         if (gas) {
             const auto& tables = tabMgr.getSgofTables();
 
-            const auto sgfn =
-                SatFunc::Gas::fromSGOF(nssfun, this->units, tables);
-
-            this->addData(TABDIMS_IBSGFN_OFFSET_ITEM, sgfn);
+            this->addData(TABDIMS_IBSGFN_OFFSET_ITEM, [&](std::vector<double>& tab)
+            {
+                SatFunc::Gas::fromSGOF(nssfun, this->units, tables, tab);
+            });
             this->m_tabdims[TABDIMS_NSSGFN_ITEM] = nssfun;
             this->m_tabdims[TABDIMS_NTSGFN_ITEM] = tables.size();
         }
@@ -2229,20 +2299,20 @@ namespace Opm {
             if (gas && !wat) {  // 2p G/O System
                 const auto& tables = tabMgr.getSgofTables();
 
-                const auto sofn =
-                    SatFunc::Oil::TwoPhase::fromSGOF(nssfun, tables);
-
-                this->addData(TABDIMS_IBSOFN_OFFSET_ITEM, sofn);
+                this->addData(TABDIMS_IBSOFN_OFFSET_ITEM, [&](std::vector<double>& tab)
+                {
+                    SatFunc::Oil::TwoPhase::fromSGOF(nssfun, tables, tab);
+                });
                 this->m_tabdims[TABDIMS_NSSOFN_ITEM] = nssfun;
                 this->m_tabdims[TABDIMS_NTSOFN_ITEM] = tables.size();
             }
             else if (wat && !gas) { // 2p O/W System
                 const auto& tables = tabMgr.getSwofTables();
 
-                const auto sofn =
-                    SatFunc::Oil::TwoPhase::fromSWOF(nssfun, tables);
-
-                this->addData(TABDIMS_IBSOFN_OFFSET_ITEM, sofn);
+                this->addData(TABDIMS_IBSOFN_OFFSET_ITEM, [&](std::vector<double>& tab)
+                {
+                    SatFunc::Oil::TwoPhase::fromSWOF(nssfun, tables, tab);
+                });
                 this->m_tabdims[TABDIMS_NSSOFN_ITEM] = nssfun;
                 this->m_tabdims[TABDIMS_NTSOFN_ITEM] = tables.size();
             }
@@ -2254,10 +2324,10 @@ namespace Opm {
 
                 const auto numRows = 2 * nssfun;
 
-                const auto sofn = SatFunc::Oil::ThreePhase::
-                    fromSGOFandSWOF(numRows, sgof, swof);
-
-                this->addData(TABDIMS_IBSOFN_OFFSET_ITEM, sofn);
+                this->addData(TABDIMS_IBSOFN_OFFSET_ITEM, [&](std::vector<double>& tab)
+                {
+                    SatFunc::Oil::ThreePhase::fromSGOFandSWOF(numRows, sgof, swof, tab);
+                });
                 this->m_tabdims[TABDIMS_NSSOFN_ITEM] = numRows;
                 this->m_tabdims[TABDIMS_NTSOFN_ITEM] = sgof.size();
             }
@@ -2266,10 +2336,10 @@ namespace Opm {
         if (wat) {
             const auto& tables = tabMgr.getSwofTables();
 
-            const auto swfn =
-                SatFunc::Water::fromSWOF(nssfun, this->units, tables);
-
-            this->addData(TABDIMS_IBSWFN_OFFSET_ITEM, swfn);
+            this->addData(TABDIMS_IBSWFN_OFFSET_ITEM, [&](std::vector<double>& tab)
+            {
+                SatFunc::Water::fromSWOF(nssfun, this->units, tables, tab);
+            });
             this->m_tabdims[TABDIMS_NSSWFN_ITEM] = nssfun;
             this->m_tabdims[TABDIMS_NTSWFN_ITEM] = tables.size();
         }
@@ -2287,10 +2357,10 @@ namespace Opm {
         if (gas) {
             const auto& tables = tabMgr.getSgfnTables();
 
-            const auto sgfn =
-                SatFunc::Gas::fromSGFN(nssfun, this->units, tables);
-
-            this->addData(TABDIMS_IBSGFN_OFFSET_ITEM, sgfn);
+            this->addData(TABDIMS_IBSGFN_OFFSET_ITEM, [&](std::vector<double>& tab)
+            {
+                SatFunc::Gas::fromSGFN(nssfun, this->units, tables, tab);
+            });
             this->m_tabdims[TABDIMS_NSSGFN_ITEM] = nssfun;
             this->m_tabdims[TABDIMS_NTSGFN_ITEM] = tables.size();
         }
@@ -2299,20 +2369,20 @@ namespace Opm {
             if (gas + wat == 1) { // 2p G/O or O/W System
                 const auto& tables = tabMgr.getSof2Tables();
 
-                const auto sofn =
-                    SatFunc::Oil::TwoPhase::fromSOF2(nssfun, tables);
-
-                this->addData(TABDIMS_IBSOFN_OFFSET_ITEM, sofn);
+                this->addData(TABDIMS_IBSOFN_OFFSET_ITEM, [&](std::vector<double>& tab)
+                {
+                    SatFunc::Oil::TwoPhase::fromSOF2(nssfun, tables, tab);
+                });
                 this->m_tabdims[TABDIMS_NSSOFN_ITEM] = nssfun;
                 this->m_tabdims[TABDIMS_NTSOFN_ITEM] = tables.size();
             }
             else {              // 3p G/O/W System
                 const auto& tables = tabMgr.getSof3Tables();
 
-                const auto sofn =
-                    SatFunc::Oil::ThreePhase::fromSOF3(nssfun, tables);
-
-                this->addData(TABDIMS_IBSOFN_OFFSET_ITEM, sofn);
+                this->addData(TABDIMS_IBSOFN_OFFSET_ITEM, [&](std::vector<double>& tab)
+                {
+                    SatFunc::Oil::ThreePhase::fromSOF3(nssfun, tables, tab);
+                });
                 this->m_tabdims[TABDIMS_NSSOFN_ITEM] = nssfun;
                 this->m_tabdims[TABDIMS_NTSOFN_ITEM] = tables.size();
             }
@@ -2321,10 +2391,10 @@ namespace Opm {
         if (wat) {
             const auto& tables = tabMgr.getSwfnTables();
 
-            const auto swfn =
-                SatFunc::Water::fromSWFN(nssfun, this->units, tables);
-
-            this->addData(TABDIMS_IBSWFN_OFFSET_ITEM, swfn);
+            this->addData(TABDIMS_IBSWFN_OFFSET_ITEM, [&](std::vector<double>& tab)
+            {
+                SatFunc::Water::fromSWFN(nssfun, this->units, tables, tab);
+            });
             this->m_tabdims[TABDIMS_NSSWFN_ITEM] = nssfun;
             this->m_tabdims[TABDIMS_NTSWFN_ITEM] = tables.size();
         }
@@ -2355,14 +2425,15 @@ namespace Opm {
             const auto numPrimary =
                 std::max(numPressNodes, PVTFunc::Gas::maxNumPressNodes(pvtg));
 
-            const auto tableData = PVTFunc::Gas::
-                fromPVTG(numCompNodes, numPrimary, this->units, pvtg);
-
-            const auto pressData = PVTFunc::Gas::
-                pressureNodes(numPrimary, this->units, pvtg);
+            this->addData(TABDIMS_IBPVTG_OFFSET_ITEM, [&](std::vector<double>& tab)
+            {
+                PVTFunc::Gas::fromPVTG(numCompNodes, numPrimary, this->units, pvtg, tab);
+            });
 
-            this->addData(TABDIMS_IBPVTG_OFFSET_ITEM, tableData);
-            this->addData(TABDIMS_JBPVTG_OFFSET_ITEM, pressData);
+            this->addData(TABDIMS_JBPVTG_OFFSET_ITEM, [&](std::vector<double>& tab)
+            {
+                PVTFunc::Gas::pressureNodes(numPrimary, this->units, pvtg, tab);
+            });
 
             this->m_tabdims[TABDIMS_NPPVTG_ITEM] = numPrimary;
             this->m_tabdims[TABDIMS_NRPVTG_ITEM] = numCompNodes;
@@ -2375,9 +2446,10 @@ namespace Opm {
             const auto numRows =
                 std::max(numPressNodes, PVTFunc::Gas::maxNumPressNodes(pvdg));
 
-            const auto tableData = PVTFunc::Gas::fromPVDG(numRows, this->units, pvdg);
-
-            this->addData(TABDIMS_IBPVTG_OFFSET_ITEM, tableData);
+            this->addData(TABDIMS_IBPVTG_OFFSET_ITEM, [&](std::vector<double>& tab)
+            {
+                PVTFunc::Gas::fromPVDG(numRows, this->units, pvdg, tab);
+            });
             this->m_tabdims[TABDIMS_NPPVTG_ITEM] = numRows;
             this->m_tabdims[TABDIMS_NTPVTG_ITEM] = pvdg.size();
         }
@@ -2409,14 +2481,15 @@ namespace Opm {
             const auto numRows =
                 std::max(numPressNodes, PVTFunc::Oil::maxNumPressNodes(pvto));
 
-            const auto tableData = PVTFunc::Oil::
-                fromPVTO(numCompNodes, numRows, this->units, pvto);
-
-            const auto rsData = PVTFunc::Oil::
-                compositionNodes(numCompNodes, this->units, pvto);
+            this->addData(TABDIMS_IBPVTO_OFFSET_ITEM, [&](std::vector<double>& tab)
+            {
+                PVTFunc::Oil::fromPVTO(numCompNodes, numRows, this->units, pvto, tab);
+            });
 
-            this->addData(TABDIMS_IBPVTO_OFFSET_ITEM, tableData);
-            this->addData(TABDIMS_JBPVTO_OFFSET_ITEM, rsData);
+            this->addData(TABDIMS_JBPVTO_OFFSET_ITEM, [&](std::vector<double>& tab)
+            {
+                PVTFunc::Oil::compositionNodes(numCompNodes, this->units, pvto, tab);
+            });
 
             this->m_tabdims[TABDIMS_NPPVTO_ITEM] = numRows;
             this->m_tabdims[TABDIMS_NRPVTO_ITEM] = numCompNodes;
@@ -2429,9 +2502,10 @@ namespace Opm {
             const auto numRows =
                 std::max(numPressNodes, PVTFunc::Oil::maxNumPressNodes(pvdo));
 
-            const auto tableData = PVTFunc::Oil::fromPVDO(numRows, this->units, pvdo);
-
-            this->addData(TABDIMS_IBPVTO_OFFSET_ITEM, tableData);
+            this->addData(TABDIMS_IBPVTO_OFFSET_ITEM, [&](std::vector<double>& tab)
+            {
+                PVTFunc::Oil::fromPVDO(numRows, this->units, pvdo, tab);
+            });
             this->m_tabdims[TABDIMS_NPPVTO_ITEM] = numRows;
             this->m_tabdims[TABDIMS_NTPVTO_ITEM] = pvdo.size();
         }
@@ -2441,9 +2515,10 @@ namespace Opm {
 
             const auto numRows = std::max(numPressNodes, pvcdo.size());
 
-            const auto tableData = PVTFunc::Oil::fromPVCDO(numRows, this->units, pvcdo);
-
-            this->addData(TABDIMS_IBPVTO_OFFSET_ITEM, tableData);
+            this->addData(TABDIMS_IBPVTO_OFFSET_ITEM, [&](std::vector<double>& tab)
+            {
+                PVTFunc::Oil::fromPVCDO(numRows, this->units, pvcdo, tab);
+            });
             this->m_tabdims[TABDIMS_NPPVTO_ITEM] = numRows;
             this->m_tabdims[TABDIMS_NTPVTO_ITEM] = pvcdo.size();
         }
@@ -2459,9 +2534,10 @@ namespace Opm {
             return;
         }
 
-        const auto tableData = PVTFunc::Water::fromPVTW(this->units, pvtw);
-
-        this->addData(TABDIMS_IBPVTW_OFFSET_ITEM, tableData);
+        this->addData(TABDIMS_IBPVTW_OFFSET_ITEM, [&](std::vector<double>& tab)
+        {
+            PVTFunc::Water::fromPVTW(this->units, pvtw, tab);
+        });
         this->m_tabdims[TABDIMS_NTPVTW_ITEM] = pvtw.size();
     }
 
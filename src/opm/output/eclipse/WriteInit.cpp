@@ -43,6 +43,7 @@
 
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <exception>
 #include <initializer_list>
@@ -228,9 +229,43 @@ namespace {
 
     // =================================================================
 
-    std::vector<float> singlePrecision(const std::vector<double>& x)
+    // Output single precision array of active cell values.  The value of
+    // each active cell is computed by cellValue(globalCell) and narrowed to
+    // float one range of output blocks at a time, with the cells of each
+    // range split between threads; no full-size temporary array is formed.
+    // The cellValue callback must therefore be safe to call concurrently.
+    template <class CellValue>
+    void writeActiveCellsSinglePrecision(const std::string&                       kw,
+                                         const ::Opm::EclipseGrid&                grid,
+                                         CellValue&&                              cellValue,
+                                         ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
-        return { x.begin(), x.end() };
+        const auto& activeMap = grid.getActiveMap();
+
+        initFile.write(kw, activeMap.size(),
+            [&activeMap, &cellValue](const std::size_t begin,
+                                     const std::size_t end,
+                                     float*            block)
+        {
+#pragma omp parallel for
+            for (auto i = begin; i < end; ++i) {
+                block[i - begin] = static_cast<float>(cellValue(activeMap[i]));
+            }
+        });
+    }
+
+    void writeSinglePrecision(const std::string&                       kw,
+                              const std::vector<double>&               x,
+                              ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
+    {
+        initFile.write(kw, x.size(),
+            [&x](const std::size_t begin, const std::size_t end, float* block)
+        {
+#pragma omp parallel for
+            for (auto i = begin; i < end; ++i) {
+                block[i - begin] = static_cast<float>(x[i]);
+            }
+        });
     }
 
     ::Opm::RestartIO::LogiHEAD::PVTModel
@@ -285,10 +320,10 @@ namespace {
         return lh.data();
     }
 
-    void writeInitFileHeader(const ::Opm::EclipseState&      es,
-                             const ::Opm::EclipseGrid&       grid,
-                             const ::Opm::Schedule&          sched,
-                             Opm::EclIO::OutputStream::Init& initFile)
+    void writeInitFileHeader(const ::Opm::EclipseState&             es,
+                             const ::Opm::EclipseGrid&              grid,
+                             const ::Opm::Schedule&                 sched,
+                             Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
         {
             const auto ih = ::Opm::RestartIO::Helpers::
@@ -309,47 +344,54 @@ namespace {
         }
     }
 
-    void writePoreVolume(const ::Opm::EclipseState&        es,
-                         const ::Opm::EclipseGrid&         grid,
-                         const ::Opm::UnitSystem&          units,
-                         ::Opm::EclIO::OutputStream::Init& initFile)
+    void writePoreVolume(const ::Opm::EclipseState&               es,
+                         const ::Opm::EclipseGrid&                grid,
+                         const ::Opm::UnitSystem&                 units,
+                         ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
-        auto porv = es.get3DProperties()
+        const auto& porv = es.get3DProperties()
             .getDoubleGridProperty("PORV").getData();
 
-        for (auto nGlob    = porv.size(),
-                  globCell = 0*nGlob; globCell < nGlob; ++globCell)
-        {
-            if (! grid.cellActive(globCell)) {
-                porv[globCell] = 0.0;
-            }
-        }
+        const auto volume = ::Opm::UnitSystem::measure::volume;
 
-        units.from_si(::Opm::UnitSystem::measure::volume, porv);
+        // PORV is output for all cells, with zero in the inactive cells.
+        initFile.write("PORV", porv.size(),
+            [&porv, &grid, &units, volume](const std::size_t begin,
+                                           const std::size_t end,
+                                           float*            block)
+        {
+#pragma omp parallel for
+            for (auto globCell = begin; globCell < end; ++globCell) {
+                const auto pv = grid.cellActive(globCell) ? porv[globCell] : 0.0;
 
-        initFile.write("PORV", singlePrecision(porv));
+                block[globCell - begin] = static_cast<float>(units.from_si(volume, pv));
+            }
+        });
     }
 
-    void writeGridGeometry(const ::Opm::EclipseGrid&         grid,
-                           const ::Opm::UnitSystem&          units,
-                           ::Opm::EclIO::OutputStream::Init& initFile)
+    void writeGridGeometry(const ::Opm::EclipseGrid&                grid,
+                           const ::Opm::UnitSystem&                 units,
+                           ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
         const auto length = ::Opm::UnitSystem::measure::length;
         const auto nAct   = grid.getNumActive();
 
-        auto dx    = std::vector<float>{};  dx   .reserve(nAct);
-        auto dy    = std::vector<float>{};  dy   .reserve(nAct);
-        auto dz    = std::vector<float>{};  dz   .reserve(nAct);
-        auto depth = std::vector<float>{};  depth.reserve(nAct);
+        auto dx    = std::vector<float>(nAct);
+        auto dy    = std::vector<float>(nAct);
+        auto dz    = std::vector<float>(nAct);
+        auto depth = std::vector<float>(nAct);
 
+        // The cell geometry is the most expensive part of the INIT file
+        // and every cell is independent of the others.
+#pragma omp parallel for
         for (auto cell = 0*nAct; cell < nAct; ++cell) {
             const auto  globCell = grid.getGlobalIndex(cell);
             const auto& dims     = grid.getCellDims(globCell);
 
-            dx   .push_back(units.from_si(length, dims[0]));
-            dy   .push_back(units.from_si(length, dims[1]));
-            dz   .push_back(units.from_si(length, dims[2]));
-            depth.push_back(units.from_si(length, grid.getCellDepth(globCell)));
+            dx   [cell] = units.from_si(length, dims[0]);
+            dy   [cell] = units.from_si(length, dims[1]);
+            dz   [cell] = units.from_si(length, dims[2]);
+            depth[cell] = units.from_si(length, grid.getCellDepth(globCell));
         }
 
         initFile.write("DEPTH", depth);
@@ -358,11 +400,12 @@ namespace {
         initFile.write("DZ"   , dz);
     }
 
-    template <typename T, class WriteVector>
-    void writeCellPropertiesWithDefaultFlag(const Properties& propList,
-                                            const ::Opm::GridProperties<T>& propValues,
-                                            const ::Opm::EclipseGrid&       grid,
-                                            WriteVector&&                   write)
+    void writeDoubleCellProperties(const Properties&                        propList,
+                                   const ::Opm::GridProperties<double>&     propValues,
+                                   const ::Opm::EclipseGrid&                grid,
+                                   const ::Opm::UnitSystem&                 units,
+                                   const bool                               needDflt,
+                                   ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
         for (const auto& prop : propList) {
             if (! propValues.hasKeyword(prop.name)) {
@@ -370,74 +413,36 @@ namespace {
             }
 
             const auto& opm_property = propValues.getKeyword(prop.name);
-            const auto& dflt         = opm_property.wasDefaulted();
-
-            write(prop, grid.compressedVector(dflt),
-                  opm_property.compressedCopy(grid));
-        }
-    }
-
-    template <typename T, class WriteVector>
-    void writeCellPropertiesValuesOnly(const Properties& propList,
-                                       const ::Opm::GridProperties<T>& propValues,
-                                       const ::Opm::EclipseGrid&       grid,
-                                       WriteVector&&                   write)
-    {
-        for (const auto& prop : propList) {
-            if (! propValues.hasKeyword(prop.name)) {
-                continue;
+            const auto& value        = opm_property.getData();
+            const auto  unit         = prop.unit;
+
+            if (needDflt) {
+                const auto& dflt = opm_property.wasDefaulted();
+
+                writeActiveCellsSinglePrecision(prop.name, grid,
+                    [&value, &dflt, &units, unit](const int globCell) -> double
+                {
+                    // Output sentinel value (-1.0e+20) to signify
+                    // defaulted element.
+                    return dflt[globCell]
+                        ? static_cast<double>(-1.0e+20f)
+                        : units.from_si(unit, value[globCell]);
+                }, initFile);
+            }
+            else {
+                writeActiveCellsSinglePrecision(prop.name, grid,
+                    [&value, &units, unit](const int globCell) -> double
+                {
+                    return units.from_si(unit, value[globCell]);
+                }, initFile);
             }
-
-            const auto& opm_property = propValues.getKeyword(prop.name);
-
-            write(prop, opm_property.compressedCopy(grid));
-        }
-    }
-
-    void writeDoubleCellProperties(const Properties&                    propList,
-                                   const ::Opm::GridProperties<double>& propValues,
-                                   const ::Opm::EclipseGrid&            grid,
-                                   const ::Opm::UnitSystem&             units,
-                                   const bool                           needDflt,
-                                   ::Opm::EclIO::OutputStream::Init&    initFile)
-    {
-        if (needDflt) {
-            writeCellPropertiesWithDefaultFlag(propList, propValues, grid,
-                [&units, &initFile](const CellProperty&   prop,
-                                    std::vector<bool>&&   dflt,
-                                    std::vector<double>&& value)
-            {
-                units.from_si(prop.unit, value);
-
-                for (auto n = dflt.size(), i = decltype(n){}; i < n; ++i) {
-                    if (dflt[i]) {
-                        // Element defaulted.  Output sentinel value
-                        // (-1.0e+20) to signify defaulted element.
-                        //
-                        // Note: Start as float for roundtripping through
-                        // function singlePrecision().
-                        value[i] = static_cast<double>(-1.0e+20f);
-                    }
-                }
-
-                initFile.write(prop.name, singlePrecision(value));
-            });
-        }
-        else {
-            writeCellPropertiesValuesOnly(propList, propValues, grid,
-                [&units, &initFile](const CellProperty&   prop,
-                                    std::vector<double>&& value)
-            {
-                units.from_si(prop.unit, value);
-                initFile.write(prop.name, singlePrecision(value));
-            });
         }
     }
 
-    void writeDoubleCellProperties(const ::Opm::EclipseState&        es,
-                                   const ::Opm::EclipseGrid&         grid,
-                                   const ::Opm::UnitSystem&          units,
-                                   ::Opm::EclIO::OutputStream::Init& initFile)
+    void writeDoubleCellProperties(const ::Opm::EclipseState&               es,
+                                   const ::Opm::EclipseGrid&                grid,
+                                   const ::Opm::UnitSystem&                 units,
+                                   ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
         const auto doubleKeywords = Properties {
             {"PORO"  , ::Opm::UnitSystem::measure::identity },
@@ -457,9 +462,9 @@ namespace {
                                   grid, units, false, initFile);
     }
 
-    void writeIntegerCellProperties(const ::Opm::EclipseState&        es,
-                                    const ::Opm::EclipseGrid&         grid,
-                                    ::Opm::EclIO::OutputStream::Init& initFile)
+    void writeIntegerCellProperties(const ::Opm::EclipseState&               es,
+                                    const ::Opm::EclipseGrid&                grid,
+                                    ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
         const auto& properties = es.get3DProperties().getIntProperties();
 
@@ -480,20 +485,30 @@ namespace {
         }
     }
 
-    void writeSimulatorProperties(const ::Opm::EclipseGrid&         grid,
-                                  const ::Opm::data::Solution&      simProps,
-                                  ::Opm::EclIO::OutputStream::Init& initFile)
+    void writeSimulatorProperties(const ::Opm::EclipseGrid&                grid,
+                                  const ::Opm::data::Solution&             simProps,
+                                  ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
         for (const auto& prop : simProps) {
-            const auto& value = grid.compressedVector(prop.second.data);
+            const auto& value = prop.second.data;
+
+            if (value.size() == grid.getNumActive()) {
+                writeSinglePrecision(prop.first, value, initFile);
+                continue;
+            }
+
+            if (value.size() != grid.getCartesianSize())
+                throw std::invalid_argument("Input vector must have full size");
 
-            initFile.write(prop.first, singlePrecision(value));
+            writeActiveCellsSinglePrecision(prop.first, grid,
+                [&value](const int globCell) { return value[globCell]; },
+                initFile);
         }
     }
 
-    void writeTableData(const ::Opm::EclipseState&        es,
-                        const ::Opm::UnitSystem&          units,
-                        ::Opm::EclIO::OutputStream::Init& initFile)
+    void writeTableData(const ::Opm::EclipseState&               es,
+                        const ::Opm::UnitSystem&                 units,
+                        ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
         ::Opm::Tables tables(units);
 
@@ -505,8 +520,8 @@ namespace {
         initFile.write("TAB"    , tables.tab());
     }
 
-    void writeIntegerMaps(std::map<std::string, std::vector<int>> mapData,
-                          ::Opm::EclIO::OutputStream::Init&       initFile)
+    void writeIntegerMaps(std::map<std::string, std::vector<int>>  mapData,
+                          ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
         for (const auto& pair : mapData) {
             const auto& key = pair.first;
@@ -521,11 +536,11 @@ namespace {
         }
     }
 
-    void writeFilledSatFuncScaling(const Properties&                 propList,
-                                   ::Opm::GridProperties<double>&&   propValues,
-                                   const ::Opm::EclipseGrid&         grid,
-                                   const ::Opm::UnitSystem&          units,
-                                   ::Opm::EclIO::OutputStream::Init& initFile)
+    void writeFilledSatFuncScaling(const Properties&                        propList,
+                                   ::Opm::GridProperties<double>&&          propValues,
+                                   const ::Opm::EclipseGrid&                grid,
+                                   const ::Opm::UnitSystem&                 units,
+                                   ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
         for (const auto& prop : propList) {
             propValues.assertKeyword(prop.name);
@@ -536,10 +551,10 @@ namespace {
                                   units, false, initFile);
     }
 
-    void writeSatFuncScaling(const ::Opm::EclipseState&        es,
-                             const ::Opm::EclipseGrid&         grid,
-                             const ::Opm::UnitSystem&          units,
-                             ::Opm::EclIO::OutputStream::Init& initFile)
+    void writeSatFuncScaling(const ::Opm::EclipseState&               es,
+                             const ::Opm::EclipseGrid&                grid,
+                             const ::Opm::UnitSystem&                 units,
+                             ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
         const auto epsVectors = ScalingVectors{}
             .withHysteresis(es.runspec().hysterPar().active())
@@ -569,30 +584,33 @@ namespace {
         }
     }
 
-    void writeNonNeighbourConnections(const ::Opm::NNC&                 nnc,
-                                      const ::Opm::UnitSystem&          units,
-                                      ::Opm::EclIO::OutputStream::Init& initFile)
+    void writeNonNeighbourConnections(const ::Opm::NNC&                        nnc,
+                                      const ::Opm::UnitSystem&                 units,
+                                      ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
     {
-        auto tran = std::vector<double>{};
-        tran.reserve(nnc.numNNC());
+        const auto& nncdata = nnc.nncdata();
+        const auto  trans   = ::Opm::UnitSystem::measure::transmissibility;
 
-        for (const auto& nd : nnc.nncdata()) {
-            tran.push_back(nd.trans);
-        }
-
-        units.from_si(::Opm::UnitSystem::measure::transmissibility, tran);
-
-        initFile.write("TRANNNC", singlePrecision(tran));
+        initFile.write("TRANNNC", nncdata.size(),
+            [&nncdata, &units, trans](const std::size_t begin,
+                                      const std::size_t end,
+                                      float*            block)
+        {
+#pragma omp parallel for
+            for (auto i = begin; i < end; ++i) {
+                block[i - begin] = static_cast<float>(units.from_si(trans, nncdata[i].trans));
+            }
+        });
     }
 } // Anonymous namespace
 
-void Opm::InitIO::write(const ::Opm::EclipseState&              es,
-                        const ::Opm::EclipseGrid&               grid,
-                        const ::Opm::Schedule&                  schedule,
-                        const ::Opm::data::Solution&            simProps,
-                        std::map<std::string, std::vector<int>> int_data,
-                        const ::Opm::NNC&                       nnc,
-                        ::Opm::EclIO::OutputStream::Init&       initFile)
+void Opm::InitIO::write(const ::Opm::EclipseState&               es,
+                        const ::Opm::EclipseGrid&                grid,
+                        const ::Opm::Schedule&                   schedule,
+                        const ::Opm::data::Solution&             simProps,
+                        std::map<std::string, std::vector<int>>  int_data,
+                        const ::Opm::NNC&                        nnc,
+                        ::Opm::EclIO::OutputStream::ArrayWriter& initFile)
 {
     const auto& units = es.getUnits();
 
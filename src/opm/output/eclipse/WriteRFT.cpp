@@ -0,0 +1,240 @@
+/*
+  Copyright (c) 2019 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/output/eclipse/WriteRFT.hpp>
+
+#include <opm/io/eclipse/OutputStream.hpp>
+#include <opm/io/eclipse/PaddedOutputString.hpp>
+
+#include <opm/output/data/Wells.hpp>
+
+#include <opm/parser/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/RFTConfig.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Schedule.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Well/Connection.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Well/Well2.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Well/WellConnections.hpp>
+
+#include <opm/parser/eclipse/Units/UnitSystem.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+    using WellEtc = std::vector<Opm::EclIO::PaddedOutputString<8>>;
+
+    /// Unit strings of WELLETC, items 1 and 4-16, in the order
+    ///   time, length, pressure, liquid rate, gas rate, reservoir rate,
+    ///   velocity, viscosity, density, mass rate, mass fraction.
+    struct UnitStrings
+    {
+        const char* time;
+        const char* length;
+        const char* pressure;
+        const char* liquidRate;
+        const char* gasRate;
+        const char* reservoirRate;
+        const char* velocity;
+        const char* viscosity;
+        const char* density;
+        const char* massRate;
+        const char* massFraction;
+    };
+
+    UnitStrings unitStrings(const Opm::UnitSystem& usys)
+    {
+        using UT = Opm::UnitSystem::UnitType;
+
+        switch (usys.getType()) {
+        case UT::UNIT_TYPE_FIELD:
+            return { "DAYS", "FEET", "PSIA", "STB/DAY", "MSCF/DAY", "RB/DAY",
+                     "FT/SEC", "CP", "LB/STB", "LB/DAY", "LB/LB" };
+
+        case UT::UNIT_TYPE_LAB:
+            return { "HR", "CM", "ATMA", "SCC/HR", "SCC/HR", "RCC/HR",
+                     "CM/SEC", "CP", "GM/SCC", "GM/HR", "GM/GM" };
+
+        case UT::UNIT_TYPE_PVT_M:
+            return { "DAYS", "METRES", "ATMA", "SM3/DAY", "SM3/DAY", "RM3/DAY",
+                     "M/SEC", "CP", "KG/SM3", "KG/DAY", "KG/KG" };
+
+        default:
+            return { "DAYS", "METRES", "BARSA", "SM3/DAY", "SM3/DAY", "RM3/DAY",
+                     "M/SEC", "CP", "KG/SM3", "KG/DAY", "KG/KG" };
+        }
+    }
+
+    WellEtc wellEtc(const std::string& well, const UnitStrings& units)
+    {
+        auto welletc = WellEtc(16);
+
+        welletc[ 0] = units.time;
+        welletc[ 1] = well;
+        welletc[ 3] = units.length;
+        welletc[ 4] = units.pressure;
+        welletc[ 5] = "R";         // RFT data only, no PLT/segment data
+        welletc[ 6] = "STANDARD";
+        welletc[ 7] = units.liquidRate;
+        welletc[ 8] = units.gasRate;
+        welletc[ 9] = units.reservoirRate;
+        welletc[10] = units.velocity;
+        welletc[12] = units.viscosity;
+        welletc[13] = units.density;
+        welletc[14] = units.massRate;
+        welletc[15] = units.massFraction;
+
+        return welletc;
+    }
+
+    std::vector<int> date(const double elapsed, const std::time_t start)
+    {
+        const auto t = static_cast<std::time_t>(elapsed) + start;
+        const auto* tm = std::gmtime(&t);
+
+        return { tm->tm_mday, tm->tm_mon + 1, tm->tm_year + 1900 };
+    }
+
+    class WellRFT
+    {
+    public:
+        explicit WellRFT(const std::size_t nconn)
+        {
+            this->i_.reserve(nconn);
+            this->j_.reserve(nconn);
+            this->k_.reserve(nconn);
+            this->depth_.reserve(nconn);
+            this->press_.reserve(nconn);
+            this->swat_.reserve(nconn);
+            this->sgas_.reserve(nconn);
+        }
+
+        void add(const Opm::Connection&       conn,
+                 const double                 depth,
+                 const Opm::data::Connection& xconn)
+        {
+            this->i_.push_back(conn.getI() + 1);
+            this->j_.push_back(conn.getJ() + 1);
+            this->k_.push_back(conn.getK() + 1);
+
+            this->depth_.push_back(depth);
+            this->press_.push_back(xconn.cell_pressure);
+            this->swat_ .push_back(xconn.cell_saturation_water);
+            this->sgas_ .push_back(xconn.cell_saturation_gas);
+        }
+
+        void write(const Opm::UnitSystem&                 usys,
+                   Opm::EclIO::OutputStream::ArrayWriter& rftFile) const
+        {
+            using M = Opm::UnitSystem::measure;
+
+            rftFile.write("CONIPOS", this->i_);
+            rftFile.write("CONJPOS", this->j_);
+            rftFile.write("CONKPOS", this->k_);
+
+            rftFile.write("HOSTGRID", WellEtc(this->i_.size()));
+
+            rftFile.write("DEPTH"   , this->converted(usys, M::length  , this->depth_));
+            rftFile.write("PRESSURE", this->converted(usys, M::pressure, this->press_));
+            rftFile.write("SWAT"    , this->converted(usys, M::identity, this->swat_));
+            rftFile.write("SGAS"    , this->converted(usys, M::identity, this->sgas_));
+        }
+
+    private:
+        std::vector<int> i_;
+        std::vector<int> j_;
+        std::vector<int> k_;
+
+        std::vector<double> depth_;
+        std::vector<double> press_;
+        std::vector<double> swat_;
+        std::vector<double> sgas_;
+
+        std::vector<float>
+        converted(const Opm::UnitSystem&         usys,
+                  const Opm::UnitSystem::measure m,
+                  const std::vector<double>&     si) const
+        {
+            auto output = std::vector<float>(si.size());
+
+            usys.from_si(m, si.data(), output.data(), si.size());
+
+            return output;
+        }
+    };
+} // Anonymous
+
+void Opm::RftIO::write(const int                                reportStep,
+                       const double                             elapsed,
+                       const ::Opm::UnitSystem&                 usys,
+                       const ::Opm::EclipseGrid&                grid,
+                       const ::Opm::Schedule&                   schedule,
+                       const ::Opm::data::WellRates&            wellSol,
+                       ::Opm::EclIO::OutputStream::ArrayWriter& rftFile)
+{
+    const auto  step   = static_cast<std::size_t>(reportStep);
+    const auto& rftCfg = schedule.rftConfig();
+
+    const auto time  = std::vector<float> {
+        static_cast<float>(usys.from_si(UnitSystem::measure::time, elapsed))
+    };
+    const auto today = date(elapsed, schedule.posixStartTime());
+    const auto units = unitStrings(usys);
+
+    for (const auto& wname : schedule.wellNames(step)) {
+        if (! (rftCfg.rft(wname, step) || rftCfg.plt(wname, step)))
+            continue;
+
+        auto xwPos = wellSol.find(wname);
+        if ((xwPos == wellSol.end()) || xwPos->second.connections.empty())
+            continue;
+
+        // Connection results, keyed by global cell index.
+        auto xconns = std::unordered_map<std::size_t, const data::Connection*>{};
+        for (const auto& xconn : xwPos->second.connections)
+            xconns.emplace(xconn.index, &xconn);
+
+        const auto& conns = schedule.getWell2(wname, step).getConnections();
+
+        auto rft = WellRFT{ conns.size() };
+        for (const auto& conn : conns) {
+            const auto i = static_cast<std::size_t>(conn.getI());
+            const auto j = static_cast<std::size_t>(conn.getJ());
+            const auto k = static_cast<std::size_t>(conn.getK());
+
+            if (! grid.cellActive(i, j, k))
+                continue;
+
+            auto xcPos = xconns.find(grid.getGlobalIndex(i, j, k));
+            if (xcPos == xconns.end())
+                continue;
+
+            rft.add(conn, grid.getCellDepth(i, j, k), *xcPos->second);
+        }
+
+        rftFile.write("TIME", time);
+        rftFile.write("DATE", today);
+        rftFile.write("WELLETC", wellEtc(wname, units));
+
+        rft.write(usys, rftFile);
+    }
+}
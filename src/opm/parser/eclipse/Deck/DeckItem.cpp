@@ -26,8 +26,10 @@
 #include <algorithm>
 #include <string>
 #include <iostream>
+#include <mutex>
 #include <stdexcept>
 #include <cmath>
+#include <unordered_set>
 
 namespace Opm {
 
@@ -71,42 +73,97 @@ const std::vector< UDAValue >& DeckItem::value_ref< UDAValue >() const {
 }
 
 
-DeckItem::DeckItem( const std::string& nm ) : item_name( nm ) {}
+namespace {
+
+    struct NameRegistry {
+        std::mutex mutex;
+        std::unordered_set< std::string > names;
+    };
+
+    NameRegistry& nameRegistry() {
+        static NameRegistry registry;
+        return registry;
+    }
+
+}
+
+const std::string* DeckItem::intern( const std::string& nm ) {
+    auto& registry = nameRegistry();
+    std::lock_guard< std::mutex > lock( registry.mutex );
+
+    // Elements of an unordered_set are never moved by rehashing.
+    return &*registry.names.insert( nm ).first;
+}
+
+
+constexpr size_t DeckItem::DefaultFlags::inline_size;
+
+bool DeckItem::DefaultFlags::at( size_t index ) const {
+    if( index >= this->count )
+        throw std::out_of_range( "DeckItem: no default flag for index " + std::to_string( index ) );
+
+    if( index < inline_size )
+        return ( this->bits >> index ) & 1;
+
+    return this->overflow[ index - inline_size ];
+}
+
+void DeckItem::DefaultFlags::push_back( bool flag, size_t n ) {
+    size_t index = this->count;
+    for( ; index < inline_size && index < this->count + n; index++ ) {
+        if( flag )
+            this->bits |= std::uint64_t( 1 ) << index;
+    }
+
+    if( index < this->count + n )
+        this->overflow.insert( this->overflow.end(), this->count + n - index, flag );
+
+    this->count += n;
+}
+
+bool DeckItem::DefaultFlags::operator==( const DefaultFlags& other ) const {
+    return this->count == other.count
+        && this->bits == other.bits
+        && this->overflow == other.overflow;
+}
+
+bool DeckItem::DefaultFlags::operator!=( const DefaultFlags& other ) const {
+    return !( *this == other );
+}
+
+
+DeckItem::DeckItem( const std::string& nm ) : item_name( intern( nm ) ) {}
 
 DeckItem::DeckItem( const std::string& nm, int, size_t hint ) :
     type( get_type< int >() ),
-    item_name( nm )
+    item_name( intern( nm ) )
 {
     this->ival.reserve( hint );
-    this->defaulted.reserve( hint );
 }
 
 DeckItem::DeckItem( const std::string& nm, double, size_t hint ) :
     type( get_type< double >() ),
-    item_name( nm )
+    item_name( intern( nm ) )
 {
     this->dval.reserve( hint );
-    this->defaulted.reserve( hint );
 }
 
 DeckItem::DeckItem( const std::string& nm, UDAValue , size_t hint ) :
     type( get_type< UDAValue >() ),
-    item_name( nm )
+    item_name( intern( nm ) )
 {
   this->uval.reserve( hint );
-  this->defaulted.reserve( hint );
 }
 
 DeckItem::DeckItem( const std::string& nm, std::string, size_t hint ) :
     type( get_type< std::string >() ),
-    item_name( nm )
+    item_name( intern( nm ) )
 {
     this->sval.reserve( hint );
-    this->defaulted.reserve( hint );
 }
 
 const std::string& DeckItem::name() const {
-    return this->item_name;
+    return *this->item_name;
 }
 
 bool DeckItem::defaultApplied( size_t index ) const {
@@ -187,7 +244,7 @@ void DeckItem::push( T x, size_t n ) {
     auto& val = this->value_ref< T >();
 
     val.insert( val.end(), n, x );
-    this->defaulted.insert( this->defaulted.end(), n, false );
+    this->defaulted.push_back( false, n );
 }
 
 void DeckItem::push_back( int x, size_t n ) {
@@ -248,7 +305,11 @@ std::string DeckItem::getTrimmedString( size_t index ) const {
 }
 
 double DeckItem::getSIDouble( size_t index ) const {
-    return this->getSIDoubleData().at( index );
+    const auto& raw = this->value_ref< double >();
+    this->assertSIDimension();
+
+    const auto raw_value = raw.at( index );
+    return this->dimensions[ index % this->dimensions.size() ].convertRawToSi( raw_value );
 }
 
 const std::vector< double >& DeckItem::getSIDoubleData() const {
@@ -256,26 +317,64 @@ const std::vector< double >& DeckItem::getSIDoubleData() const {
     // we already converted this item to SI?
     if( !this->SIdata.empty() ) return this->SIdata;
 
+    /*
+     * This is an unobservable state change - SIData is lazily converted to
+     * SI units, so externally the object still behaves as const
+     */
+    this->convertToSI( raw, this->SIdata );
+    return this->SIdata;
+}
+
+std::vector< double > DeckItem::getSIDoubleDataCopy() const {
+    const auto& raw = this->value_ref< double >();
+    if( !this->SIdata.empty() ) return this->SIdata;
+
+    std::vector< double > si_data;
+    this->convertToSI( raw, si_data );
+    return si_data;
+}
+
+void DeckItem::assertSIDimension() const {
     if( this->dimensions.empty() )
         throw std::invalid_argument("No dimension has been set for item'"
                                     + this->name()
                                     + "'; can not ask for SI data");
+}
+
+void DeckItem::convertToSI( const std::vector< double >& raw, std::vector< double >& si_data ) const {
+    this->assertSIDimension();
 
-    /*
-     * This is an unobservable state change - SIData is lazily converted to
-     * SI units, so externally the object still behaves as const
-     */
     const auto dim_size = dimensions.size();
     const auto sz = raw.size();
-    this->SIdata.resize( sz );
+    std::vector< double > converted( sz );
 
-    for( size_t index = 0; index < sz; index++ ) {
-        const auto dimIndex = index % dim_size;
-        this->SIdata[ index ] = this->dimensions[ dimIndex ]
-                                .convertRawToSi( raw[ index ] );
+    /*
+     * Element i is converted with dimension i % dim_size; the elements of
+     * each dimension are converted in one strided multiply-add pass.
+     */
+    for( size_t dimIndex = 0; dimIndex < std::min( dim_size, sz ); dimIndex++ ) {
+        const auto& dim = this->dimensions[ dimIndex ];
+        const double factor = dim.getSIScaling();
+        const double offset = dim.getSIOffset();
+
+        for( size_t index = dimIndex; index < sz; index += dim_size )
+            converted[ index ] = raw[ index ]*factor + offset;
     }
 
-    return this->SIdata;
+    si_data.swap( converted );
+}
+
+namespace {
+
+/*
+ * The item only uses its dimensions for unit conversion; dropping the name
+ * saves a string allocation per dimensioned item for composite names like
+ * "LiquidSurfaceVolume/Time".
+ */
+Dimension conversionOnly( const Dimension& dim ) {
+    return Dimension::newComposite( "", dim.getSIScalingRaw(), dim.getSIOffset() );
+}
+
 }
 
 void DeckItem::push_backDimension( const Dimension& active,
@@ -285,7 +384,7 @@ void DeckItem::push_backDimension( const Dimension& active,
         const bool dim_inactive = ds.empty()
             || this->defaultApplied( ds.size() - 1 );
 
-        this->dimensions.push_back( dim_inactive ? def : active );
+        this->dimensions.push_back( conversionOnly( dim_inactive ? def : active ) );
         return;
     }
 
@@ -326,7 +425,7 @@ void DeckItem::push_backDimension( const Dimension& active,
         if (du.size() == 1)
             du[0].set_dim( dim_inactive ? def : active );
 
-        this->dimensions.push_back( dim_inactive ? def : active );
+        this->dimensions.push_back( conversionOnly( dim_inactive ? def : active ) );
         return;
     }
 
@@ -132,6 +132,10 @@ namespace Opm {
         return this->getDataRecord().getDataItem().getSIDoubleData();
     }
 
+    std::vector<double> DeckKeyword::getSIDoubleDataCopy() const {
+        return this->getDataRecord().getDataItem().getSIDoubleDataCopy();
+    }
+
     void DeckKeyword::write_data( DeckOutput& output ) const {
         for (const auto& record: *this)
             record.write( output );
@@ -18,7 +18,6 @@
  */
 
 
-#include <unordered_set>
 #include <stdexcept>
 #include <string>
 #include <algorithm>
@@ -34,20 +33,28 @@ namespace Opm {
     DeckRecord::DeckRecord( std::vector< DeckItem >&& items ) :
         m_items( std::move( items ) ) {
 
-        std::unordered_set< std::string > names;
-        for( const auto& item : this->m_items )
-            names.insert( item.name() );
+        /*
+          Item names are interned, so equal names are the same string
+          object; records are short and a pairwise comparison of the name
+          addresses is cheaper than building a set of the names.
+        */
+        const auto duplicate = [this]( size_t index ) {
+            const auto* name = &this->m_items[ index ].name();
+            return std::any_of( this->m_items.begin(), this->m_items.begin() + index,
+                                [name]( const DeckItem& item ) { return &item.name() == name; } );
+        };
+
+        size_t index = 0;
+        while( index < this->m_items.size() && !duplicate( index ) )
+            index++;
 
-        if( names.size() == this->m_items.size() )
+        if( index == this->m_items.size() )
             return;
 
-        names.clear();
         std::string msg = "Duplicate item names in DeckRecord:";
-        for( const auto& item : this->m_items ) {
-            if( names.count( item.name() ) != 0 )
-                msg += std::string( " " ) += item.name();
-
-            names.insert( item.name() );
+        for( ; index < this->m_items.size(); index++ ) {
+            if( duplicate( index ) )
+                msg += std::string( " " ) += this->m_items[ index ].name();
         }
 
         throw std::invalid_argument( msg );
@@ -496,8 +496,8 @@ namespace Opm {
         {
             const auto& ZCORNKeyWord = deck.getKeyword<ParserKeywords::ZCORN>();
             const auto& COORDKeyWord = deck.getKeyword<ParserKeywords::COORD>();
-            const std::vector<double>& zcorn = ZCORNKeyWord.getSIDoubleData();
-            const std::vector<double>& coord = COORDKeyWord.getSIDoubleData();
+            const std::vector<double> zcorn = ZCORNKeyWord.getSIDoubleDataCopy();
+            const std::vector<double> coord = COORDKeyWord.getSIDoubleDataCopy();
             double * mapaxes = nullptr;
 
             if (deck.hasKeyword<ParserKeywords::MAPAXES>()) {
@@ -647,7 +647,7 @@ namespace Opm {
         size_t volume = dims[0] * dims[1] * dims[2];
         size_t area = dims[0] * dims[1];
         const auto& TOPSKeyWord = deck.getKeyword<ParserKeywords::TOPS>();
-        std::vector<double> TOPS = TOPSKeyWord.getSIDoubleData();
+        std::vector<double> TOPS = TOPSKeyWord.getSIDoubleDataCopy();
 
         if (TOPS.size() >= area) {
             size_t initialTOPSize = TOPS.size();
@@ -680,7 +680,7 @@ namespace Opm {
         size_t area = dims[0] * dims[1];
         std::vector<double> D;
         if (deck.hasKeyword(DKey)) {
-            D = deck.getKeyword( DKey ).getSIDoubleData();
+            D = deck.getKeyword( DKey ).getSIDoubleDataCopy();
 
 
             if (D.size() >= area && D.size() < volume) {
@@ -164,6 +164,26 @@ namespace Opm {
     }
 
 
+    bool IOConfig::getCompressedRST() const {
+        return this->compressed_rst;
+    }
+
+
+    void IOConfig::setCompressedRST(bool compressed) {
+        this->compressed_rst = compressed;
+    }
+
+
+    bool IOConfig::getDeltaRST() const {
+        return this->delta_rst;
+    }
+
+
+    void IOConfig::setDeltaRST(bool delta) {
+        this->delta_rst = delta;
+    }
+
+
     void IOConfig::overrideNOSIM(bool nosim) {
         m_nosim = nosim;
     }
@@ -17,7 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <fnmatch.h>
+#include <opm/parser/eclipse/EclipseState/Schedule/NamePattern.hpp>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/Action/ActionContext.hpp>
 
@@ -93,9 +93,9 @@ Action::Value ASTNode::value(const Action::Context& context) const {
         */
         if ((this->arg_list.size() == 1) && (arg_list[0].find("*") != std::string::npos)) {
             Action::Value well_values;
-            int fnmatch_flags = 0;
+            const NamePattern well_pattern(this->arg_list[0]);
             for (const auto& well : context.wells(this->func)) {
-                if (fnmatch(this->arg_list[0].c_str(), well.c_str(), fnmatch_flags) == 0)
+                if (well_pattern.match(well))
                     well_values.add_well(well, context.get(this->func, well));
             }
             return well_values;
@@ -0,0 +1,249 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/Group/Group2.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Group/GroupTopology.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/Well/Well2.hpp>
+
+namespace Opm {
+
+constexpr std::size_t GroupTopology::npos;
+
+GroupTopology::GroupTopology(const std::vector<const Group2*>& groups, const std::vector<const Well2*>& wells) {
+    std::unordered_map<std::string, const Group2*> group_map;
+    for (const auto* group : groups)
+        group_map.emplace(group->name(), group);
+
+    auto field_iter = group_map.find("FIELD");
+    if (field_iter == group_map.end())
+        throw std::invalid_argument("The group topology must contain the FIELD group");
+
+    for (const auto* well : wells) {
+        this->well_index.emplace(well->name(), this->well_names.size());
+        this->well_names.push_back(well->name());
+        this->well_efac.push_back(well->getEfficiencyFactor());
+    }
+
+    /*
+      The groups are numbered in breadth first order starting at FIELD; that
+      way the parent of a group always has a lower index than the group
+      itself, and the child groups of a group occupy one contiguous range of
+      the child_groups array.
+    */
+    std::vector<const Group2*> ordered_groups = { field_iter->second };
+    this->group_index.emplace("FIELD", 0);
+    this->group_names.push_back("FIELD");
+    this->group_parent.push_back(npos);
+    this->group_level.push_back(0);
+    this->root_index = 0;
+
+    this->child_group_offset.push_back(0);
+    this->child_well_offset.push_back(0);
+    for (std::size_t index = 0; index < ordered_groups.size(); index++) {
+        const auto& group = *ordered_groups[index];
+
+        for (const auto& child_name : group.groups()) {
+            auto child_iter = group_map.find(child_name);
+            if (child_iter == group_map.end())
+                throw std::invalid_argument("Group: " + child_name + " is not defined, but listed as child of: " + group.name());
+
+            const auto child_index = ordered_groups.size();
+            if (!this->group_index.emplace(child_name, child_index).second)
+                throw std::invalid_argument("Group: " + child_name + " occurs multiple times in the group tree");
+
+            ordered_groups.push_back(child_iter->second);
+            this->group_names.push_back(child_name);
+            this->group_parent.push_back(index);
+            this->group_level.push_back(this->group_level[index] + 1);
+            this->child_groups.push_back(child_index);
+        }
+        this->child_group_offset.push_back(this->child_groups.size());
+
+        for (const auto& well_name : group.wells()) {
+            auto well_iter = this->well_index.find(well_name);
+            if (well_iter != this->well_index.end())
+                this->child_wells.push_back(well_iter->second);
+        }
+        this->child_well_offset.push_back(this->child_wells.size());
+
+        this->group_efac.push_back(group.getGroupEfficiencyFactor());
+    }
+
+    std::vector<double> group_cumulative_efac(ordered_groups.size());
+    for (std::size_t index = 0; index < ordered_groups.size(); index++) {
+        const auto parent_index = this->group_parent[index];
+        group_cumulative_efac[index] = this->group_efac[index];
+        if (parent_index != npos)
+            group_cumulative_efac[index] *= group_cumulative_efac[parent_index];
+    }
+
+    this->well_group.assign(this->well_names.size(), npos);
+    this->well_cumulative_efac.assign(this->well_names.size(), 0);
+    for (const auto* well : wells) {
+        const auto wi = this->well_index.at(well->name());
+        auto group_iter = this->group_index.find(well->groupName());
+        if (group_iter == this->group_index.end())
+            throw std::invalid_argument("Well: " + well->name() + " belongs to group: " + well->groupName() + " which is not part of the group tree");
+
+        this->well_group[wi] = group_iter->second;
+        this->well_cumulative_efac[wi] = this->well_efac[wi] * group_cumulative_efac[group_iter->second];
+    }
+}
+
+
+std::size_t GroupTopology::checkedGroup(std::size_t gi) const {
+    if (gi >= this->group_names.size())
+        throw std::invalid_argument("Invalid group index: " + std::to_string(gi));
+    return gi;
+}
+
+std::size_t GroupTopology::checkedWell(std::size_t wi) const {
+    if (wi >= this->well_names.size())
+        throw std::invalid_argument("Invalid well index: " + std::to_string(wi));
+    return wi;
+}
+
+std::size_t GroupTopology::numGroups() const {
+    return this->group_names.size();
+}
+
+std::size_t GroupTopology::numWells() const {
+    return this->well_names.size();
+}
+
+bool GroupTopology::hasGroup(const std::string& group_name) const {
+    return this->group_index.count(group_name) > 0;
+}
+
+bool GroupTopology::hasWell(const std::string& well_name) const {
+    return this->well_index.count(well_name) > 0;
+}
+
+std::size_t GroupTopology::groupIndex(const std::string& group_name) const {
+    auto iter = this->group_index.find(group_name);
+    if (iter == this->group_index.end())
+        throw std::invalid_argument("No such group: '" + group_name + "'");
+
+    return iter->second;
+}
+
+std::size_t GroupTopology::wellIndex(const std::string& well_name) const {
+    auto iter = this->well_index.find(well_name);
+    if (iter == this->well_index.end())
+        throw std::invalid_argument("No such well: " + well_name);
+
+    return iter->second;
+}
+
+const std::string& GroupTopology::groupName(std::size_t gi) const {
+    return this->group_names[this->checkedGroup(gi)];
+}
+
+const std::string& GroupTopology::wellName(std::size_t wi) const {
+    return this->well_names[this->checkedWell(wi)];
+}
+
+std::size_t GroupTopology::root() const {
+    return this->root_index;
+}
+
+std::size_t GroupTopology::parent(std::size_t gi) const {
+    return this->group_parent[this->checkedGroup(gi)];
+}
+
+std::size_t GroupTopology::level(std::size_t gi) const {
+    return this->group_level[this->checkedGroup(gi)];
+}
+
+GroupTopology::IndexRange GroupTopology::childGroups(std::size_t gi) const {
+    this->checkedGroup(gi);
+    const auto * data = this->child_groups.data();
+    return IndexRange(data + this->child_group_offset[gi], data + this->child_group_offset[gi + 1]);
+}
+
+GroupTopology::IndexRange GroupTopology::childWells(std::size_t gi) const {
+    this->checkedGroup(gi);
+    const auto * data = this->child_wells.data();
+    return IndexRange(data + this->child_well_offset[gi], data + this->child_well_offset[gi + 1]);
+}
+
+std::size_t GroupTopology::wellGroup(std::size_t wi) const {
+    return this->well_group[this->checkedWell(wi)];
+}
+
+double GroupTopology::groupEfficiencyFactor(std::size_t gi) const {
+    return this->group_efac[this->checkedGroup(gi)];
+}
+
+double GroupTopology::wellEfficiencyFactor(std::size_t wi) const {
+    return this->well_efac[this->checkedWell(wi)];
+}
+
+double GroupTopology::cumulativeEfficiencyFactor(std::size_t wi) const {
+    return this->well_cumulative_efac[this->checkedWell(wi)];
+}
+
+double GroupTopology::cumulativeEfficiencyFactor(std::size_t wi, std::size_t stop_group) const {
+    if (stop_group == npos)
+        return this->cumulativeEfficiencyFactor(wi);
+
+    double efac = this->well_efac[this->checkedWell(wi)];
+    auto gi = this->well_group[wi];
+    while (gi != npos && gi != stop_group) {
+        efac *= this->group_efac[gi];
+        gi = this->group_parent[gi];
+    }
+    return efac;
+}
+
+std::size_t GroupTopology::maxGroupSize() const {
+    std::size_t max_size = 0;
+    for (std::size_t gi = 0; gi < this->group_names.size(); gi++) {
+        if (gi == this->root_index)
+            continue;
+
+        if (this->child_group_offset[gi + 1] > this->child_group_offset[gi])
+            continue;
+
+        max_size = std::max(max_size, this->child_well_offset[gi + 1] - this->child_well_offset[gi]);
+    }
+    return max_size;
+}
+
+bool GroupTopology::operator==(const GroupTopology& other) const {
+    return this->group_names == other.group_names &&
+           this->group_parent == other.group_parent &&
+           this->group_efac == other.group_efac &&
+           this->child_groups == other.child_groups &&
+           this->child_group_offset == other.child_group_offset &&
+           this->child_wells == other.child_wells &&
+           this->child_well_offset == other.child_well_offset &&
+           this->well_names == other.well_names &&
+           this->well_group == other.well_group &&
+           this->well_efac == other.well_efac;
+}
+
+bool GroupTopology::operator!=(const GroupTopology& other) const {
+    return !(*this == other);
+}
+
+}
@@ -0,0 +1,195 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <fnmatch.h>
+
+#include <algorithm>
+#include <iterator>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/NamePattern.hpp>
+
+namespace Opm {
+
+namespace {
+
+    const std::string wildcard_chars = "*?[\\";
+
+}
+
+
+NamePattern::NamePattern(const std::string& pattern) :
+    m_pattern(pattern)
+{
+    const auto first_special = pattern.find_first_of(wildcard_chars);
+    if (first_special == std::string::npos) {
+        this->m_type = Type::LITERAL;
+        this->m_prefix = pattern;
+        return;
+    }
+
+    this->m_prefix = pattern.substr(0, first_special);
+    this->m_type = Type::GENERAL;
+
+    const auto last_special = pattern.find_last_of(wildcard_chars);
+    if (first_special == last_special && pattern[first_special] == '*') {
+        if (pattern.size() == 1)
+            this->m_type = Type::ALL;
+        else if (first_special == pattern.size() - 1)
+            this->m_type = Type::PREFIX;
+        else if (first_special == 0) {
+            this->m_type = Type::SUFFIX;
+            this->m_suffix = pattern.substr(1);
+        }
+    }
+}
+
+
+bool NamePattern::match(const std::string& name) const {
+    switch (this->m_type) {
+    case Type::LITERAL:
+        return name == this->m_pattern;
+
+    case Type::ALL:
+        return true;
+
+    case Type::PREFIX:
+        return name.compare(0, this->m_prefix.size(), this->m_prefix) == 0;
+
+    case Type::SUFFIX:
+        return name.size() >= this->m_suffix.size() &&
+               name.compare(name.size() - this->m_suffix.size(), this->m_suffix.size(), this->m_suffix) == 0;
+
+    default:
+        if (name.compare(0, this->m_prefix.size(), this->m_prefix) != 0)
+            return false;
+
+        return fnmatch(this->m_pattern.c_str(), name.c_str(), 0) == 0;
+    }
+}
+
+
+const std::string& NamePattern::pattern() const {
+    return this->m_pattern;
+}
+
+const std::string& NamePattern::prefix() const {
+    return this->m_prefix;
+}
+
+bool NamePattern::literal() const {
+    return this->m_type == Type::LITERAL;
+}
+
+bool NamePattern::all() const {
+    return this->m_type == Type::ALL;
+}
+
+
+void NameIndex::add(const std::string& name) {
+    this->sorted_names.emplace(name, this->sorted_names.size());
+}
+
+std::size_t NameIndex::size() const {
+    return this->sorted_names.size();
+}
+
+
+std::vector<std::size_t> NameIndex::match(const NamePattern& pattern) const {
+    std::vector<std::size_t> indices;
+
+    if (pattern.literal()) {
+        auto iter = this->sorted_names.find(pattern.pattern());
+        if (iter != this->sorted_names.end())
+            indices.push_back(iter->second);
+        return indices;
+    }
+
+    if (pattern.all()) {
+        indices.resize(this->sorted_names.size());
+        for (std::size_t index = 0; index < indices.size(); index++)
+            indices[index] = index;
+        return indices;
+    }
+
+    const auto& prefix = pattern.prefix();
+    for (auto iter = this->sorted_names.lower_bound(prefix); iter != this->sorted_names.end(); ++iter) {
+        const auto& name = iter->first;
+        if (name.compare(0, prefix.size(), prefix) != 0)
+            break;
+
+        if (pattern.match(name))
+            indices.push_back(iter->second);
+    }
+
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+
+
+NameIndexCache::NameIndexCache(const NameIndexCache&) :
+    NameIndexCache()
+{
+}
+
+NameIndexCache& NameIndexCache::operator=(const NameIndexCache&) {
+    this->clear();
+    return *this;
+}
+
+
+std::shared_ptr<const NameIndexCache::Entry>
+NameIndexCache::get(std::size_t report_step,
+                    const std::function<std::vector<std::string>()>& make_names) const
+{
+    std::lock_guard<std::mutex> lock(this->entries_mutex);
+
+    auto iter = this->entries.lower_bound(report_step);
+    if (iter != this->entries.end() && iter->first == report_step)
+        return iter->second;
+
+    auto names = make_names();
+
+    /*
+      Wells and groups are rarely added, so the closest cached steps on
+      either side usually have the same names.
+    */
+    std::shared_ptr<const Entry> entry;
+    if (iter != this->entries.end() && iter->second->names == names)
+        entry = iter->second;
+    else if (iter != this->entries.begin() && std::prev(iter)->second->names == names)
+        entry = std::prev(iter)->second;
+    else {
+        auto new_entry = std::make_shared<Entry>();
+        for (const auto& name : names)
+            new_entry->index.add(name);
+        new_entry->names = std::move(names);
+        entry = std::move(new_entry);
+    }
+
+    this->entries.emplace_hint(iter, report_step, entry);
+    return entry;
+}
+
+void NameIndexCache::clear() {
+    std::lock_guard<std::mutex> lock(this->entries_mutex);
+    this->entries.clear();
+}
+
+}
@@ -17,7 +17,6 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <fnmatch.h>
 #include <string>
 #include <vector>
 #include <stdexcept>
@@ -71,12 +70,6 @@ namespace Opm {
 
 namespace {
 
-    bool name_match(const std::string& pattern, const std::string& name) {
-        int flags = 0;
-        return (fnmatch(pattern.c_str(), name.c_str(), flags) == 0);
-    }
-
-
     /*
       The function trim_wgname() is used to trim the leading and trailing spaces
       away from the group and well arguments given in the WELSPECS and GRUPTREE
@@ -109,6 +102,7 @@ namespace {
                         const ParseContext& parseContext,
                         ErrorGuard& errors) :
         m_timeMap( deck ),
+        group_topology( this->m_timeMap, nullptr ),
         m_oilvaporizationproperties( this->m_timeMap, OilVaporizationProperties(runspec.tabdims().getNumPVTTables()) ),
         m_events( this->m_timeMap ),
         m_modifierDeck( this->m_timeMap, Deck{} ),
@@ -139,6 +133,8 @@ namespace {
 
         if (Section::hasSCHEDULE(deck))
             iterateScheduleSection( parseContext, errors, SCHEDULESection( deck ), grid, eclipseProperties );
+
+        this->updateGroupTopology(0);
     }
 
 
@@ -1127,8 +1123,16 @@ namespace {
     void Schedule::handleUDQ(const DeckKeyword& keyword, size_t currentStep) {
         const auto& current = *this->udq_config.get(currentStep);
         std::shared_ptr<UDQInput> new_udq = std::make_shared<UDQInput>(current);
-        for (const auto& record : keyword)
-            new_udq->add_record(record);
+        new_udq->add_keyword(keyword);
+
+        const auto& cyclic = new_udq->cyclic_definitions();
+        if (!cyclic.empty() && cyclic != current.cyclic_definitions()) {
+            std::string msg = "UDQ definitions with cyclic dependencies at report step " + std::to_string(currentStep) + ":";
+            for (const auto& udq_key : cyclic)
+                msg += " " + udq_key;
+            msg += " - these are evaluated in input order using previously calculated values";
+            OpmLog::warning(msg);
+        }
 
         this->udq_config.update(currentStep, new_udq);
     }
@@ -1902,6 +1906,74 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         return this->groupTree("FIELD", report_step);
     }
 
+
+    const GroupTopology& Schedule::groupTopology(std::size_t report_step) const {
+        return *this->group_topology.get(report_step);
+    }
+
+
+    /*
+      The group topology only depends on the group objects, and on the group
+      membership and efficiency factor of the wells; a new well object due to
+      e.g. a changed rate target does not require a new topology.
+    */
+    bool Schedule::groupTopologyChanged(std::size_t report_step) const {
+        for (const auto& group_pair : this->groups) {
+            const auto& dynamic_state = group_pair.second;
+            if (dynamic_state.get(report_step) != dynamic_state.get(report_step - 1))
+                return true;
+        }
+
+        for (const auto& well_pair : this->wells_static) {
+            const auto& dynamic_state = well_pair.second;
+            const auto& prev_well = dynamic_state.get(report_step - 1);
+            const auto& well = dynamic_state.get(report_step);
+            if (well == prev_well)
+                continue;
+
+            if (!well || !prev_well)
+                return true;
+
+            if (well->groupName() != prev_well->groupName())
+                return true;
+
+            if (well->getEfficiencyFactor() != prev_well->getEfficiencyFactor())
+                return true;
+        }
+
+        return false;
+    }
+
+
+    void Schedule::updateGroupTopology(std::size_t start_step) {
+        for (std::size_t report_step = start_step; report_step < this->m_timeMap.size(); report_step++) {
+            if (report_step > start_step && !this->groupTopologyChanged(report_step))
+                continue;
+
+            std::vector<const Group2*> group_list;
+            for (const auto& group_pair : this->groups) {
+                const auto& group_ptr = group_pair.second.get(report_step);
+                if (group_ptr)
+                    group_list.push_back(group_ptr.get());
+            }
+
+            std::vector<const Well2*> well_list;
+            for (const auto& well_pair : this->wells_static) {
+                const auto& well_ptr = well_pair.second.get(report_step);
+                if (well_ptr)
+                    well_list.push_back(well_ptr.get());
+            }
+
+            auto topology = std::make_shared<const GroupTopology>(group_list, well_list);
+            if (report_step > 0) {
+                const auto& prev_topology = this->group_topology.get(report_step - 1);
+                if (prev_topology && *prev_topology == *topology)
+                    topology = prev_topology;
+            }
+            this->group_topology.update(report_step, std::move(topology));
+        }
+    }
+
     void Schedule::addWell(const std::string& wellName,
                            const DeckRecord& record,
                            size_t timeStep,
@@ -1946,6 +2018,7 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         }
         {
             wells_static.insert( std::make_pair(wellName, DynamicState<std::shared_ptr<Well2>>(m_timeMap, nullptr)));
+            this->well_name_cache.clear();
 
             auto& dynamic_state = wells_static.at(wellName);
             const std::string& group = record.getItem<ParserKeywords::WELSPECS::GROUP>().getTrimmedString(0);
@@ -2054,6 +2127,19 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         return this->getWells2(this->m_timeMap.size() - 1);
     }
 
+    std::vector<std::shared_ptr<const Well2>> Schedule::getSharedWells2(size_t timeStep) const {
+        std::vector<std::shared_ptr<const Well2>> wells;
+        if (timeStep >= this->m_timeMap.size())
+            throw std::invalid_argument("timeStep argument beyond the length of the simulation");
+
+        for (const auto& dynamic_pair : this->wells_static) {
+            const auto& well_ptr = dynamic_pair.second.get(timeStep);
+            if (well_ptr)
+                wells.push_back(well_ptr);
+        }
+        return wells;
+    }
+
 
     const Well2& Schedule::getWell2atEnd(const std::string& well_name) const {
         return this->getWell2(well_name, this->m_timeMap.size() - 1);
@@ -2120,14 +2206,18 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         // Normal pattern matching
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
-            std::vector<std::string> names;
-            for (const auto& well_pair : this->wells_static) {
-                if (name_match(pattern, well_pair.first)) {
-                    const auto& dynamic_state = well_pair.second;
-                    if (dynamic_state.get(timeStep))
-                        names.push_back(well_pair.first);
+            const auto wells = this->well_name_cache.get(timeStep, [this, timeStep]() {
+                std::vector<std::string> step_wells;
+                for (const auto& well_pair : this->wells_static) {
+                    if (well_pair.second.get(timeStep))
+                        step_wells.push_back(well_pair.first);
                 }
-            }
+                return step_wells;
+            });
+
+            std::vector<std::string> names;
+            for (const auto& index : wells->index.match(NamePattern(pattern)))
+                names.push_back(wells->names[index]);
             return names;
         }
 
@@ -2176,13 +2266,12 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
             std::vector<std::string> names;
-            for (const auto& group_pair : this->groups) {
-                if (name_match(pattern, group_pair.first)) {
-                    const auto& dynamic_state = group_pair.second;
-                    const auto& group_ptr = dynamic_state.get(timeStep);
-                    if (group_ptr)
-                        names.push_back(group_pair.first);
-                }
+            for (const auto& index : this->group_name_index.match(NamePattern(pattern))) {
+                const auto& group_pair = *std::next(this->groups.begin(), index);
+                const auto& dynamic_state = group_pair.second;
+                const auto& group_ptr = dynamic_state.get(timeStep);
+                if (group_ptr)
+                    names.push_back(group_pair.first);
             }
             return names;
         }
@@ -2215,12 +2304,9 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         // Normal pattern matching
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
-            int flags = 0;
             std::vector<std::string> names;
-            for (const auto& group_pair : this->groups) {
-                if (fnmatch(pattern.c_str(), group_pair.first.c_str(), flags) == 0)
-                    names.push_back(group_pair.first);
-            }
+            for (const auto& index : this->group_name_index.match(NamePattern(pattern)))
+                names.push_back(std::next(this->groups.begin(), index)->first);
             return names;
         }
 
@@ -2244,6 +2330,7 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         const size_t gseqIndex = this->groups.size();
 
         groups.insert( std::make_pair( groupName, DynamicState<std::shared_ptr<Group2>>(this->m_timeMap, nullptr)));
+        this->group_name_index.add(groupName);
         auto group_ptr = std::make_shared<Group2>(groupName, gseqIndex, timeStep, this->getUDQConfig(timeStep).params().undefinedValue(), unit_system);
         auto& dynamic_state = this->groups.at(groupName);
         dynamic_state.update(timeStep, group_ptr);
@@ -2496,6 +2583,7 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
                 this->handleWELOPEN(keyword, reportStep, parseContext, errors, result.wells());
         }
 
+        this->updateGroupTopology(reportStep);
     }
 
 
@@ -16,10 +16,8 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
-#include <fnmatch.h>
+#include <stdexcept>
 
-#include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunction.hpp>
-#include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQEnums.hpp>
 
 #include "UDQASTNode.hpp"
@@ -97,109 +95,4 @@ UDQASTNode::UDQASTNode(UDQTokenType type_arg,
 }
 
 
-
-
-UDQSet UDQASTNode::eval(UDQVarType target_type, const UDQContext& context) const {
-    if (this->type == UDQTokenType::ecl_expr) {
-        if (this->var_type == UDQVarType::WELL_VAR) {
-            const auto& wells = context.wells();
-
-            if (this->selector.size() > 0) {
-                int fnmatch_flags = 0;
-                const std::string& well_pattern = this->selector[0];
-                if (well_pattern.find("*") == std::string::npos)
-                    return UDQSet::wells(this->string_value, wells, context.get_well_var(well_pattern, this->string_value));
-                else {
-                    auto res = UDQSet::wells(this->string_value, wells);
-                    for (const auto& well : wells) {
-                        if (fnmatch(well_pattern.c_str(), well.c_str(), fnmatch_flags) == 0) {
-                            if (context.has_well_var(well, this->string_value))
-                                res.assign(well, context.get_well_var(well, this->string_value));
-                        }
-                    }
-                    return res;
-                }
-            } else {
-                auto res = UDQSet::wells(this->string_value, wells);
-                for (const auto& well : wells) {
-                    if (context.has_well_var(well, this->string_value))
-                        res.assign(well, context.get_well_var(well, this->string_value));
-                }
-                return res;
-            }
-        }
-
-        if (this->var_type == UDQVarType::GROUP_VAR) {
-            const auto& groups = context.groups();
-
-            if (this->selector.size() > 0) {
-                int fnmatch_flags = 0;
-                const std::string& group_pattern = this->selector[0];
-                if (group_pattern.find("*") == std::string::npos)
-                    return UDQSet::groups(this->string_value, groups, context.get_group_var(group_pattern, this->string_value));
-                else {
-                    auto res = UDQSet::groups(this->string_value, groups);
-                    for (const auto& group : groups) {
-                        if (fnmatch(group_pattern.c_str(), group.c_str(), fnmatch_flags) == 0) {
-                            if (context.has_group_var(group, this->string_value))
-                                res.assign(group, context.get_group_var(group, this->string_value));
-                        }
-                    }
-                    return res;
-                }
-            } else {
-                auto res = UDQSet::groups(this->string_value, groups);
-                for (const auto& group : groups) {
-                    if (context.has_group_var(group, this->string_value))
-                        res.assign(group, context.get_group_var(group, this->string_value));
-                }
-                return res;
-            }
-        }
-    }
-
-
-    if (UDQ::scalarFunc(this->type)) {
-        const auto& udqft = context.function_table();
-        const UDQScalarFunction& func = dynamic_cast<const UDQScalarFunction&>(udqft.get(this->string_value));
-        return func.eval( this->arglist[0].eval(target_type, context) );
-    }
-
-
-    if (UDQ::elementalUnaryFunc(this->type)) {
-        auto input_arg = this->arglist[0];
-        auto func_arg = input_arg.eval(target_type, context);
-
-        const auto& udqft = context.function_table();
-        const UDQUnaryElementalFunction& func = dynamic_cast<const UDQUnaryElementalFunction&>(udqft.get(this->string_value));
-        return func.eval(func_arg);
-    }
-
-    if (UDQ::binaryFunc(this->type)) {
-        auto left_arg  = this->arglist[0].eval(target_type, context);
-        auto right_arg = this->arglist[1].eval(target_type, context);
-
-        const auto& udqft = context.function_table();
-        const UDQBinaryFunction& func = dynamic_cast<const UDQBinaryFunction&>(udqft.get(this->string_value));
-        auto res = func.eval(left_arg, right_arg);
-        return func.eval(left_arg, right_arg);
-    }
-
-    if (this->type == UDQTokenType::number) {
-        switch(target_type) {
-        case UDQVarType::WELL_VAR:
-            return UDQSet::wells(this->string_value, context.wells(), this->scalar_value);
-        case UDQVarType::SCALAR:
-            return UDQSet::scalar(this->string_value, this->scalar_value);
-        case UDQVarType::FIELD_VAR:
-            return UDQSet::field(this->string_value, this->scalar_value);
-        default:
-            throw std::invalid_argument("Unsupported target_type: " + std::to_string(static_cast<int>(target_type)));
-        }
-    }
-
-    throw std::invalid_argument("Should not be here ...");
-}
-
-
 }
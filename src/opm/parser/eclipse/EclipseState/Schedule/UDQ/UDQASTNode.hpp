@@ -23,8 +23,6 @@
 #include <string>
 #include <vector>
 
-#include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQSet.hpp>
-#include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQContext.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQEnums.hpp>
 
 
@@ -39,11 +37,10 @@ public:
     UDQASTNode(UDQTokenType type_arg, const std::string& func_name, const UDQASTNode& arg);
     UDQASTNode(UDQTokenType type_arg, const std::string& func_name, const UDQASTNode& left, const UDQASTNode& right);
 
-    UDQSet eval(UDQVarType eval_target, const UDQContext& context) const;
-
     UDQTokenType type;
     UDQVarType var_type = UDQVarType::NONE;
 private:
+    friend class UDQProgram;
 
     std::string string_value;
     double scalar_value;
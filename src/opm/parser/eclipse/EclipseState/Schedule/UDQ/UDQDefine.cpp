@@ -29,6 +29,7 @@
 
 #include "UDQParser.hpp"
 #include "UDQASTNode.hpp"
+#include "UDQProgram.hpp"
 
 namespace Opm {
 
@@ -121,7 +122,8 @@ UDQDefine::UDQDefine(const UDQParams& udq_params_arg,
 
         }
     }
-    this->ast = std::make_shared<UDQASTNode>( UDQParser::parse(this->udq_params, this->m_var_type, this->m_keyword, tokens, parseContext, errors) );
+    const auto ast = UDQParser::parse(this->udq_params, this->m_var_type, this->m_keyword, tokens, parseContext, errors);
+    this->program = std::make_shared<UDQProgram>(ast);
 
     this->string_data = "";
     for (std::size_t index = 0; index < deck_data.size(); index++) {
@@ -134,7 +136,7 @@ UDQDefine::UDQDefine(const UDQParams& udq_params_arg,
 
 
 UDQSet UDQDefine::eval(const UDQContext& context) const {
-    UDQSet res = this->ast->eval(this->m_var_type, context);
+    UDQSet res = this->program->eval(this->m_var_type, context);
     if (!UDQ::compatibleTypes(this->var_type(), res.var_type())) {
         std::string msg = "Invalid runtime type conversion detected when evaluating UDQ";
         throw std::invalid_argument(msg);
@@ -157,25 +159,11 @@ UDQSet UDQDefine::eval(const UDQContext& context) const {
         */
 
         double scalar_value = res[0].value();
-        if (this->var_type() == UDQVarType::WELL_VAR) {
-            const std::vector<std::string> wells = context.wells();
-            UDQSet well_res = UDQSet::wells(this->m_keyword, wells);
+        if (this->var_type() == UDQVarType::WELL_VAR)
+            return UDQSet::wells(this->m_keyword, context.wells(), scalar_value);
 
-            for (const auto& well : wells)
-                well_res.assign(well, scalar_value);
-
-            return well_res;
-        }
-
-        if (this->var_type() == UDQVarType::GROUP_VAR) {
-            const std::vector<std::string> groups = context.groups();
-            UDQSet group_res = UDQSet::groups(this->m_keyword, groups);
-
-            for (const auto& group : groups)
-                group_res.assign(group, scalar_value);
-
-            return group_res;
-        }
+        if (this->var_type() == UDQVarType::GROUP_VAR)
+            return UDQSet::groups(this->m_keyword, context.groups(), scalar_value);
     }
 
     return res;
@@ -195,4 +183,8 @@ const std::string& UDQDefine::input_string() const {
     return this->string_data;
 }
 
+const std::vector<std::string>& UDQDefine::input_variables() const {
+    return this->program->input_variables();
+}
+
 }
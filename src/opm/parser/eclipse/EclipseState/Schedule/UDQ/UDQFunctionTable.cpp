@@ -16,6 +16,7 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
+#include <atomic>
 #include <unordered_set>
 #include <cmath>
 #include <algorithm>
@@ -25,11 +26,21 @@
 
 namespace Opm {
 
+namespace {
+
+std::size_t next_table_id() {
+    static std::atomic<std::size_t> table_count{0};
+    return ++table_count;
+}
+
+}
+
 UDQFunctionTable::UDQFunctionTable() :
     UDQFunctionTable(UDQParams())
 {}
 
 UDQFunctionTable::UDQFunctionTable(const UDQParams& params_arg) :
+    table_id(next_table_id()),
     params(params_arg)
 {
     // SCalar functions
@@ -111,4 +122,9 @@ const UDQFunction& UDQFunctionTable::get(const std::string& name) const {
     const auto& pair_ptr = this->function_table.find(name);
     return *pair_ptr->second;
 }
+
+
+std::size_t UDQFunctionTable::id() const {
+    return this->table_id;
+}
 }
@@ -18,6 +18,8 @@
  */
 
 #include <algorithm>
+#include <functional>
+#include <queue>
 
 #include <opm/parser/eclipse/Deck/Deck.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQInput.hpp>
@@ -33,6 +35,67 @@ namespace Opm {
                 return s;
         }
 
+        /*
+          Marks the nodes of the strongly connected components with more than
+          one node, i.e. the nodes which are part of a dependency cycle. This
+          is an iterative version of Tarjan's algorithm.
+        */
+        std::vector<bool> cycle_members(const std::vector<std::vector<std::size_t>>& edges) {
+            const std::size_t unvisited = edges.size();
+            std::vector<std::size_t> index(edges.size(), unvisited);
+            std::vector<std::size_t> lowlink(edges.size(), 0);
+            std::vector<bool> on_stack(edges.size(), false);
+            std::vector<bool> members(edges.size(), false);
+            std::vector<std::size_t> stack;
+            std::vector<std::pair<std::size_t, std::size_t>> call_stack;
+            std::size_t next_index = 0;
+
+            auto visit = [&](std::size_t node) {
+                index[node] = next_index;
+                lowlink[node] = next_index;
+                next_index++;
+                stack.push_back(node);
+                on_stack[node] = true;
+                call_stack.emplace_back(node, 0);
+            };
+
+            for (std::size_t root = 0; root < edges.size(); root++) {
+                if (index[root] != unvisited)
+                    continue;
+
+                visit(root);
+                while (!call_stack.empty()) {
+                    const auto node = call_stack.back().first;
+                    auto& next_edge = call_stack.back().second;
+                    if (next_edge < edges[node].size()) {
+                        const auto next = edges[node][next_edge++];
+                        if (index[next] == unvisited)
+                            visit(next);
+                        else if (on_stack[next])
+                            lowlink[node] = std::min(lowlink[node], index[next]);
+                        continue;
+                    }
+
+                    call_stack.pop_back();
+                    if (!call_stack.empty()) {
+                        const auto parent = call_stack.back().first;
+                        lowlink[parent] = std::min(lowlink[parent], lowlink[node]);
+                    }
+
+                    if (lowlink[node] == index[node]) {
+                        const auto component_begin = std::find(stack.begin(), stack.end(), node);
+                        const bool cycle = (stack.end() - component_begin) > 1;
+                        for (auto iter = component_begin; iter != stack.end(); ++iter) {
+                            on_stack[*iter] = false;
+                            members[*iter] = cycle;
+                        }
+                        stack.erase(component_begin, stack.end());
+                    }
+                }
+            }
+
+            return members;
+        }
     }
 
     UDQInput::UDQInput(const Deck& deck) :
@@ -79,6 +142,108 @@ namespace Opm {
     }
 
 
+    void UDQInput::add_keyword(const DeckKeyword& keyword) {
+        for (const auto& record : keyword)
+            this->add_record(record);
+
+        this->update_eval_order();
+    }
+
+
+    void UDQInput::update_eval_order() {
+        std::vector<std::string> keys;
+        std::unordered_map<std::string, std::size_t> position;
+        for (const auto& index_pair : this->input_index) {
+            if (index_pair.second.second == UDQAction::DEFINE) {
+                position.emplace(index_pair.first, keys.size());
+                keys.push_back(index_pair.first);
+            }
+        }
+
+        std::vector<std::vector<std::size_t>> dependencies(keys.size());
+        std::vector<std::vector<std::size_t>> dependents(keys.size());
+        for (std::size_t index = 0; index < keys.size(); index++) {
+            for (const auto& input : this->m_definitions.at(keys[index]).input_variables()) {
+                const auto pos_iter = position.find(input);
+                if (pos_iter != position.end() && pos_iter->second != index) {
+                    dependencies[index].push_back(pos_iter->second);
+                    dependents[pos_iter->second].push_back(index);
+                }
+            }
+        }
+
+        const auto cyclic = cycle_members(dependencies);
+        this->m_cyclic_definitions.clear();
+        for (std::size_t index = 0; index < keys.size(); index++) {
+            if (cyclic[index])
+                this->m_cyclic_definitions.push_back(keys[index]);
+        }
+
+        /*
+          Kahn's algorithm, where the ready definitions are kept in a min-heap
+          on the input index so that ties are broken by the input order. When
+          no definition is ready the remaining ones depend on a cycle, and the
+          first remaining cycle member in input order is forced into the
+          evaluation order.
+        */
+        std::vector<std::size_t> in_degree(keys.size());
+        std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> ready;
+        for (std::size_t index = 0; index < keys.size(); index++) {
+            in_degree[index] = dependencies[index].size();
+            if (in_degree[index] == 0)
+                ready.push(index);
+        }
+
+        std::vector<bool> done(keys.size(), false);
+        std::size_t next_forced = 0;
+        this->m_eval_order.clear();
+        while (this->m_eval_order.size() < keys.size()) {
+            std::size_t next;
+            if (ready.empty()) {
+                while (done[next_forced] || !cyclic[next_forced])
+                    next_forced++;
+
+                next = next_forced;
+            } else {
+                next = ready.top();
+                ready.pop();
+            }
+
+            done[next] = true;
+            this->m_eval_order.push_back(keys[next]);
+            for (const auto& dependent : dependents[next]) {
+                in_degree[dependent]--;
+                if (in_degree[dependent] == 0 && !done[dependent])
+                    ready.push(dependent);
+            }
+        }
+    }
+
+
+    std::vector<UDQDefine> UDQInput::eval_order() const {
+        std::vector<UDQDefine> ret;
+        for (const auto& key : this->m_eval_order)
+            ret.push_back(this->m_definitions.at(key));
+        return ret;
+    }
+
+
+    std::vector<UDQDefine> UDQInput::eval_order(UDQVarType var_type) const {
+        std::vector<UDQDefine> filtered_defines;
+        for (const auto& key : this->m_eval_order) {
+            const auto& udq_define = this->m_definitions.at(key);
+            if (udq_define.var_type() == var_type)
+                filtered_defines.push_back(udq_define);
+        }
+        return filtered_defines;
+    }
+
+
+    const std::vector<std::string>& UDQInput::cyclic_definitions() const {
+        return this->m_cyclic_definitions;
+    }
+
+
     std::vector<UDQDefine> UDQInput::definitions() const {
         std::vector<UDQDefine> ret;
         for (const auto& index_pair : this->input_index) {
@@ -0,0 +1,246 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunction.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.hpp>
+
+#include "UDQProgram.hpp"
+
+namespace Opm {
+
+namespace {
+
+std::size_t func_index(std::vector<std::string>& funcs, const std::string& name) {
+    auto iter = std::find(funcs.begin(), funcs.end(), name);
+    if (iter != funcs.end())
+        return iter - funcs.begin();
+
+    funcs.push_back(name);
+    return funcs.size() - 1;
+}
+
+template <typename Func>
+std::vector<const Func*> resolve(const UDQFunctionTable& udqft, const std::vector<std::string>& funcs, const std::string& func_type) {
+    std::vector<const Func*> resolved;
+    for (const auto& name : funcs) {
+        const auto * func = dynamic_cast<const Func*>(&udqft.get(name));
+        if (!func)
+            throw std::invalid_argument("UDQ function " + name + " is not a " + func_type + " function");
+
+        resolved.push_back(func);
+    }
+    return resolved;
+}
+
+}
+
+UDQProgram::UDQProgram(const UDQASTNode& ast) {
+    this->compile(ast, 0);
+}
+
+
+void UDQProgram::compile(const UDQASTNode& node, std::size_t depth) {
+    this->max_depth = std::max(this->max_depth, depth + 1);
+
+    Instruction instr;
+    instr.name = node.string_value;
+
+    if (node.type == UDQTokenType::ecl_expr && (node.var_type == UDQVarType::WELL_VAR || node.var_type == UDQVarType::GROUP_VAR)) {
+        instr.op = (node.var_type == UDQVarType::WELL_VAR) ? OpCode::load_well : OpCode::load_group;
+        if (std::find(this->inputs.begin(), this->inputs.end(), instr.name) == this->inputs.end())
+            this->inputs.push_back(instr.name);
+
+        if (node.selector.size() > 0) {
+            instr.has_selector = true;
+            instr.selector = node.selector[0];
+            if (instr.selector.find("*") != std::string::npos) {
+                instr.wildcard = true;
+                instr.pattern_index = this->patterns.size();
+                this->patterns.emplace_back(instr.selector);
+            }
+        }
+    } else if (UDQ::scalarFunc(node.type)) {
+        this->compile(node.arglist[0], depth);
+        instr.op = OpCode::scalar_func;
+        instr.func_index = func_index(this->scalar_funcs, instr.name);
+    } else if (UDQ::elementalUnaryFunc(node.type)) {
+        this->compile(node.arglist[0], depth);
+        instr.op = OpCode::unary_func;
+        instr.func_index = func_index(this->unary_funcs, instr.name);
+    } else if (UDQ::binaryFunc(node.type)) {
+        this->compile(node.arglist[0], depth);
+        this->compile(node.arglist[1], depth + 1);
+        instr.op = OpCode::binary_func;
+        instr.func_index = func_index(this->binary_funcs, instr.name);
+    } else if (node.type == UDQTokenType::number) {
+        instr.op = OpCode::load_number;
+        instr.value = node.scalar_value;
+    } else
+        instr.op = OpCode::invalid;
+
+    this->code.push_back(std::move(instr));
+}
+
+
+const std::vector<std::string>& UDQProgram::input_variables() const {
+    return this->inputs;
+}
+
+
+/*
+  The function objects are only looked up again when the program is
+  evaluated with a different function table; a program is normally always
+  evaluated with the function table of the same UDQInput.
+*/
+std::shared_ptr<const UDQProgram::FunctionBinding> UDQProgram::bind(const UDQFunctionTable& udqft) const {
+    std::lock_guard<std::mutex> lock(this->binding_mutex);
+    if (this->binding && this->binding->table_id == udqft.id())
+        return this->binding;
+
+    auto new_binding = std::make_shared<FunctionBinding>();
+    new_binding->table_id = udqft.id();
+    new_binding->scalar = resolve<UDQScalarFunction>(udqft, this->scalar_funcs, "scalar");
+    new_binding->unary = resolve<UDQUnaryElementalFunction>(udqft, this->unary_funcs, "unary elemental");
+    new_binding->binary = resolve<UDQBinaryFunction>(udqft, this->binary_funcs, "binary");
+
+    this->binding = std::move(new_binding);
+    return this->binding;
+}
+
+
+UDQSet UDQProgram::eval(UDQVarType target_type, const UDQContext& context) const {
+    const auto funcs = this->bind(context.function_table());
+
+    std::vector<std::string> wells;
+    std::vector<std::string> groups;
+    bool wells_loaded = false;
+    bool groups_loaded = false;
+
+    std::vector<UDQSet> stack;
+    stack.reserve(this->max_depth);
+
+    for (const auto& instr : this->code) {
+        switch (instr.op) {
+        case OpCode::load_well:
+        {
+            if (!wells_loaded) {
+                wells = context.wells();
+                wells_loaded = true;
+            }
+
+            if (instr.has_selector && !instr.wildcard) {
+                stack.push_back( UDQSet::wells(instr.name, wells, context.get_well_var(instr.selector, instr.name)) );
+                break;
+            }
+
+            const NamePattern * pattern = instr.wildcard ? &this->patterns[instr.pattern_index] : nullptr;
+            auto res = UDQSet::wells(instr.name, wells);
+            for (std::size_t index = 0; index < wells.size(); index++) {
+                const auto& well = wells[index];
+                if (pattern && !pattern->match(well))
+                    continue;
+
+                if (context.has_well_var(well, instr.name))
+                    res.assign(index, context.get_well_var(well, instr.name));
+            }
+            stack.push_back(std::move(res));
+            break;
+        }
+
+        case OpCode::load_group:
+        {
+            if (!groups_loaded) {
+                groups = context.groups();
+                groups_loaded = true;
+            }
+
+            if (instr.has_selector && !instr.wildcard) {
+                stack.push_back( UDQSet::groups(instr.name, groups, context.get_group_var(instr.selector, instr.name)) );
+                break;
+            }
+
+            const NamePattern * pattern = instr.wildcard ? &this->patterns[instr.pattern_index] : nullptr;
+            auto res = UDQSet::groups(instr.name, groups);
+            for (std::size_t index = 0; index < groups.size(); index++) {
+                const auto& group = groups[index];
+                if (pattern && !pattern->match(group))
+                    continue;
+
+                if (context.has_group_var(group, instr.name))
+                    res.assign(index, context.get_group_var(group, instr.name));
+            }
+            stack.push_back(std::move(res));
+            break;
+        }
+
+        case OpCode::load_number:
+            switch(target_type) {
+            case UDQVarType::WELL_VAR:
+                if (!wells_loaded) {
+                    wells = context.wells();
+                    wells_loaded = true;
+                }
+                stack.push_back( UDQSet::wells(instr.name, wells, instr.value) );
+                break;
+            case UDQVarType::SCALAR:
+                stack.push_back( UDQSet::scalar(instr.name, instr.value) );
+                break;
+            case UDQVarType::FIELD_VAR:
+                stack.push_back( UDQSet::field(instr.name, instr.value) );
+                break;
+            default:
+                throw std::invalid_argument("Unsupported target_type: " + std::to_string(static_cast<int>(target_type)));
+            }
+            break;
+
+        case OpCode::scalar_func:
+        {
+            const auto * func = funcs->scalar[instr.func_index];
+            stack.back() = func->eval(stack.back());
+            break;
+        }
+
+        case OpCode::unary_func:
+        {
+            const auto * func = funcs->unary[instr.func_index];
+            stack.back() = func->eval(stack.back());
+            break;
+        }
+
+        case OpCode::binary_func:
+        {
+            const auto * func = funcs->binary[instr.func_index];
+            auto right_arg = std::move(stack.back());
+            stack.pop_back();
+            stack.back() = func->eval(stack.back(), right_arg);
+            break;
+        }
+
+        case OpCode::invalid:
+            throw std::invalid_argument("Should not be here ...");
+        }
+    }
+
+    return std::move(stack.back());
+}
+
+}
@@ -0,0 +1,131 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQPROGRAM_HPP
+#define UDQPROGRAM_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/NamePattern.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQSet.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQContext.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQEnums.hpp>
+
+#include "UDQASTNode.hpp"
+
+namespace Opm {
+
+class UDQFunctionTable;
+class UDQScalarFunction;
+class UDQUnaryElementalFunction;
+class UDQBinaryFunction;
+
+/*
+  The UDQProgram class is a compiled version of a UDQASTNode expression tree.
+  The tree is flattened once to a list of instructions in postfix order, and
+  evaluation is then a simple loop over the instructions with a stack of
+  UDQSet operands. The function objects are looked up and checked against
+  the function type of the instruction once for each function table, the
+  well and group name patterns are compiled once, and the list of wells and
+  groups is only fetched once from the context for each evaluation.
+*/
+
+class UDQProgram {
+public:
+    explicit UDQProgram(const UDQASTNode& ast);
+    UDQSet eval(UDQVarType target_type, const UDQContext& context) const;
+
+    /*
+      The names of the summary variables loaded by the program, unique and in
+      the order of first use; this includes the names of other UDQ variables
+      and is used to order the evaluation of UDQ definitions.
+    */
+    const std::vector<std::string>& input_variables() const;
+
+private:
+    enum class OpCode {
+        load_well,
+        load_group,
+        load_number,
+        scalar_func,
+        unary_func,
+        binary_func,
+        invalid
+    };
+
+    struct Instruction {
+        OpCode op;
+
+        /*
+          The name of the summary variable or function; for numbers the
+          original string representation.
+        */
+        std::string name;
+        double value = 0;
+
+        /*
+          For well and group variables the optional well/group selector;
+          when the selector contains a '*' it is used as a pattern through
+          patterns[pattern_index].
+        */
+        std::string selector;
+        std::size_t pattern_index = 0;
+        bool has_selector = false;
+        bool wildcard = false;
+
+        /*
+          For functions the index of the function in the scalar_funcs,
+          unary_funcs or binary_funcs list matching op.
+        */
+        std::size_t func_index = 0;
+    };
+
+    /*
+      The function objects of one function table, indexed like the function
+      name lists.
+    */
+    struct FunctionBinding {
+        std::size_t table_id;
+        std::vector<const UDQScalarFunction*> scalar;
+        std::vector<const UDQUnaryElementalFunction*> unary;
+        std::vector<const UDQBinaryFunction*> binary;
+    };
+
+    void compile(const UDQASTNode& node, std::size_t depth);
+    std::shared_ptr<const FunctionBinding> bind(const UDQFunctionTable& udqft) const;
+
+    std::vector<Instruction> code;
+    std::vector<NamePattern> patterns;
+    std::vector<std::string> inputs;
+    std::vector<std::string> scalar_funcs;
+    std::vector<std::string> unary_funcs;
+    std::vector<std::string> binary_funcs;
+    std::size_t max_depth = 0;
+
+    mutable std::mutex binding_mutex;
+    mutable std::shared_ptr<const FunctionBinding> binding;
+};
+
+}
+
+#endif
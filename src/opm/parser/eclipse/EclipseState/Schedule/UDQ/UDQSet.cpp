@@ -16,7 +16,7 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
-#include <fnmatch.h>
+#include <opm/parser/eclipse/EclipseState/Schedule/NamePattern.hpp>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQSet.hpp>
 
@@ -135,15 +135,30 @@ UDQSet UDQSet::field(const std::string& name, double scalar_value)
 }
 
 
-UDQSet UDQSet::wells(const std::string& name, const std::vector<std::string>& wells) {
-    UDQSet us(name, UDQVarType::WELL_VAR, wells.size());
+std::shared_ptr<const std::unordered_map<std::string, std::size_t>> UDQSet::make_index(const std::vector<std::string>& wgnames) {
+    auto wgname_index = std::make_shared<std::unordered_map<std::string, std::size_t>>();
+    wgname_index->reserve(wgnames.size());
 
     std::size_t index = 0;
-    for (const auto& well : wells) {
-        us.wgname_index[well] = index;
+    for (const auto& wgname : wgnames) {
+        (*wgname_index)[wgname] = index;
         index += 1;
     }
 
+    return wgname_index;
+}
+
+std::size_t UDQSet::index(const std::string& wgname) const {
+    if (!this->wgname_index)
+        throw std::out_of_range("No such well/group: " + wgname);
+
+    return this->wgname_index->at(wgname);
+}
+
+
+UDQSet UDQSet::wells(const std::string& name, const std::vector<std::string>& wells) {
+    UDQSet us(name, UDQVarType::WELL_VAR, wells.size());
+    us.wgname_index = UDQSet::make_index(wells);
     return us;
 }
 
@@ -156,13 +171,7 @@ UDQSet UDQSet::wells(const std::string& name, const std::vector<std::string>& we
 
 UDQSet UDQSet::groups(const std::string& name, const std::vector<std::string>& groups) {
     UDQSet us(name, UDQVarType::GROUP_VAR, groups.size());
-
-    std::size_t index = 0;
-    for (const auto& group : groups) {
-        us.wgname_index[group] = index;
-        index += 1;
-    }
-
+    us.wgname_index = UDQSet::make_index(groups);
     return us;
 }
 
@@ -181,12 +190,14 @@ std::size_t UDQSet::size() const {
 
 void UDQSet::assign(const std::string& wgname, double value) {
     if (wgname.find('*') == std::string::npos) {
-        std::size_t index = this->wgname_index.at(wgname);
-        UDQSet::assign(index, value);
+        UDQSet::assign(this->index(wgname), value);
     } else {
-        int flags = 0;
-        for (const auto& pair : this->wgname_index) {
-            if (fnmatch(wgname.c_str(), pair.first.c_str(), flags) == 0)
+        if (!this->wgname_index)
+            return;
+
+        const NamePattern pattern(wgname);
+        for (const auto& pair : *this->wgname_index) {
+            if (pattern.match(pair.first))
                 UDQSet::assign(pair.second, value);
         }
     }
@@ -286,8 +297,7 @@ const UDQScalar& UDQSet::operator[](std::size_t index) const {
 }
 
 const UDQScalar& UDQSet::operator[](const std::string& well) const {
-    std::size_t index = this->wgname_index.at(well);
-    return this->operator[](index);
+    return this->operator[](this->index(well));
 }
 
 
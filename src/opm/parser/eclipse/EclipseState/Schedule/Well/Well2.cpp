@@ -21,6 +21,7 @@
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/parser/eclipse/Parser/ParserKeywords/W.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/MSW/updatingConnectionsWithSegments.hpp>
+#include <opm/parser/eclipse/EclipseState/Schedule/NamePattern.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/Well2.hpp>
 
 #include "WellProductionProperties.hpp"
@@ -725,11 +726,7 @@ double Well2::injection_rate(const SummaryState& st, Phase phase_arg) const {
 
 
 bool Well2::wellNameInWellNamePattern(const std::string& wellName, const std::string& wellNamePattern) {
-    bool wellNameInPattern = false;
-    if (util_fnmatch( wellNamePattern.c_str() , wellName.c_str()) == 0) {
-        wellNameInPattern = true;
-    }
-    return wellNameInPattern;
+    return NamePattern(wellNamePattern).match(wellName);
 }
 
 
@@ -751,6 +748,21 @@ InjectionControls Well2::injectionControls(const SummaryState& st) const {
         throw std::logic_error("Trying to get injection data from a producer");
 }
 
+bool Well2::hasUDAControls() const {
+    auto is_uda = [](const UDAValue& value) { return value.is<std::string>(); };
+
+    if (this->isProducer()) {
+        const auto& prod = *this->production;
+        return is_uda(prod.OilRate) || is_uda(prod.WaterRate) || is_uda(prod.GasRate) ||
+               is_uda(prod.LiquidRate) || is_uda(prod.ResVRate) ||
+               is_uda(prod.BHPLimit) || is_uda(prod.THPLimit);
+    }
+
+    const auto& inj = *this->injection;
+    return is_uda(inj.surfaceInjectionRate) || is_uda(inj.reservoirInjectionRate) ||
+           is_uda(inj.BHPLimit) || is_uda(inj.THPLimit);
+}
+
 
 /*
   These three accessor functions are at the "wrong" level of abstraction;
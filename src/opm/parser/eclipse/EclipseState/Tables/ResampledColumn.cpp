@@ -0,0 +1,97 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <opm/parser/eclipse/EclipseState/Tables/ResampledColumn.hpp>
+#include <opm/parser/eclipse/EclipseState/Tables/SimpleTable.hpp>
+#include <opm/parser/eclipse/EclipseState/Tables/TableColumn.hpp>
+
+namespace Opm {
+
+namespace {
+
+    ResampledColumn::ErrorReport
+    compare(const UniformTableLinear<double>& resampled,
+            const std::vector<double>&        args,
+            const std::vector<double>&        values,
+            const double                      tolerance)
+    {
+        ResampledColumn::ErrorReport report { 0.0, args.front(), 0, true };
+
+        for (size_t row = 0; row < args.size(); ++row) {
+            const double error = std::fabs(resampled(args[row]) - values[row]);
+            if (error > report.maxError) {
+                report.maxError = error;
+                report.maxErrorArgument = args[row];
+            }
+        }
+
+        report.withinTolerance = !(report.maxError > tolerance);
+        return report;
+    }
+
+}
+
+    ResampledColumn::ResampledColumn(const SimpleTable& table,
+                                     const std::string& columnName,
+                                     double tolerance,
+                                     std::size_t maxSamples)
+    {
+        const auto& argColumn = table.getColumn( 0 );
+        if (argColumn.size() < 2)
+            throw std::invalid_argument("Must have at least two rows in table to resample column " + columnName);
+
+        const double xmin = argColumn.min();
+        const double xmax = argColumn.max();
+        if (!(xmin < xmax))
+            throw std::invalid_argument("Can not resample column " + columnName + " of table with empty argument range");
+
+        // The original table at its own rows; this is what the
+        // resampled copy is measured against.
+        const auto args = argColumn.vectorCopy();
+        const auto values = table.evaluate( columnName , args );
+
+        size_t intervals = args.size() - 1;
+        while (true) {
+            std::vector<double> x( intervals + 1 );
+            for (size_t i = 0; i <= intervals; ++i) {
+                const double w = double(i) / double(intervals);
+                x[i] = (1.0 - w)*xmin + w*xmax;
+            }
+
+            m_table = UniformTableLinear<double>( xmin , xmax , table.evaluate( columnName , x ));
+            m_error = compare( m_table , args , values , tolerance );
+            m_error.numSamples = x.size();
+
+            if (m_error.withinTolerance || (2*intervals + 1 > maxSamples))
+                break;
+
+            intervals *= 2;
+        }
+    }
+
+
+    const ResampledColumn::ErrorReport& ResampledColumn::error() const {
+        return m_error;
+    }
+
+}
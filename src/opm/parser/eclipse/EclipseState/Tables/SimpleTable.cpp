@@ -146,6 +146,14 @@ namespace Opm {
         return valueColumn.eval( index );
     }
 
+    std::vector<double> SimpleTable::evaluate(const std::string& columnName, const std::vector<double>& xPos) const
+    {
+        const auto& argColumn = getColumn( 0 );
+        const auto& valueColumn = getColumn( columnName );
+
+        return valueColumn.eval( argColumn.lookup( xPos ) );
+    }
+
     void SimpleTable::assertJFuncPressure(const bool jf) const {
         if (jf == m_jfunc)
             return;
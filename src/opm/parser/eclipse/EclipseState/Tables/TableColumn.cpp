@@ -26,6 +26,8 @@
 
 namespace Opm {
 
+    constexpr size_t TableColumn::npos;
+
     TableColumn::TableColumn(const ColumnSchema& schema) :
         m_schema( schema )
     {
@@ -45,13 +47,17 @@ namespace Opm {
     }
 
     const std::string& TableColumn::name() const {
-        return m_name;
+        return m_schema.name();
+    }
+
+    bool TableColumn::isDefault(size_t index) const {
+        return !m_default.empty() && m_default[index];
     }
 
     void TableColumn::assertNext(size_t index , double value) const {
         size_t nextIndex = index + 1;
         if (nextIndex < m_values.size()) {
-            if (!m_default[nextIndex]) {
+            if (!isDefault(nextIndex)) {
                 double nextValue = m_values[nextIndex];
                 assertOrder( value , nextValue );
             }
@@ -62,7 +68,7 @@ namespace Opm {
     void TableColumn::assertPrevious(size_t index , double value) const {
         if (index > 0) {
             size_t prevIndex = index - 1;
-            if (!m_default[prevIndex]) {
+            if (!isDefault(prevIndex)) {
                 double prevValue = m_values[prevIndex];
                 assertOrder( prevValue , value );
             }
@@ -81,7 +87,9 @@ namespace Opm {
     void TableColumn::addValue(double value) {
         assertUpdate( m_values.size() , value );
         m_values.push_back( value );
-        m_default.push_back( false );
+        if (!m_default.empty())
+            m_default.push_back( false );
+        updateExtrema( m_values.size() - 1 );
     }
 
 
@@ -91,6 +99,11 @@ namespace Opm {
         if (defaultAction == Table::DEFAULT_CONST)
             addValue( m_schema.getDefaultValue( ));
         else if (defaultAction == Table::DEFAULT_LINEAR) {
+            // The default flags are only allocated once the first
+            // default is added.
+            if (m_default.empty())
+                m_default.assign( m_values.size() , false );
+
             m_values.push_back( -1 ); // Should never even be read.
             m_default.push_back( true );
             m_defaultCount += 1;
@@ -103,24 +116,62 @@ namespace Opm {
     void TableColumn::updateValue(  size_t index , double value ) {
         assertUpdate( index , value );
         m_values[index] = value;
-        if (m_default[index]) {
+        if (isDefault(index)) {
             m_default[index] = false;
             m_defaultCount -= 1;
+
+            // All defaults applied, the flags are no longer needed.
+            if (m_defaultCount == 0)
+                std::vector<bool>().swap( m_default );
         }
+        updateExtrema( index );
+    }
+
+
+    void TableColumn::updateExtrema(size_t index) {
+        if ((index == m_minIndex) || (index == m_maxIndex)) {
+            // The current extremum may have changed, rescan.
+            m_minIndex = npos;
+            m_maxIndex = npos;
+            for (size_t i = 0; i < m_values.size(); ++i) {
+                if (isDefault(i))
+                    continue;
+
+                if ((m_minIndex == npos) || (m_values[i] < m_values[m_minIndex]))
+                    m_minIndex = i;
+
+                if ((m_maxIndex == npos) || (m_values[m_maxIndex] < m_values[i]))
+                    m_maxIndex = i;
+            }
+            return;
+        }
+
+        // Ties go to the first position, as for std::min_element() and
+        // std::max_element().
+        const double value = m_values[index];
+        if ((m_minIndex == npos) ||
+            (value < m_values[m_minIndex]) ||
+            ((value == m_values[m_minIndex]) && (index < m_minIndex)))
+            m_minIndex = index;
+
+        if ((m_maxIndex == npos) ||
+            (m_values[m_maxIndex] < value) ||
+            ((value == m_values[m_maxIndex]) && (index < m_maxIndex)))
+            m_maxIndex = index;
     }
 
     bool TableColumn::defaultApplied(size_t index) const {
         if (index >= m_values.size())
             throw std::invalid_argument("Value: " + std::to_string( index ) + " out of range: [0," + std::to_string( m_values.size()) + ")");
 
-        return m_default[index];
+        return isDefault(index);
     }
 
     double TableColumn::operator[](size_t index) const {
         if (index >= m_values.size())
             throw std::invalid_argument("Value: " + std::to_string( index ) + " out of range: [0," + std::to_string( m_values.size()) + ")");
 
-        if (m_default[index])
+        if (isDefault(index))
             throw std::invalid_argument("Value at index " + std::to_string( index ) + " is defaulted - can not ask!");
 
         return m_values[index];
@@ -139,7 +190,7 @@ namespace Opm {
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
         if (m_values.size() > 0)
-            return *std::max_element( m_values.begin() , m_values.end());
+            return m_values[m_maxIndex];
         else
             throw std::invalid_argument("Can not find max in empty column");
     }
@@ -149,7 +200,7 @@ namespace Opm {
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
         if (m_values.size() > 0)
-            return *std::min_element( m_values.begin() , m_values.end());
+            return m_values[m_minIndex];
         else
             throw std::invalid_argument("Can not find max in empty column");
     }
@@ -170,7 +221,7 @@ namespace Opm {
     }
 
 
-    TableIndex TableColumn::lookup( double argValue ) const {
+    void TableColumn::assertLookup() const {
         if (!m_schema.lookupValid( ))
             throw std::invalid_argument("Must have an ordered column to perform table argument lookup.");
 
@@ -179,46 +230,90 @@ namespace Opm {
 
         if (hasDefault())
             throw std::invalid_argument("Can not lookup elements in a column with defaulted values.");
+    }
+
+
+    TableIndex TableColumn::lookup( double argValue ) const {
+        assertLookup();
+        return lookupAssumeValid( argValue , npos );
+    }
+
+
+    TableIndex TableColumn::lookup( double argValue , size_t hint ) const {
+        assertLookup();
+        return lookupAssumeValid( argValue , hint );
+    }
+
 
-        if (argValue >= max()) {
-            const auto max_iter = std::max_element( m_values.begin() , m_values.end());
-            const size_t max_index = max_iter - m_values.begin();
-            return TableIndex( max_index , 1.0 );
+    std::vector<TableIndex> TableColumn::lookup( const std::vector<double>& argValues ) const {
+        std::vector<TableIndex> indices;
+        if (argValues.empty())
+            return indices;
+
+        assertLookup();
+
+        indices.reserve( argValues.size() );
+        size_t hint = npos;
+        for (const auto& argValue : argValues) {
+            indices.push_back( lookupAssumeValid( argValue , hint ) );
+            hint = indices.back().getIndex1();
         }
 
-        if (argValue <= min()) {
-            const auto min_iter = std::min_element( m_values.begin() , m_values.end());
-            const size_t min_index = min_iter - m_values.begin();
-            return TableIndex( min_index , 1.0 );
+        return indices;
+    }
+
+
+    TableIndex TableColumn::lookupAssumeValid( double argValue , size_t hint ) const {
+        if (argValue >= m_values[m_maxIndex])
+            return TableIndex( m_maxIndex , 1.0 );
+
+        if (argValue <= m_values[m_minIndex])
+            return TableIndex( m_minIndex , 1.0 );
+
+        const bool isDescending = m_schema.isDecreasing( );
+
+        /*
+          The interval is the last intervalIdx for which the predicate
+          below holds; the predicate is true for a leading part of the
+          column since the column is ordered.
+        */
+        const auto before = [this, isDescending, argValue](size_t idx) {
+            if (isDescending)
+                return !(m_values[idx] < argValue);
+            else
+                return m_values[idx] < argValue;
+        };
+
+        const auto index = [this, argValue](size_t intervalIdx) {
+            double weight1 = 1 - (argValue - m_values[intervalIdx])/(m_values[intervalIdx + 1] - m_values[intervalIdx]);
+            return TableIndex( intervalIdx , weight1 );
+        };
+
+        if (hint < size() - 1) {
+            if (before( hint )) {
+                if (!before( hint + 1 ))
+                    return index( hint );
+
+                if ((hint + 2 < size()) && !before( hint + 2 ))
+                    return index( hint + 1 );
+            }
         }
 
         {
-            bool isDescending = m_schema.isDecreasing( );
             size_t lowIntervalIdx = 0;
             size_t intervalIdx = (size() - 1)/2;
             size_t highIntervalIdx = size() - 1;
-            double weight1;
 
             while (lowIntervalIdx + 1 < highIntervalIdx) {
-                if (isDescending) {
-                    if (m_values[intervalIdx] < argValue)
-                        highIntervalIdx = intervalIdx;
-                    else
-                        lowIntervalIdx = intervalIdx;
-                }
-                else {
-                    if (m_values[intervalIdx] < argValue)
-                        lowIntervalIdx = intervalIdx;
-                    else
-                        highIntervalIdx = intervalIdx;
-                }
+                if (before( intervalIdx ))
+                    lowIntervalIdx = intervalIdx;
+                else
+                    highIntervalIdx = intervalIdx;
 
                 intervalIdx = (highIntervalIdx + lowIntervalIdx)/2;
             }
 
-            weight1 = 1 - (argValue - m_values[intervalIdx])/(m_values[intervalIdx + 1] - m_values[intervalIdx]);
-
-            return TableIndex( intervalIdx , weight1 );
+            return index( intervalIdx );
         }
     }
 
@@ -251,13 +346,24 @@ namespace Opm {
     }
 
 
+    std::vector<double> TableColumn::eval( const std::vector<TableIndex>& indices) const {
+        std::vector<double> values;
+        values.reserve( indices.size() );
+        for (const auto& index : indices)
+            values.push_back( eval( index ) );
+
+        return values;
+    }
+
+
     TableColumn& TableColumn::operator= (const TableColumn& other) {
         if (this != &other) {
             m_schema = other.m_schema;
-            m_name = other.m_name;
             m_values = other.m_values;
             m_default = other.m_default;
             m_defaultCount = other.m_defaultCount;
+            m_minIndex = other.m_minIndex;
+            m_maxIndex = other.m_maxIndex;
         }
         return *this;
     }
@@ -18,7 +18,10 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstddef>
+#include <exception>
 #include <memory>
+#include <vector>
 
 #include <opm/common/OpmLog/LogUtil.hpp>
 
@@ -142,7 +145,6 @@ namespace Opm {
 
         if ( deck.hasKeyword( "ROCK2DTR") )
             initRockTables(deck, "ROCK2DTR", m_rock2dtrTables );
-
     }
 
     void TableManager::initDims(const Deck& deck) {
@@ -199,6 +201,13 @@ namespace Opm {
             return pair->second;
     }
 
+    ResampledColumn TableManager::getResampledColumn( const std::string& tableName,
+                                                      size_t tableNumber,
+                                                      const std::string& columnName,
+                                                      double tolerance ) const {
+        return ResampledColumn( getTables( tableName ).getTable( tableNumber ) , columnName , tolerance );
+    }
+
     TableContainer& TableManager::forceGetTables( const std::string& tableName , size_t numTables )  {
         auto pair = m_simpleTables.find( tableName );
         if (pair == m_simpleTables.end()) {
@@ -900,6 +909,34 @@ namespace Opm {
         }
     }
 
+    namespace {
+        /*
+          Building one table is a few microseconds of work, so small
+          table keywords are built on the calling thread.
+        */
+        const std::size_t parallelTableCount = 16;
+    }
+
+    void TableManager::buildTables(size_t numTables, const std::function<void(size_t)>& buildTable) {
+        std::vector<std::exception_ptr> errors( numTables );
+        const auto n = static_cast<std::ptrdiff_t>( numTables );
+
+#pragma omp parallel for schedule(dynamic) if (numTables >= parallelTableCount)
+        for (std::ptrdiff_t tableIdx = 0; tableIdx < n; ++tableIdx) {
+            try {
+                buildTable( tableIdx );
+            }
+            catch (...) {
+                errors[tableIdx] = std::current_exception();
+            }
+        }
+
+        for (const auto& error : errors) {
+            if (error)
+                std::rethrow_exception( error );
+        }
+    }
+
     double TableManager::rtemp() const {
         return this->m_rtemp;
     }
@@ -31,6 +31,7 @@
 #include <opm/parser/eclipse/RawDeck/RawRecord.hpp>
 #include <opm/parser/eclipse/RawDeck/StarToken.hpp>
 #include <opm/parser/eclipse/Deck/UDAValue.hpp>
+#include <opm/parser/eclipse/Units/UnitSystem.hpp>
 
 namespace Opm {
 
@@ -263,6 +264,12 @@ const std::string& ParserItem::getDimension( size_t index ) const {
     throw std::invalid_argument("Item is not double / UDA .");
 }
 
+std::size_t ParserItem::getDimensionHandle( size_t index ) const {
+    if( this->data_type == type_tag::fdouble || this->data_type == type_tag::uda)
+        return this->dimension_handles.at( index );
+    throw std::invalid_argument("Item is not double / UDA .");
+}
+
 void ParserItem::push_backDimension( const std::string& dim ) {
     if (!(this->input_type == ParserItem::itype::DOUBLE || this->input_type == ParserItem::itype::UDA))
         throw std::invalid_argument( "Invalid type, does not have dimension." );
@@ -274,6 +281,7 @@ void ParserItem::push_backDimension( const std::string& dim ) {
     }
 
     this->dimensions.push_back( dim );
+    this->dimension_handles.push_back( UnitSystem::dimensionHandle( dim ) );
 }
 
     const std::string& ParserItem::name() const {
@@ -472,7 +480,8 @@ namespace {
 
 template< typename T >
 DeckItem scan_item( const ParserItem& p, RawRecord& record ) {
-    DeckItem item( p.name(), T(), record.size() );
+    const size_t size_hint = p.sizeType() == ParserItem::item_size::SINGLE ? 1 : record.size();
+    DeckItem item( p.name(), T(), size_hint );
     bool parse_raw = p.parseRaw();
 
     if( p.sizeType() == ParserItem::item_size::ALL ) {
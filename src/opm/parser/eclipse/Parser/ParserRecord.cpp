@@ -100,8 +100,9 @@ namespace {
 
             auto& deckItem = deckRecord.getItem( parser_item.name() );
             for (size_t idim = 0; idim < parser_item.numDimensions(); idim++) {
-                auto activeDimension  = deck.getActiveUnitSystem().getNewDimension( parser_item.getDimension(idim) );
-                auto defaultDimension = deck.getDefaultUnitSystem().getNewDimension( parser_item.getDimension(idim) );
+                const auto handle = parser_item.getDimensionHandle(idim);
+                const auto& activeDimension  = deck.getActiveUnitSystem().getNewDimension( handle );
+                const auto& defaultDimension = deck.getDefaultUnitSystem().getNewDimension( handle );
                 deckItem.push_backDimension( activeDimension , defaultDimension );
             }
 
@@ -115,9 +116,9 @@ namespace {
             if (parser_item.dataType() == type_tag::uda && deckItem.size() > 0) {
                 auto uda = deckItem.get<UDAValue>(0);
                 if (deckItem.defaultApplied(0))
-                    uda.set_dim( deck.getDefaultUnitSystem().getNewDimension( parser_item.getDimension(0)));
+                    uda.set_dim( deck.getDefaultUnitSystem().getNewDimension( parser_item.getDimensionHandle(0)));
                 else
-                    uda.set_dim( deck.getActiveUnitSystem().getNewDimension( parser_item.getDimension(0)));
+                    uda.set_dim( deck.getActiveUnitSystem().getNewDimension( parser_item.getDimensionHandle(0)));
             }
         }
     }
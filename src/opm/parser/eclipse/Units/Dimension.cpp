@@ -51,6 +51,14 @@ namespace Opm {
         return m_SIfactor;
     }
 
+    /*
+      As getSIScaling(), but returns the NaN factor of a context dependent
+      unit instead of throwing.
+    */
+    double Dimension::getSIScalingRaw() const {
+        return m_SIfactor;
+    }
+
     double Dimension::getSIOffset() const {
         return m_SIoffset;
     }
@@ -18,8 +18,13 @@
 */
 
 
+#include <array>
+#include <cstddef>
 #include <iostream>
+#include <mutex>
 #include <stdexcept>
+#include <unordered_map>
+#include <utility>
 #include <boost/algorithm/string.hpp>
 
 #include <opm/parser/eclipse/Units/Dimension.hpp>
@@ -42,7 +47,7 @@ namespace {
     // =================================================================
     // METRIC Unit Conventions
 
-    static const double from_metric_offset[] = {
+    static constexpr double from_metric_offset[] = {
         0.0,
         0.0,
         0.0,
@@ -76,7 +81,7 @@ namespace {
         0.0
     };
 
-    static const double to_metric[] = {
+    static constexpr double to_metric[] = {
         1,
         1 / Metric::Length,
         1 / Metric::Time,
@@ -112,7 +117,7 @@ namespace {
 
     };
 
-    static const double from_metric[] = {
+    static constexpr double from_metric[] = {
         1,
         Metric::Length,
         Metric::Time,
@@ -185,7 +190,7 @@ namespace {
     // =================================================================
     // FIELD Unit Conventions
 
-    static const double from_field_offset[] = {
+    static constexpr double from_field_offset[] = {
         0.0,
         0.0,
         0.0,
@@ -219,7 +224,7 @@ namespace {
         0.0
     };
 
-    static const double to_field[] = {
+    static constexpr double to_field[] = {
         1,
         1 / Field::Length,
         1 / Field::Time,
@@ -254,7 +259,7 @@ namespace {
 
     };
 
-    static const double from_field[] = {
+    static constexpr double from_field[] = {
          1,
          Field::Length,
          Field::Time,
@@ -327,7 +332,7 @@ namespace {
     // =================================================================
     // LAB Unit Conventions
 
-    static const double from_lab_offset[] = {
+    static constexpr double from_lab_offset[] = {
         0.0,
         0.0,
         0.0,
@@ -361,7 +366,7 @@ namespace {
         0.0
     };
 
-    static const double to_lab[] = {
+    static constexpr double to_lab[] = {
         1,
         1 / Lab::Length,
         1 / Lab::Time,
@@ -396,7 +401,7 @@ namespace {
 
     };
 
-    static const double from_lab[] = {
+    static constexpr double from_lab[] = {
         1,
         Lab::Length,
         Lab::Time,
@@ -469,7 +474,7 @@ namespace {
     // =================================================================
     // PVT-M Unit Conventions
 
-    static const double from_pvt_m_offset[] = {
+    static constexpr double from_pvt_m_offset[] = {
         0.0,
         0.0,
         0.0,
@@ -503,7 +508,7 @@ namespace {
         0.0
     };
 
-    static const double to_pvt_m[] = {
+    static constexpr double to_pvt_m[] = {
         1,
         1 / PVT_M::Length,
         1 / PVT_M::Time,
@@ -538,7 +543,7 @@ namespace {
 
     };
 
-    static const double from_pvt_m[] = {
+    static constexpr double from_pvt_m[] = {
         1,
         PVT_M::Length,
         PVT_M::Time,
@@ -611,7 +616,7 @@ namespace {
     // =================================================================
     // INPUT Unit Conventions
 
-    static const double from_input_offset[] = {
+    static constexpr double from_input_offset[] = {
         0.0,
         0.0,
         0.0,
@@ -645,7 +650,7 @@ namespace {
         0.0
     };
 
-    static const double to_input[] = {
+    static constexpr double to_input[] = {
         1,
         1,
         1,
@@ -679,7 +684,7 @@ namespace {
         1
     };
 
-    static const double from_input[] = {
+    static constexpr double from_input[] = {
         1,
         1,
         1,
@@ -748,6 +753,55 @@ namespace {
 
     };
 
+    /*
+      The conversions of every measure in every unit system, indexed by
+      UnitType and measure and generated at compile time from the
+      arrays above.
+    */
+    constexpr std::size_t numMeasures =
+        static_cast< std::size_t >( UnitSystem::measure::num_measures );
+
+    using MeasureConversions = std::array< UnitSystem::MeasureConversion, numMeasures >;
+
+    template< std::size_t... I >
+    constexpr MeasureConversions makeConversions( const double* to_si,
+                                                  const double* from_si,
+                                                  const double* offset,
+                                                  std::index_sequence< I... > ) {
+        return {{ UnitSystem::MeasureConversion { to_si[ I ], from_si[ I ], offset[ I ] }... }};
+    }
+
+    template< std::size_t N >
+    constexpr MeasureConversions makeConversions( const double (&to_si)[ N ],
+                                                  const double (&from_si)[ N ],
+                                                  const double (&offset)[ N ] ) {
+        static_assert( N >= numMeasures, "Every measure must have a conversion" );
+        return makeConversions( to_si, from_si, offset, std::make_index_sequence< numMeasures >{} );
+    }
+
+    static constexpr MeasureConversions measure_conversions[] = {
+        makeConversions( from_metric, to_metric, from_metric_offset ),
+        makeConversions( from_field, to_field, from_field_offset ),
+        makeConversions( from_lab, to_lab, from_lab_offset ),
+        makeConversions( from_pvt_m, to_pvt_m, from_pvt_m_offset ),
+        makeConversions( from_input, to_input, from_input_offset ),
+    };
+
+    const UnitSystem::MeasureConversion* conversions( UnitSystem::UnitType unit ) {
+        return measure_conversions[ static_cast< int >( unit ) ].data();
+    }
+
+    struct DimensionRegistry {
+        std::mutex mutex;
+        std::vector< std::string > names;
+        std::unordered_map< std::string, UnitSystem::DimensionHandle > handles;
+    };
+
+    DimensionRegistry& dimensionRegistry() {
+        static DimensionRegistry registry;
+        return registry;
+    }
+
 } // namespace Anonymous
 
     UnitSystem::UnitSystem(const UnitType unit) :
@@ -782,9 +836,7 @@ namespace {
 
     void UnitSystem::initINPUT() {
         this->m_name = "Input";
-        this->measure_table_from_si = to_input;
-        this->measure_table_to_si = from_input;
-        this->measure_table_to_si_offset = from_input_offset;
+        this->m_conversions = conversions( UnitType::UNIT_TYPE_INPUT );
         this->unit_name_table = input_names;
 
         this->addDimension("1"         , 1.0);
@@ -817,9 +869,7 @@ namespace {
 
     void UnitSystem::initPVT_M() {
         this->m_name = "PVT-M";
-        this->measure_table_from_si = to_pvt_m;
-        this->measure_table_to_si = from_pvt_m;
-        this->measure_table_to_si_offset = from_pvt_m_offset;
+        this->m_conversions = conversions( UnitType::UNIT_TYPE_PVT_M );
         this->unit_name_table = pvt_m_names;
 
         this->addDimension("1"         , 1.0);
@@ -852,9 +902,7 @@ namespace {
 
     void UnitSystem::initLAB() {
         this->m_name = "Lab";
-        this->measure_table_from_si = to_lab;
-        this->measure_table_to_si = from_lab;
-        this->measure_table_to_si_offset = from_lab_offset;
+        this->m_conversions = conversions( UnitType::UNIT_TYPE_LAB );
         this->unit_name_table = lab_names;
 
         this->addDimension("1"    , 1.0);
@@ -888,9 +936,7 @@ namespace {
 
     void UnitSystem::initMETRIC() {
         this->m_name = "Metric";
-        this->measure_table_from_si = to_metric;
-        this->measure_table_to_si = from_metric;
-        this->measure_table_to_si_offset = from_metric_offset;
+        this->m_conversions = conversions( UnitType::UNIT_TYPE_METRIC );
         this->unit_name_table = metric_names;
 
         this->addDimension("1"         , 1.0);
@@ -922,9 +968,7 @@ namespace {
 
     void UnitSystem::initFIELD() {
         m_name = "Field";
-        this->measure_table_from_si = to_field;
-        this->measure_table_to_si = from_field;
-        this->measure_table_to_si_offset = from_field_offset;
+        this->m_conversions = conversions( UnitType::UNIT_TYPE_FIELD );
         this->unit_name_table = field_names;
 
         this->addDimension("1"    , 1.0);
@@ -1036,6 +1080,41 @@ namespace {
     }
 
 
+    UnitSystem::DimensionHandle UnitSystem::dimensionHandle(const std::string& dimension) {
+        auto& registry = dimensionRegistry();
+        std::lock_guard< std::mutex > lock( registry.mutex );
+
+        const auto iter = registry.handles.find( dimension );
+        if( iter != registry.handles.end() )
+            return iter->second;
+
+        registry.names.push_back( dimension );
+        registry.handles.emplace( dimension, registry.names.size() - 1 );
+        return registry.names.size() - 1;
+    }
+
+
+    const Dimension& UnitSystem::getNewDimension(DimensionHandle handle) {
+        auto& cache = this->m_handle_dimensions.dimensions;
+        if( handle < cache.size() && cache[ handle ] )
+            return *cache[ handle ];
+
+        std::string dimension;
+        {
+            auto& registry = dimensionRegistry();
+            std::lock_guard< std::mutex > lock( registry.mutex );
+            dimension = registry.names.at( handle );
+        }
+
+        const auto& dim = this->getNewDimension( dimension );
+        if( handle >= cache.size() )
+            cache.resize( handle + 1, nullptr );
+
+        cache[ handle ] = &dim;
+        return dim;
+    }
+
+
     const Dimension& UnitSystem::getDimension(const std::string& dimension) const {
         return this->m_dimensions.at( dimension );
     }
@@ -1128,9 +1207,7 @@ namespace {
             && std::equal( this->m_dimensions.begin(),
                            this->m_dimensions.end(),
                            rhs.m_dimensions.begin() )
-            && this->measure_table_to_si_offset == rhs.measure_table_to_si_offset
-            && this->measure_table_from_si == rhs.measure_table_from_si
-            && this->measure_table_to_si == rhs.measure_table_to_si
+            && this->m_conversions == rhs.m_conversions
             && this->unit_name_table == rhs.unit_name_table;
     }
 
@@ -1138,31 +1215,69 @@ namespace {
         return !( *this == rhs );
     }
 
-    double UnitSystem::from_si( measure m, double val ) const {
-        return
-            this->measure_table_from_si[ static_cast< int >( m ) ]
-            * (val - this->measure_table_to_si_offset[ static_cast< int >( m ) ]);
-    }
+    namespace {
+
+        /*
+          The conversions are single passes of one multiplication and one
+          addition per element over contiguous memory, which the compiler
+          vectorises.  Arrays of at least parallelConversionSize elements
+          are additionally split between threads.
+        */
+        const std::size_t parallelConversionSize = 64 * 1024;
+
+        template <typename T>
+        void convertFromSI( double factor, double offset, const double* data, T* out, std::size_t size ) {
+            const auto n = static_cast< std::ptrdiff_t >( size );
+
+#pragma omp parallel for if (size >= parallelConversionSize)
+            for (std::ptrdiff_t i = 0; i < n; ++i)
+                out[i] = static_cast< T >( (data[i] - offset) * factor );
+        }
+
+        void convertToSI( double factor, double offset, const double* data, double* out, std::size_t size ) {
+            const auto n = static_cast< std::ptrdiff_t >( size );
+
+#pragma omp parallel for if (size >= parallelConversionSize)
+            for (std::ptrdiff_t i = 0; i < n; ++i)
+                out[i] = data[i] * factor + offset;
+        }
 
-    double UnitSystem::to_si( measure m, double val ) const {
-        return
-            this->measure_table_to_si[ static_cast< int >( m ) ]*val
-            + this->measure_table_to_si_offset[ static_cast< int >( m ) ];
     }
 
     void UnitSystem::from_si( measure m, std::vector<double>& data ) const {
-        double factor = this->measure_table_from_si[ static_cast< int >( m ) ];
-        double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
-        auto scale = [=](double x) { return (x - offset) * factor; };
-        std::transform( data.begin() , data.end() , data.begin() , scale);
+        this->from_si( m, data.data(), data.data(), data.size() );
     }
 
 
     void UnitSystem::to_si( measure m, std::vector<double>& data) const {
-        double factor = this->measure_table_to_si[ static_cast< int >( m ) ];
-        double offset = this->measure_table_to_si_offset[ static_cast< int >( m ) ];
-        auto scale = [=](double x) { return x * factor + offset; };
-        std::transform( data.begin() , data.end() , data.begin() , scale);
+        this->to_si( m, data.data(), data.data(), data.size() );
+    }
+
+    void UnitSystem::from_si( measure m, const double* data, double* out, std::size_t size ) const {
+        double factor = this->m_conversions[ static_cast< int >( m ) ].from_si_factor;
+        double offset = this->m_conversions[ static_cast< int >( m ) ].offset;
+
+        if ((data == out) && (factor == 1.0) && (offset == 0.0))
+            return;
+
+        convertFromSI( factor, offset, data, out, size );
+    }
+
+    void UnitSystem::from_si( measure m, const double* data, float* out, std::size_t size ) const {
+        double factor = this->m_conversions[ static_cast< int >( m ) ].from_si_factor;
+        double offset = this->m_conversions[ static_cast< int >( m ) ].offset;
+
+        convertFromSI( factor, offset, data, out, size );
+    }
+
+    void UnitSystem::to_si( measure m, const double* data, double* out, std::size_t size ) const {
+        double factor = this->m_conversions[ static_cast< int >( m ) ].to_si_factor;
+        double offset = this->m_conversions[ static_cast< int >( m ) ].offset;
+
+        if ((data == out) && (factor == 1.0) && (offset == 0.0))
+            return;
+
+        convertToSI( factor, offset, data, out, size );
     }
 
     const char* UnitSystem::name( measure m ) const {
@@ -0,0 +1,124 @@
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <getopt.h>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ERst.hpp>
+
+using namespace Opm::EclIO;
+using EclEntry = EclFile::EclEntry;
+
+template <typename T>
+void write(EclOutput& outFile, EclFile& file1,
+           const std::string& name, int index)
+{
+    auto vect = file1.get<T>(index);
+    outFile.write(name, vect);
+}
+
+void writeArray(const std::string& name, eclArrType arrType, EclFile& file1, int index, EclOutput& outFile) {
+
+    if (arrType == INTE) {
+        write<int>(outFile, file1, name, index);
+    } else if (arrType == REAL) {
+        write<float>(outFile, file1, name, index);
+    } else if (arrType == DOUB) {
+        write<double>(outFile, file1, name, index);
+    } else if (arrType == LOGI) {
+        write<bool>(outFile, file1, name, index);
+    } else if (arrType == CHAR) {
+        write<std::string>(outFile, file1, name, index);
+    } else if (arrType == MESS) {
+        outFile.message(name);
+    } else {
+        std::cout << "unknown array type " << std::endl;
+        exit(1);
+    }
+}
+
+static void printHelp() {
+
+    std::cout << "\ncompressECL needs two arguments, the binary input file and the binary output file. By default large numeric arrays of the output file "
+              << "are stored in compressed blocks. Such files can be read by OPM, but not by other applications. Both compressed and standard input files "
+              << "are accepted.  Arrays of unified restart files which are stored relative to earlier report steps are always written in full. \n"
+              << "\nIn addition, the program takes these options (which must be given before the arguments):\n\n"
+              << "-h Print help and exit.\n"
+              << "-u write the standard, uncompressed, layout. \n\n";
+}
+
+int main(int argc, char **argv) {
+
+    int c          = 0;
+    bool compress  = true;
+
+    while ((c = getopt(argc, argv, "hu")) != -1) {
+        switch (c) {
+        case 'h':
+            printHelp();
+            return 0;
+        case 'u':
+            compress = false;
+            break;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    int argOffset = optind;
+
+    if (argc - argOffset != 2) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    auto start = std::chrono::system_clock::now();
+
+    std::string inputFile = argv[argOffset];
+    std::string outputFile = argv[argOffset + 1];
+
+    std::unique_ptr<EclFile> input(new EclFile(inputFile));
+
+    // Arrays of unified restart files may refer to earlier report steps,
+    // which only ERst resolves.
+    if (input->hasKey("SEQNUM")) {
+        input.reset(new ERst(inputFile));
+    }
+
+    EclFile& file1 = *input;
+
+    if (file1.formattedInput()) {
+        std::cout << "\n!ERROR, formatted files can not be compressed, use convertECL to convert " << inputFile << " to a binary file first\n" << std::endl;
+        exit(1);
+    }
+
+    std::cout << "\033[1;31m" << "\n" << (compress ? "compressing  " : "uncompressing  ")
+              << inputFile << " -> " << outputFile << "\033[0m\n" << std::endl;
+
+    {
+        EclOutput outFile(outputFile, false);
+        outFile.compressArrays(compress);
+
+        auto arrayList = file1.getList();
+
+        // Only one array at a time is kept in memory.
+        for (size_t index = 0; index < arrayList.size(); index++) {
+            std::string name = std::get<0>(arrayList[index]);
+            eclArrType arrType = std::get<1>(arrayList[index]);
+
+            writeArray(name, arrType, file1, index, outFile);
+
+            file1.clearData();
+        }
+    }
+
+    auto end = std::chrono::system_clock::now();
+    std::chrono::duration<double> elapsed_seconds = end - start;
+
+    std::cout << "time to convert file : " << elapsed_seconds.count() << " seconds\n" << std::endl;
+
+    return 0;
+}
@@ -323,6 +323,7 @@ BOOST_AUTO_TEST_CASE(GetSIWithoutDimensionThrows) {
 
     BOOST_CHECK_THROW( item.getSIDouble(0) , std::invalid_argument );
     BOOST_CHECK_THROW( item.getSIDoubleData() , std::invalid_argument );
+    BOOST_CHECK_THROW( item.getSIDoubleDataCopy() , std::invalid_argument );
 }
 
 BOOST_AUTO_TEST_CASE(GetSISingleDimensionCorrect) {
@@ -368,6 +369,16 @@ BOOST_AUTO_TEST_CASE(GetSIMultipleDim) {
         BOOST_CHECK_EQUAL( 8   , item.getSIDouble(i+2) );
         BOOST_CHECK_EQUAL(16   , item.getSIDouble(i+3) );
     }
+
+    const auto copy = item.getSIDoubleDataCopy();
+    BOOST_CHECK_EQUAL( copy.size() , 16U );
+    for (size_t i=0; i < 16; i++)
+        BOOST_CHECK_EQUAL( copy[i] , item.getSIDouble(i) );
+
+    const auto& data = item.getSIDoubleData();
+    BOOST_CHECK( copy == data );
+    BOOST_CHECK( item.getSIDoubleDataCopy() == data );
+    BOOST_CHECK_THROW( item.getSIDouble(16) , std::out_of_range );
 }
 
 BOOST_AUTO_TEST_CASE(HasValue) {
@@ -455,6 +466,32 @@ BOOST_AUTO_TEST_CASE(DefaultAppliedInt) {
 }
 
 
+BOOST_AUTO_TEST_CASE(DefaultAppliedManyValues) {
+    DeckItem item1( "TEST", int() );
+    DeckItem item2( "TEST", int() );
+
+    item1.push_back( 1 , 60 );
+    for (size_t i = 0; i < 10; i++)
+        item1.push_backDefault( 2 );
+    item1.push_back( 3 , 100 );
+
+    BOOST_CHECK_EQUAL( 170U , item1.size() );
+    for (size_t i = 0; i < item1.size(); i++)
+        BOOST_CHECK_EQUAL( i >= 60 && i < 70 , item1.defaultApplied(i) );
+    BOOST_CHECK_THROW( item1.defaultApplied(170) , std::out_of_range );
+
+    item2.push_back( 1 , 60 );
+    for (size_t i = 0; i < 10; i++)
+        item2.push_backDefault( 2 );
+    item2.push_back( 3 , 99 );
+    BOOST_CHECK( item1 != item2 );
+
+    item2.push_back( 3 );
+    BOOST_CHECK( item1 == item2 );
+    BOOST_CHECK_EQUAL( &item1.name() , &item2.name() );
+}
+
+
 BOOST_AUTO_TEST_CASE(PushBackMultipleInt) {
     DeckItem item( "HEI", int() );
     item.push_back(10 , 100U );
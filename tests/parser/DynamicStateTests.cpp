@@ -271,7 +271,7 @@ BOOST_AUTO_TEST_CASE( update_elm ) {
     BOOST_CHECK_EQUAL( state[3],88 );
     BOOST_CHECK_EQUAL( state[4],137 );
 
-    for (auto& v : state)
+    for (auto& v : state.change_points())
         v += 2;
 
     BOOST_CHECK_EQUAL( state[2],139 );
@@ -334,3 +334,46 @@ BOOST_AUTO_TEST_CASE( UNIQUE ) {
     BOOST_CHECK(unique1[2] == std::make_pair(std::size_t{6}, 600));
 }
 
+
+
+BOOST_AUTO_TEST_CASE( CHANGE_POINTS ) {
+    const std::time_t startDate = Opm::TimeMap::mkdate(2010, 1, 1);
+    Opm::TimeMap timeMap{ startDate };
+    for (size_t i = 0; i < 10; i++)
+        timeMap.addTStep((i+1) * 24 * 60 * 60);
+
+    Opm::DynamicState<int> state(timeMap , 0);
+    BOOST_CHECK_EQUAL(state.size(), 11);
+    BOOST_CHECK_THROW(state.get(11), std::out_of_range);
+
+    state.update(2, 20);
+    state.update(5, 50);
+    state.update(8, 80);
+
+    // An update truncates all later changes.
+    BOOST_CHECK(state.update(4, 40));
+    BOOST_CHECK_EQUAL(state[3], 20);
+    BOOST_CHECK_EQUAL(state[4], 40);
+    BOOST_CHECK_EQUAL(state[10], 40);
+    BOOST_CHECK_EQUAL(state.unique().size(), 3);
+
+    // update_elm() splits an interval, and unique() merges equal neighbours.
+    state.update_elm(3, 99);
+    BOOST_CHECK_EQUAL(state[2], 20);
+    BOOST_CHECK_EQUAL(state[3], 99);
+    BOOST_CHECK_EQUAL(state[4], 40);
+    BOOST_CHECK_EQUAL(state.unique().size(), 4);
+
+    state.update_elm(3, 20);
+    auto unique = state.unique();
+    BOOST_CHECK_EQUAL(unique.size(), 3);
+    BOOST_CHECK(unique[1] == std::make_pair(std::size_t{2}, 20));
+    BOOST_CHECK(unique[2] == std::make_pair(std::size_t{4}, 40));
+
+    BOOST_CHECK_EQUAL(state.find(40), 4);
+    BOOST_CHECK_EQUAL(state.find_not(0), 2);
+
+    state.update_elm(10, 100);
+    BOOST_CHECK_EQUAL(state[9], 40);
+    BOOST_CHECK_EQUAL(state.back(), 100);
+}
@@ -0,0 +1,113 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fnmatch.h>
+
+#include <string>
+#include <vector>
+
+#define BOOST_TEST_MODULE NAME_PATTERN_TEST
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/parser/eclipse/EclipseState/Schedule/NamePattern.hpp>
+
+using namespace Opm;
+
+BOOST_AUTO_TEST_CASE(MatchSameAsFnmatch) {
+    const std::vector<std::string> names = {"PROD1", "PROD10", "PROD2", "INJ1", "OP_1", "OP_A", "P", "", "PROD_A", "XPROD"};
+    const std::vector<std::string> patterns = {"PROD1", "*", "PROD*", "*1", "*_A", "OP_?", "P*D1*", "[IO]*", "P*", "PROD\\1", "*PROD*", "?"};
+
+    for (const auto& pattern_string : patterns) {
+        const NamePattern pattern(pattern_string);
+        for (const auto& name : names)
+            BOOST_CHECK_MESSAGE(pattern.match(name) == (fnmatch(pattern_string.c_str(), name.c_str(), 0) == 0),
+                                "Pattern: " << pattern_string << " name: " << name);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(PatternProperties) {
+    NamePattern literal("PROD1");
+    BOOST_CHECK(literal.literal());
+    BOOST_CHECK(!literal.all());
+    BOOST_CHECK_EQUAL(literal.prefix(), "PROD1");
+
+    NamePattern all("*");
+    BOOST_CHECK(all.all());
+    BOOST_CHECK_EQUAL(all.prefix(), "");
+
+    NamePattern general("PR?D*");
+    BOOST_CHECK(!general.literal());
+    BOOST_CHECK_EQUAL(general.prefix(), "PR");
+    BOOST_CHECK_EQUAL(general.pattern(), "PR?D*");
+}
+
+
+BOOST_AUTO_TEST_CASE(NameIndexMatch) {
+    NameIndex index;
+    for (const auto& name : {"PROD2", "INJ1", "PROD1", "OP_1", "PROD10", "PRODX"})
+        index.add(name);
+
+    /* Adding an existing name again is a no-op. */
+    index.add("INJ1");
+    BOOST_CHECK_EQUAL(index.size(), 6);
+
+    BOOST_CHECK(index.match(NamePattern("PROD*")) == std::vector<std::size_t>({0, 2, 4, 5}));
+    BOOST_CHECK(index.match(NamePattern("PROD1*")) == std::vector<std::size_t>({2, 4}));
+    BOOST_CHECK(index.match(NamePattern("*1")) == std::vector<std::size_t>({1, 2, 3}));
+    BOOST_CHECK(index.match(NamePattern("PROD?")) == std::vector<std::size_t>({0, 2, 5}));
+    BOOST_CHECK(index.match(NamePattern("*")) == std::vector<std::size_t>({0, 1, 2, 3, 4, 5}));
+    BOOST_CHECK(index.match(NamePattern("INJ1")) == std::vector<std::size_t>({1}));
+    BOOST_CHECK(index.match(NamePattern("INJ2")).empty());
+    BOOST_CHECK(index.match(NamePattern("Q*")).empty());
+}
+
+
+BOOST_AUTO_TEST_CASE(NameIndexCacheSharing) {
+    NameIndexCache cache;
+    std::size_t calls = 0;
+    const auto names = [&calls](const std::vector<std::string>& step_names) {
+        return [&calls, step_names]() { calls += 1; return step_names; };
+    };
+
+    const auto step0 = cache.get(0, names({"PROD1", "INJ1"}));
+    const auto step1 = cache.get(1, names({"PROD1", "INJ1"}));
+    const auto step3 = cache.get(3, names({"PROD1", "INJ1", "PROD2"}));
+    BOOST_CHECK_EQUAL(calls, 3);
+    BOOST_CHECK_EQUAL(step0.get(), step1.get());
+    BOOST_CHECK(step1.get() != step3.get());
+    BOOST_CHECK(step3->index.match(NamePattern("PROD*")) == std::vector<std::size_t>({0, 2}));
+    BOOST_CHECK_EQUAL(step3->names[2], "PROD2");
+
+    /* Cached steps do not call make_names(). */
+    BOOST_CHECK_EQUAL(cache.get(1, names({})).get(), step1.get());
+    BOOST_CHECK_EQUAL(calls, 3);
+
+    const NameIndexCache copy(cache);
+    BOOST_CHECK(copy.get(1, names({})).get() != step1.get());
+    BOOST_CHECK_EQUAL(calls, 4);
+
+    cache.clear();
+    BOOST_CHECK(cache.get(0, names({"PROD1"}))->names == std::vector<std::string>({"PROD1"}));
+    BOOST_CHECK_EQUAL(calls, 5);
+
+    /* Entries returned before clear() stay valid. */
+    BOOST_CHECK_EQUAL(step3->names.size(), 3);
+}
@@ -471,6 +471,78 @@ BOOST_AUTO_TEST_CASE(GroupTree2TEST) {
 }
 
 
+BOOST_AUTO_TEST_CASE(GroupTopologyTEST) {
+    Opm::Parser parser;
+    std::string input =
+            "START             -- 0 \n"
+            "10 MAI 2007 / \n"
+            "SCHEDULE\n"
+            "GRUPTREE\n"
+            "  PG1 PLATFORM /\n"
+            "  PG2 PLATFORM /\n"
+            "  CG1  PG1 /\n"
+            "  CG2  PG2 /\n"
+            "/\n"
+            "WELSPECS\n"
+            "     \'DW_0\'        \'CG1\'   30   37  3.33       \'OIL\'  7* /   \n"
+            "     \'CW_1\'        \'CG1\'   30   37  3.33       \'OIL\'  7* /   \n"
+            "     \'BW_2\'        \'CG2\'   30   37  3.33       \'OIL\'  7* /   \n"
+            "/\n"
+            "TSTEP\n"
+            "10 /\n"
+            "WCONPROD\n"
+            "     \'DW_0\' \'OPEN\' \'ORAT\' 20000  4* 1000 /\n"
+            "/\n"
+            "TSTEP\n"
+            "10 /\n"
+            "GEFAC\n"
+            "     \'PG1\' 0.50 /\n"
+            "/\n"
+            "WEFAC\n"
+            "     \'DW_0\' 0.80 /\n"
+            "/\n"
+            "TSTEP\n"
+            "10 /\n";
+
+    auto deck = parser.parseString(input);
+    EclipseGrid grid(100,100,100);
+    TableManager table ( deck );
+    Eclipse3DProperties eclipseProperties ( deck , table, grid);
+    Runspec runspec (deck);
+    Schedule schedule(deck, grid , eclipseProperties, runspec);
+
+    const auto& gt0 = schedule.groupTopology(0);
+    BOOST_CHECK_EQUAL(gt0.numGroups(), 6U);
+    BOOST_CHECK_EQUAL(gt0.numWells(), 3U);
+    BOOST_CHECK_EQUAL(gt0.groupName(gt0.root()), "FIELD");
+    BOOST_CHECK_EQUAL(gt0.parent(gt0.root()), GroupTopology::npos);
+
+    const auto cg1 = gt0.groupIndex("CG1");
+    const auto pg1 = gt0.groupIndex("PG1");
+    BOOST_CHECK_EQUAL(gt0.level(cg1), 3U);
+    BOOST_CHECK_EQUAL(gt0.parent(cg1), pg1);
+    BOOST_CHECK_EQUAL(gt0.groupName(gt0.parent(pg1)), "PLATFORM");
+    BOOST_CHECK_EQUAL(gt0.childWells(cg1).size(), 2U);
+    BOOST_CHECK_EQUAL(gt0.wellGroup(gt0.wellIndex("DW_0")), cg1);
+    BOOST_CHECK_EQUAL(gt0.maxGroupSize(), 2U);
+    BOOST_CHECK_THROW(gt0.groupIndex("NO_SUCH_GROUP"), std::invalid_argument);
+
+    // A new rate target does not change the topology.
+    BOOST_CHECK(std::addressof(schedule.groupTopology(1)) == std::addressof(gt0));
+
+    const auto& gt2 = schedule.groupTopology(2);
+    BOOST_CHECK(std::addressof(gt2) != std::addressof(gt0));
+    BOOST_CHECK(std::addressof(schedule.groupTopology(3)) == std::addressof(gt2));
+
+    const auto dw0 = gt2.wellIndex("DW_0");
+    const auto bw2 = gt2.wellIndex("BW_2");
+    BOOST_CHECK_CLOSE(gt2.cumulativeEfficiencyFactor(dw0), 0.40, 1e-8);
+    BOOST_CHECK_CLOSE(gt2.cumulativeEfficiencyFactor(dw0, gt2.groupIndex("PG1")), 0.80, 1e-8);
+    BOOST_CHECK_CLOSE(gt2.cumulativeEfficiencyFactor(bw2), 1.0, 1e-8);
+    BOOST_CHECK_CLOSE(gt0.cumulativeEfficiencyFactor(gt0.wellIndex("DW_0")), 1.0, 1e-8);
+}
+
+
 
 BOOST_AUTO_TEST_CASE(CreateScheduleDeckWithStart) {
     auto deck = createDeck();
@@ -85,3 +85,28 @@ BOOST_AUTO_TEST_CASE( CreateTest ) {
     }
 }
 
+
+
+BOOST_AUTO_TEST_CASE( EvaluateBatch ) {
+    TableSchema schema;
+
+    schema.addColumn( ColumnSchema("DEPTH" , Table::STRICTLY_INCREASING , Table::DEFAULT_NONE) );
+    schema.addColumn( ColumnSchema("VALUE" , Table::RANDOM , Table::DEFAULT_NONE) );
+
+    SimpleTable table(schema);
+    table.addRow( {1000 , 1.0} );
+    table.addRow( {1100 , 3.0} );
+    table.addRow( {1250 , 2.0} );
+    table.addRow( {1300 , 2.5} );
+
+    const std::vector<double> depths = { 900 , 1000 , 1050 , 1120 , 1250 , 1400 , 1010 , 1275 };
+    const auto values = table.evaluate( "VALUE" , depths );
+
+    BOOST_REQUIRE_EQUAL( values.size() , depths.size() );
+    for (size_t i = 0; i < depths.size(); ++i)
+        BOOST_CHECK_EQUAL( values[i] , table.evaluate( "VALUE" , depths[i] ));
+
+    BOOST_CHECK_EQUAL( values[0] , 1.0 );
+    BOOST_CHECK_EQUAL( values[2] , 2.0 );
+    BOOST_CHECK_EQUAL( values[5] , 2.5 );
+}
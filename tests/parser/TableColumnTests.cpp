@@ -21,6 +21,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <vector>
+
 
 #include <opm/parser/eclipse/EclipseState/Tables/TableIndex.hpp>
 #include <opm/parser/eclipse/EclipseState/Tables/TableColumn.hpp>
@@ -322,3 +324,76 @@ BOOST_AUTO_TEST_CASE( Test_LINEAR_DEFAULT ) {
     BOOST_CHECK_CLOSE( valueColumn[3] , 1.00 , 1e-6);
     BOOST_CHECK_CLOSE( valueColumn[5] , 0.25 , 1e-6);
 }
+
+
+BOOST_AUTO_TEST_CASE( Test_LOOKUP_HINT ) {
+    ColumnSchema incSchema("COLUMN" , Table::INCREASING , Table::DEFAULT_NONE);
+    ColumnSchema decSchema("COLUMN" , Table::DECREASING , Table::DEFAULT_NONE);
+    TableColumn inc( incSchema );
+    TableColumn dec( decSchema );
+
+    for (double v : { 0.0 , 1.0 , 1.0 , 2.5 , 4.0 , 7.0 })
+        inc.addValue( v );
+
+    for (double v : { 7.0 , 4.0 , 2.5 , 1.0 , 1.0 , 0.0 })
+        dec.addValue( v );
+
+    std::vector<double> args;
+    for (int i = -2; i <= 16; ++i)
+        args.push_back( 0.5 * i );
+    args.push_back( 3.0 );
+    args.push_back( 0.25 );
+    args.push_back( 6.5 );
+
+    for (const auto* column : { &inc , &dec }) {
+        const auto batch = column->lookup( args );
+        BOOST_REQUIRE_EQUAL( batch.size() , args.size() );
+
+        for (size_t i = 0; i < args.size(); ++i) {
+            const auto index = column->lookup( args[i] );
+            BOOST_CHECK_EQUAL( batch[i].getIndex1() , index.getIndex1() );
+            BOOST_CHECK_EQUAL( batch[i].getWeight1() , index.getWeight1() );
+
+            for (size_t hint : { size_t(0) , size_t(2) , size_t(4) , size_t(5) , size_t(100) }) {
+                const auto hinted = column->lookup( args[i] , hint );
+                BOOST_CHECK_EQUAL( hinted.getIndex1() , index.getIndex1() );
+                BOOST_CHECK_EQUAL( hinted.getWeight1() , index.getWeight1() );
+            }
+        }
+
+        const auto values = column->eval( batch );
+        BOOST_REQUIRE_EQUAL( values.size() , args.size() );
+        for (size_t i = 0; i < args.size(); ++i)
+            BOOST_CHECK_EQUAL( values[i] , column->eval( column->lookup( args[i] )));
+    }
+
+    BOOST_CHECK( inc.lookup( std::vector<double>{} ).empty() );
+}
+
+
+BOOST_AUTO_TEST_CASE( Test_MIN_MAX_UPDATE ) {
+    ColumnSchema schema("COLUMN" , Table::RANDOM , Table::DEFAULT_LINEAR);
+    TableColumn column( schema );
+
+    column.addValue( 5 );
+    column.addValue( 1 );
+    column.addValue( 9 );
+    column.addValue( 1 );
+
+    column.updateValue( 2 , 3 );
+    BOOST_CHECK_EQUAL( 1 , column.min() );
+    BOOST_CHECK_EQUAL( 5 , column.max() );
+
+    column.updateValue( 1 , 7 );
+    BOOST_CHECK_EQUAL( 1 , column.min() );
+    BOOST_CHECK_EQUAL( 7 , column.max() );
+
+    column.updateValue( 3 , 4 );
+    BOOST_CHECK_EQUAL( 3 , column.min() );
+    BOOST_CHECK_EQUAL( 7 , column.max() );
+
+    TableColumn copy( schema );
+    copy = column;
+    BOOST_CHECK_EQUAL( 3 , copy.min() );
+    BOOST_CHECK_EQUAL( 7 , copy.max() );
+}
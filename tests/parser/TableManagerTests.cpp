@@ -50,6 +50,8 @@
 
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
 
+#include <cmath>
+#include <sstream>
 #include <stdexcept>
 #include <iostream>
 
@@ -276,6 +278,85 @@ BOOST_AUTO_TEST_CASE(SwofTable_Tests) {
     BOOST_CHECK_EQUAL(swof2Table.getSwColumn().back(), 17.0);
 }
 
+BOOST_AUTO_TEST_CASE(ResampledColumn_Tests) {
+    const char *deckData =
+        "TABDIMS\n"
+        "1 /\n"
+        "\n"
+        "SWOF\n"
+        " 0.12   0       1.0     0\n"
+        " 0.18   0.001   0.9     0\n"
+        " 0.3    0.05    0.55    0\n"
+        " 0.7    0.4     0.01    0\n"
+        " 1.0    1.0     0       0 /\n";
+
+    Opm::Parser parser;
+    auto deck = parser.parseString(deckData);
+    Opm::TableManager tables(deck);
+    const auto& swof = tables.getSwofTables().getTable<Opm::SwofTable>(0);
+
+    const auto krw = tables.getResampledColumn("SWOF", 0, "KRW", 1.0e-4);
+    BOOST_CHECK( krw.error().withinTolerance );
+    BOOST_CHECK( krw.error().maxError <= 1.0e-4 );
+    BOOST_CHECK( krw.error().numSamples > swof.numRows() );
+
+    for (int i = -10; i <= 110; ++i) {
+        const double sw = 0.01 * i;
+        BOOST_CHECK_SMALL( krw.evaluate(sw) - swof.evaluate("KRW", sw), 1.0e-4 );
+    }
+    BOOST_CHECK_EQUAL( krw(0.0), 0.0 );
+    BOOST_CHECK_EQUAL( krw(1.5), 1.0 );
+
+    const auto krow = Opm::ResampledColumn(swof, "KROW", 1.0e-8, 100);
+    BOOST_CHECK( !krow.error().withinTolerance );
+    BOOST_CHECK( krow.error().numSamples <= 100 );
+    BOOST_CHECK( krow.error().maxError > 1.0e-8 );
+    BOOST_CHECK_CLOSE( std::fabs(krow(krow.error().maxErrorArgument) - swof.evaluate("KROW", krow.error().maxErrorArgument)),
+                       krow.error().maxError, epsilon() );
+
+    BOOST_CHECK_THROW( tables.getResampledColumn("SWOF", 0, "NO_SUCH_COLUMN", 1.0e-6), std::invalid_argument );
+}
+
+namespace {
+
+    std::string manySwofTables(size_t numTables, size_t badTable) {
+        std::ostringstream deck;
+        deck << "TABDIMS\n" << numTables << " /\n\nSWOF\n";
+        for (size_t tableIdx = 0; tableIdx < numTables; ++tableIdx) {
+            if (tableIdx == 7) {
+                deck << "/\n";
+                continue;
+            }
+
+            const double sw = (tableIdx == badTable) ? 0.05 : 0.5 + 0.001*tableIdx;
+            deck << " 0.1 0.0 1.0 0.0\n"
+                 << " " << sw << " 0.5 0.5 0.0\n"
+                 << " 0.9 1.0 0.0 0.0 /\n";
+        }
+        return deck.str();
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE(ManySaturationTables) {
+    const size_t numTables = 100;
+
+    Opm::Parser parser;
+    const Opm::TableManager tables( parser.parseString( manySwofTables( numTables, numTables )));
+    const auto& swofTables = tables.getSwofTables();
+
+    BOOST_CHECK_EQUAL( swofTables.size(), numTables - 1 );
+    for (size_t tableIdx = 0; tableIdx < numTables; ++tableIdx) {
+        const auto& swof = swofTables.getTable<Opm::SwofTable>(tableIdx);
+        const size_t expected = (tableIdx == 7) ? 6 : tableIdx;
+
+        BOOST_CHECK_EQUAL( swof.numRows(), 3 );
+        BOOST_CHECK_CLOSE( swof.getSwColumn()[1], 0.5 + 0.001*expected, 1e-12 );
+    }
+
+    BOOST_CHECK_THROW( Opm::TableManager( parser.parseString( manySwofTables( numTables, 60 ))), std::invalid_argument );
+}
+
 BOOST_AUTO_TEST_CASE(PbvdTable_Tests) {
     const char *deckData =
         "EQLDIMS\n"
@@ -63,6 +63,32 @@ BOOST_AUTO_TEST_CASE(MIX_SCALAR) {
 }
 
 
+BOOST_AUTO_TEST_CASE(UDQ_NESTED_EXPRESSION) {
+    UDQParams udqp;
+    UDQFunctionTable udqft(udqp);
+    UDQDefine def(udqp, "WUX", {"(", "WOPR", "'P*'", "+", "ABS", "(", "WWPR", ")", ")", "*", "3", "/", "2"});
+    SummaryState st;
+    UDQContext context(udqp, udqft, st);
+
+    st.update_well_var("P1", "WOPR", 1);
+    st.update_well_var("P2", "WOPR", 2);
+    st.update_well_var("I1", "WOPR", 3);
+    st.update_well_var("P1", "WWPR", -1);
+    st.update_well_var("P2", "WWPR", 2);
+    st.update_well_var("I1", "WWPR", 1);
+
+    // The compiled expression is evaluated repeatedly with updated summary values.
+    for (double scale : {1.0, 2.0}) {
+        st.update_well_var("P1", "WOPR", scale);
+        auto res = def.eval(context);
+        BOOST_CHECK_EQUAL( res.size(), 3);
+        BOOST_CHECK_CLOSE( res["P1"].value(), (scale + 1) * 3 / 2, 1e-12);
+        BOOST_CHECK_CLOSE( res["P2"].value(), (2 + 2) * 3.0 / 2, 1e-12);
+        BOOST_CHECK( !res["I1"].defined() );
+    }
+}
+
+
 BOOST_AUTO_TEST_CASE(UDQ_TABLE_EXCEPTION) {
     UDQParams udqp;
     BOOST_CHECK_THROW(UDQDefine(udqp, "WU", {"TUPRICE[WOPR]"}), std::invalid_argument);
@@ -1228,3 +1254,83 @@ UDQ
     BOOST_CHECK_EQUAL(def_input[2].first, 4);
 }
 
+
+
+BOOST_AUTO_TEST_CASE(UDQ_EVAL_ORDER) {
+    std::string deck_string = R"(
+SCHEDULE
+
+UDQ
+    DEFINE WUX WUY * 2 /
+    DEFINE FUCNT FUCNT + 1 /
+    DEFINE WUY WOPR + WUZ /
+    ASSIGN WUZ 10 /
+    DEFINE FUSUM SUM(WUX) /
+/
+
+UDQ
+    DEFINE WUA WUB + 1 /
+    DEFINE WUB WUA + 1 /
+/
+)";
+    auto schedule = make_schedule(deck_string);
+    {
+        const auto& udq = schedule.getUDQConfig(0);
+        const auto& def = udq.definitions();
+        const auto& order = udq.eval_order();
+        const auto& well_order = udq.eval_order(UDQVarType::WELL_VAR);
+        BOOST_CHECK_EQUAL(order.size(), def.size());
+
+        BOOST_CHECK_EQUAL(order[0].keyword(), "FUCNT");
+        BOOST_CHECK_EQUAL(order[1].keyword(), "WUY");
+        BOOST_CHECK_EQUAL(order[2].keyword(), "WUX");
+        BOOST_CHECK_EQUAL(order[3].keyword(), "FUSUM");
+        BOOST_CHECK_EQUAL(order[4].keyword(), "WUA");
+        BOOST_CHECK_EQUAL(order[5].keyword(), "WUB");
+
+        BOOST_CHECK_EQUAL(well_order.size(), 4);
+        BOOST_CHECK_EQUAL(well_order[0].keyword(), "WUY");
+        BOOST_CHECK_EQUAL(well_order[1].keyword(), "WUX");
+
+        const std::vector<std::string> cyclic = {"WUA", "WUB"};
+        BOOST_CHECK( udq.cyclic_definitions() == cyclic );
+    }
+
+    UDQParams udqp;
+    UDQFunctionTable udqft(udqp);
+    SummaryState st;
+    UDQContext context(udqp, udqft, st);
+    st.update_well_var("P1", "WOPR", 1);
+    st.update_well_var("P1", "WUZ", 10);
+    const auto& def = UDQDefine(udqp, "WUY", {"WOPR", "+", "WUZ"});
+    const std::vector<std::string> inputs = {"WOPR", "WUZ"};
+    BOOST_CHECK( def.input_variables() == inputs );
+    BOOST_CHECK_EQUAL( def.eval(context)["P1"].value(), 11 );
+}
+
+
+BOOST_AUTO_TEST_CASE(UDQ_EVAL_ORDER_CYCLE) {
+    std::string deck_string = R"(
+SCHEDULE
+
+UDQ
+    DEFINE WUA WUB + 1 /
+    DEFINE WUB WUC + 1 /
+    DEFINE WUC WUD + 1 /
+    DEFINE WUD WUB + 1 /
+    DEFINE WUE WOPR + 1 /
+/
+)";
+    auto schedule = make_schedule(deck_string);
+    const auto& udq = schedule.getUDQConfig(0);
+    const auto& order = udq.eval_order();
+    BOOST_CHECK_EQUAL(order.size(), 5);
+    BOOST_CHECK_EQUAL(order[0].keyword(), "WUE");
+    BOOST_CHECK_EQUAL(order[1].keyword(), "WUB");
+    BOOST_CHECK_EQUAL(order[2].keyword(), "WUA");
+    BOOST_CHECK_EQUAL(order[3].keyword(), "WUD");
+    BOOST_CHECK_EQUAL(order[4].keyword(), "WUC");
+
+    const std::vector<std::string> cyclic = {"WUB", "WUC", "WUD"};
+    BOOST_CHECK( udq.cyclic_definitions() == cyclic );
+}
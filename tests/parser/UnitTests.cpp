@@ -95,6 +95,36 @@ BOOST_AUTO_TEST_CASE(UnitSystemFromECL_TYPE) {
 }
 
 
+BOOST_AUTO_TEST_CASE(UnitSystemDimensionHandle) {
+    const auto handle = UnitSystem::dimensionHandle( "Length*Length/Time" );
+    BOOST_CHECK_EQUAL( handle , UnitSystem::dimensionHandle( "Length*Length/Time" ));
+    BOOST_CHECK( handle != UnitSystem::dimensionHandle( "Length/Time" ));
+
+    UnitSystem system(UnitSystem::UnitType::UNIT_TYPE_FIELD);
+    BOOST_CHECK( system.getNewDimension( handle ) == system.getNewDimension( "Length*Length/Time" ));
+    BOOST_CHECK( system.hasDimension("Length*Length/Time"));
+
+    system.addDimension("Length" , 10 );
+    system.addDimension("Time" , 100);
+    BOOST_CHECK( system.getNewDimension( UnitSystem::dimensionHandle( "Length" )) == system.getDimension( "Length" ));
+    BOOST_CHECK_CLOSE( 0.1 , system.getNewDimension( UnitSystem::dimensionHandle( "Length/Time" )).getSIScaling() , 1e-12 );
+}
+
+
+BOOST_AUTO_TEST_CASE(UnitSystemDimensionHandleReference) {
+    UnitSystem system(UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    const auto& length = system.getNewDimension( UnitSystem::dimensionHandle( "Length" ));
+
+    // Looking up new handles grows the cache and adds dimensions.
+    std::string dimension = "Length";
+    for (int i = 0; i < 100; i++) {
+        dimension += "*Length";
+        system.getNewDimension( UnitSystem::dimensionHandle( dimension ));
+    }
+
+    BOOST_CHECK( &length == &system.getDimension( "Length" ));
+    BOOST_CHECK_EQUAL( length.getSIScaling() , 1.0 );
+}
 
 
 BOOST_AUTO_TEST_CASE(UnitSystemAddDimensions) {
@@ -263,6 +293,30 @@ BOOST_AUTO_TEST_CASE( VectorConvert ) {
         BOOST_CHECK_EQUAL( units.from_si( UnitSystem::measure::pressure , d1[i] ) , d0[i]);
 }
 
+BOOST_AUTO_TEST_CASE( ArrayConvert ) {
+    // Large enough to be converted in parallel.
+    std::vector<double> si( 100000 );
+    for (size_t i = 0; i < si.size(); i++)
+        si[i] = 1.0e5 + 17.0*i;
+
+    UnitSystem units = UnitSystem::newFIELD();
+    const auto m = UnitSystem::measure::temperature;
+
+    std::vector<double> d( si.size() );
+    std::vector<float>  f( si.size() );
+    units.from_si( m , si.data() , d.data() , si.size() );
+    units.from_si( m , si.data() , f.data() , si.size() );
+
+    for (size_t i = 0; i < si.size(); i++) {
+        BOOST_CHECK_EQUAL( units.from_si( m , si[i] ) , d[i] );
+        BOOST_CHECK_EQUAL( static_cast<float>( d[i] ) , f[i] );
+    }
+
+    units.to_si( m , d.data() , d.data() , d.size() );
+    for (size_t i = 0; i < si.size(); i++)
+        BOOST_CHECK_CLOSE( si[i] , d[i] , 1.0e-10 );
+}
+
 BOOST_AUTO_TEST_CASE( GasOilRatioNotIdentityForField ) {
     const double gas = 14233.4;
     const double oil = 4223;
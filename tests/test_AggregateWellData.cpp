@@ -23,6 +23,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/output/eclipse/AggregateWellData.hpp>
+#include <opm/output/eclipse/StaticWellCache.hpp>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp>
 #include <opm/output/eclipse/VectorItems/intehead.hpp>
@@ -523,6 +524,78 @@ BOOST_AUTO_TEST_CASE (Declared_Well_Data)
 
 // --------------------------------------------------------------------
 
+BOOST_AUTO_TEST_CASE (Declared_Well_Data_Cached)
+{
+    const auto simCase = SimulationCase{first_sim()};
+    const auto smry    = sim_state();
+    const auto& units  = simCase.es.getUnits();
+
+    auto cache = Opm::RestartIO::Helpers::StaticWellCache{};
+
+    // Report Step 1: OP_1 and OP_2 stored in cache.
+    {
+        const auto ih = MockIH {
+            static_cast<int>(simCase.sched.getWells2(1).size())
+        };
+
+        auto awd = Opm::RestartIO::Helpers::AggregateWellData{ih.value};
+        awd.captureDeclaredWellData(simCase.sched, units, 1, smry, ih.value, &cache);
+    }
+
+    // Report Step 2: OP_1 unchanged, OP_2 switched to water injection and
+    // OP_3 introduced.
+    const auto wells = simCase.sched.getSharedWells2(2);
+    BOOST_CHECK_EQUAL(wells.size(), std::size_t{3});
+
+    const auto ih = MockIH{ static_cast<int>(wells.size()) };
+
+    auto expect = Opm::RestartIO::Helpers::AggregateWellData{ih.value};
+    expect.captureDeclaredWellData(simCase.sched, units, 2, smry, ih.value);
+
+    auto cached = [&cache, &expect, &ih, &wells](const std::size_t wellID) -> bool
+    {
+        using Ix = ::Opm::RestartIO::Helpers::VectorItems::IWell::index;
+
+        const auto group = expect.getIWell()[wellID*ih.niwelz + Ix::Group];
+
+        return cache.wellData(wells[wellID], 0, group) != nullptr;
+    };
+
+    BOOST_CHECK(  cached(0));
+    BOOST_CHECK(! cached(1));
+    BOOST_CHECK(! cached(2));
+
+    auto awd = Opm::RestartIO::Helpers::AggregateWellData{ih.value};
+    awd.captureDeclaredWellData(simCase.sched, units, 2, smry, ih.value, &cache);
+
+    BOOST_CHECK( awd.getIWell() == expect.getIWell() );
+    BOOST_CHECK( awd.getSWell() == expect.getSWell() );
+    BOOST_CHECK( awd.getXWell() == expect.getXWell() );
+
+    for (std::size_t i = 0; i < expect.getZWell().size(); ++i) {
+        BOOST_CHECK_EQUAL(awd.getZWell()[i].c_str(), expect.getZWell()[i].c_str());
+    }
+
+    BOOST_CHECK( cached(1) );
+    BOOST_CHECK( cached(2) );
+
+    // Report Step 1 again: OP_3 is not part of the report step and its
+    // entry is dropped.
+    {
+        const auto ih1 = MockIH {
+            static_cast<int>(simCase.sched.getWells2(1).size())
+        };
+
+        auto awd1 = Opm::RestartIO::Helpers::AggregateWellData{ih1.value};
+        awd1.captureDeclaredWellData(simCase.sched, units, 1, smry, ih1.value, &cache);
+    }
+
+    BOOST_CHECK_EQUAL(cache.numWellData(), std::size_t{2});
+    BOOST_CHECK(! cached(2));
+}
+
+// --------------------------------------------------------------------
+
 BOOST_AUTO_TEST_CASE (Dynamic_Well_Data_Step1)
 {
     const auto simCase = SimulationCase{first_sim()};
@@ -307,7 +307,27 @@ BOOST_AUTO_TEST_CASE(TestERst_4) {
     
     BOOST_CHECK_EQUAL(pres1==pres2, true);
     BOOST_CHECK_EQUAL(pres1==pres3, true);
-    
+
+}
+
+BOOST_AUTO_TEST_CASE(TestERst_Selective) {
+
+    std::string testFile="SPE1_TESTCASE.UNRST";
+
+    ERst rst1(testFile);
+    rst1.loadReportStepNumber(25);
+
+    ERst rst2(testFile);
+    rst2.loadReportStepNumber(25, {"PRESSURE", "SWAT", "NOSUCH"});
+
+    BOOST_CHECK_THROW(rst2.loadReportStepNumber(4, {"PRESSURE"}), std::invalid_argument);
+
+    BOOST_CHECK_EQUAL(rst1.getRst<float>("PRESSURE", 25) == rst2.getRst<float>("PRESSURE", 25), true);
+    BOOST_CHECK_EQUAL(rst1.getRst<float>("SWAT", 25) == rst2.getRst<float>("SWAT", 25), true);
+
+    // Arrays which were not requested are still loaded on demand.
+    BOOST_CHECK_EQUAL(rst1.getRst<float>("SGAS", 25) == rst2.getRst<float>("SGAS", 25), true);
+    BOOST_CHECK_EQUAL(rst1.getRst<int>("INTEHEAD", 25) == rst2.getRst<int>("INTEHEAD", 25), true);
 }
 
 
@@ -19,6 +19,8 @@
 #include "config.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -306,3 +308,99 @@ BOOST_AUTO_TEST_CASE(TestEcl_getList) {
         std::cout << " > Warning! temporary file was not deleted" << std::endl;
     };
 }
+
+BOOST_AUTO_TEST_CASE(TestEcl_Write_compressed) {
+
+    std::string compressedFile="TEST_COMPRESSED.DAT";
+    std::string standardFile="TEST_STANDARD.DAT";
+    std::string roundTripFile="TEST_ROUNDTRIP.DAT";
+
+    // large numeric arrays are written in compressed blocks, small arrays
+    // and other types in the standard layout. Reading the compressed file
+    // and writing it back uncompressed reproduces the standard file.
+
+    const int n = 3 * 8192 + 17;
+
+    std::vector<int> index(n);
+    std::vector<float> pres(n);
+    std::vector<double> depth(n);
+
+    for (int i = 0; i < n; i++) {
+        index[i] = (i % 100 == 0) ? -i : i;
+        pres[i] = 250.0f + 0.01f * static_cast<float>(i % 1000);
+        depth[i] = (i % 7 == 0) ? 0.0 : 2000.0 + std::sin(0.001 * i);
+    }
+
+    std::vector<int> small { 1, 2, 3 };
+    std::vector<bool> logi { true, false, true };
+
+    auto writeAll = [&](EclOutput& out)
+    {
+        out.write("INDEX", index);
+        out.write("SMALL", small);
+        out.write("PRESSURE", pres);
+        out.write("LOGI", logi);
+        out.write("DEPTH", depth);
+        out.write<float>("SWAT", n, [n](std::size_t begin, std::size_t end, float* block)
+                         {
+                             for (auto i = begin; i < end; i++)
+                                 block[i - begin] = static_cast<float>(i) / n;
+                         });
+        out.write("ENDSOL", std::vector<char>());
+    };
+
+    {
+        EclOutput eclTest(compressedFile, false);
+        eclTest.compressArrays(true);
+        writeAll(eclTest);
+    }
+
+    {
+        EclOutput eclTest(standardFile, false);
+        writeAll(eclTest);
+    }
+
+    {
+        std::ifstream compressed(compressedFile, std::ios::binary | std::ios::ate);
+        std::ifstream standard(standardFile, std::ios::binary | std::ios::ate);
+
+        BOOST_CHECK(compressed.tellg() < standard.tellg());
+    }
+
+    EclFile file1(compressedFile);
+    file1.loadData();
+
+    BOOST_CHECK_EQUAL(file1.get<int>("INDEX") == index, true);
+    BOOST_CHECK_EQUAL(file1.get<int>("SMALL") == small, true);
+    BOOST_CHECK_EQUAL(file1.get<float>("PRESSURE") == pres, true);
+    BOOST_CHECK_EQUAL(file1.get<bool>("LOGI") == logi, true);
+    BOOST_CHECK_EQUAL(file1.get<double>("DEPTH") == depth, true);
+    BOOST_CHECK_EQUAL(file1.get<float>("SWAT").size(), static_cast<std::size_t>(n));
+    BOOST_CHECK_EQUAL(file1.get<float>("SWAT")[n - 1], static_cast<float>(n - 1) / n);
+
+    {
+        EclOutput eclTest(roundTripFile, false);
+
+        auto arrayList = file1.getList();
+        for (std::size_t i = 0; i < arrayList.size(); i++) {
+            const std::string& name = std::get<0>(arrayList[i]);
+
+            switch (std::get<1>(arrayList[i])) {
+            case INTE: eclTest.write(name, file1.get<int>(i)); break;
+            case REAL: eclTest.write(name, file1.get<float>(i)); break;
+            case DOUB: eclTest.write(name, file1.get<double>(i)); break;
+            case LOGI: eclTest.write(name, file1.get<bool>(i)); break;
+            case MESS: eclTest.write(name, std::vector<char>()); break;
+            default: BOOST_FAIL("unexpected array type");
+            }
+        }
+    }
+
+    BOOST_CHECK_EQUAL(compare_files(standardFile, roundTripFile), true);
+
+    for (const auto& file : { compressedFile, standardFile, roundTripFile }) {
+        if (remove(file.c_str())==-1) {
+            std::cout << " > Warning! temporary file was not deleted" << std::endl;
+        };
+    }
+}
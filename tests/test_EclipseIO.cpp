@@ -23,6 +23,7 @@
 
 #include <opm/output/eclipse/EclipseIO.hpp>
 #include <opm/output/data/Cells.hpp>
+#include <opm/io/eclipse/Columnar.hpp>
 
 #include <opm/parser/eclipse/Parser/Parser.hpp>
 #include <opm/parser/eclipse/Deck/Deck.hpp>
@@ -48,6 +49,7 @@
 
 #include <ert/ecl_well/well_info.h>
 
+#include <fstream>
 #include <memory>
 #include <map>
 
@@ -393,5 +395,121 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
     test_work_area_free(work_area);
 }
 
+BOOST_AUTO_TEST_CASE(EclipseIOColumnar) {
+    const char *deckString =
+        "RUNSPEC\n"
+        "OIL\n"
+        "GAS\n"
+        "WATER\n"
+        "METRIC\n"
+        "DIMENS\n"
+        "3 3 3/\n"
+        "GRID\n"
+        "INIT\n"
+        "DXV\n"
+        "1.0 2.0 3.0 /\n"
+        "DYV\n"
+        "4.0 5.0 6.0 /\n"
+        "DZV\n"
+        "7.0 8.0 9.0 /\n"
+        "TOPS\n"
+        "9*100 /\n"
+        "PROPS\n"
+        "PORO\n"
+        "27*0.3 /\n"
+        "PERMX\n"
+        "27*1 /\n"
+        "SOLUTION\n"
+        "RPTRST\n"
+        "BASIC=2\n"
+        "/\n"
+        "SCHEDULE\n"
+        "TSTEP\n"
+        "1.0 2.0 3.0 /\n";
+
+    using measure = UnitSystem::measure;
+    using TargetType = data::TargetType;
+    using OS = EclIO::OutputStream::Columnar;
+
+    test_work_area_type * work_area = test_work_area_alloc("test_ecl_writer_columnar");
+    double tranx_output = 0;
+    {
+        auto deck = Parser().parseString( deckString );
+        auto es = EclipseState( deck );
+        auto& eclGrid = es.getInputGrid();
+        Schedule schedule(deck, eclGrid, es.get3DProperties(), es.runspec());
+        SummaryConfig summary_config( deck, schedule, es.getTableManager( ));
+        SummaryState st;
+        es.getIOConfig().setBaseName( "FOO" );
+
+        EclipseIO eclWriter( es, eclGrid , schedule, summary_config, EclipseIO::Backend::Columnar );
+
+        std::vector<double> tranx(3*3*3, 2.0);
+        tranx_output = es.getUnits().from_si( measure::transmissibility, 2.0 );
+        data::Solution eGridProps {
+            { "TRANX", { measure::transmissibility, tranx, TargetType::INIT } },
+        };
+        std::vector<int> v(27); v[2] = 67; v[26] = 89;
+        eclWriter.writeInitial( eGridProps , {{ "STR_V", v }} );
+
+        const auto start_time = ecl_util_make_date( 10, 10, 2008 );
+        for( int i = 1; i < 4; ++i ) {
+            const auto sol = createBlackoilState( i, 3 * 3 * 3 );
+            eclWriter.writeTimeStep( st, i, false,
+                                     ecl_util_make_date( 10 + i, 11, 2008 ) - start_time,
+                                     RestartValue( sol, data::Wells() ));
+        }
+    }
+
+    const auto rset = EclIO::OutputStream::ResultSet { ".", "FOO" };
+
+    // INIT and restart arrays go to the columnar container only.
+    BOOST_CHECK( !std::ifstream( "FOO.INIT" ) );
+    BOOST_CHECK( !std::ifstream( "FOO.UNRST" ) );
+    BOOST_CHECK( !std::ifstream( "FOO.X0001" ) );
+
+    {
+        const EclIO::EColumnar init( OS::directory( rset, OS::Section::Init ) );
+
+        BOOST_CHECK( init.hasKey( "INTEHEAD" ) );
+        BOOST_CHECK( init.hasKey( "PORV" ) );
+
+        const auto poro = init.get<float>( "PORO" );
+        BOOST_CHECK_EQUAL( poro.size(), 27 );
+        for (const auto& p : poro)
+            BOOST_CHECK_CLOSE( p, 0.3, 1.0e-5 );
+
+        const auto str_v = init.get<int>( "STR_V" );
+        BOOST_CHECK_EQUAL( str_v.size(), 27 );
+        BOOST_CHECK_EQUAL( str_v[2], 67 );
+        BOOST_CHECK_EQUAL( str_v[26], 89 );
+
+        const auto tran = init.get<float>( "TRANX" );
+        BOOST_CHECK_EQUAL( tran.size(), 27 );
+        BOOST_CHECK_CLOSE( tran[0], tranx_output, 1.0e-4 );
+    }
+
+    for( int i = 1; i < 4; ++i ) {
+        const EclIO::EColumnar rst( OS::directory( rset, OS::Section::Restart, i ) );
+        const auto expected = createBlackoilState( i, 3 * 3 * 3 );
+
+        BOOST_CHECK( rst.hasKey( "INTEHEAD" ) );
+        BOOST_CHECK( rst.hasKey( "DOUBHEAD" ) );
+
+        // Pressure is written in bars, element ranges can be read directly.
+        const auto pressure = rst.get<float>( "PRESSURE" );
+        BOOST_CHECK_EQUAL( pressure.size(), 27 );
+        for( size_t c = 0; c < pressure.size(); ++c )
+            BOOST_CHECK_CLOSE( pressure[c], expected.data( "PRESSURE" )[c] / unit::barsa, 1.0e-5 );
+
+        const auto swat = rst.get<float>( "SWAT", 10, 20 );
+        BOOST_CHECK_EQUAL( swat.size(), 10 );
+        for( size_t c = 0; c < swat.size(); ++c )
+            BOOST_CHECK_CLOSE( swat[c], expected.data( "SWAT" )[10 + c], 1.0e-5 );
+    }
+
+    test_work_area_free(work_area);
+}
+
 BOOST_AUTO_TEST_CASE(OPM_XWEL) {
 }
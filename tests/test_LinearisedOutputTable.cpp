@@ -165,6 +165,53 @@ BOOST_AUTO_TEST_CASE (Construct_UserDefined_FillVal)
     check_is_close(linTable.getData(), expect_initial);
 }
 
+BOOST_AUTO_TEST_CASE (Construct_External_Buffer)
+{
+    const auto numTables  = std::size_t{2};
+    const auto numPrimary = std::size_t{1};
+    const auto numRows    = std::size_t{3};
+    const auto numCols    = std::size_t{3};
+    const auto fillVal    = -2.0e20;
+
+    auto buffer = std::vector<double> { 1.0, 2.0 };
+
+    auto linTable = ::Opm::LinearisedOutputTable {
+        buffer, numTables, numPrimary, numRows, numCols, fillVal
+    };
+
+    BOOST_CHECK_EQUAL(buffer.size(),
+                      2 + numTables*numPrimary*numRows*numCols);
+
+    auto descr = ::Opm::DifferentiateOutputTable::Descriptor{};
+
+    descr.tableID    = 1;
+    descr.primID     = 0;
+    descr.numActRows = 2;
+
+    {
+        const auto x = std::vector<double> { 0.5, 1.0 };
+        const auto y = std::vector<double> { 1.0, 2.0 };
+
+        std::copy(x.begin(), x.end(),
+                  linTable.column(descr.tableID, descr.primID, 0));
+
+        std::copy(y.begin(), y.end(),
+                  linTable.column(descr.tableID, descr.primID, 1));
+    }
+
+    calcSlopes(1, descr, linTable);
+
+    // Existing buffer contents untouched, table 0 left at fill value.
+    const auto expect = std::vector<double> {
+        1.0,     2.0,
+        fillVal, fillVal, fillVal,   0.5,     1.0,     fillVal, // column 0
+        fillVal, fillVal, fillVal,   1.0,     2.0,     fillVal, // column 1
+        fillVal, fillVal, fillVal,   fillVal, 2.0,     fillVal, // column 2
+    };
+
+    check_is_close(buffer, expect);
+}
+
 BOOST_AUTO_TEST_SUITE_END ()
 
 // ---------------------------------------------------------------------
@@ -22,14 +22,17 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/io/eclipse/OutputStream.hpp>
+#include <opm/io/eclipse/Columnar.hpp>
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/ERft.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <ostream>
 #include <string>
@@ -486,6 +489,70 @@ BOOST_AUTO_TEST_CASE(Formatted)
     }
 }
 
+BOOST_AUTO_TEST_CASE(SinglePrecisionSource)
+{
+    // Generated vector spans several ranges of output blocks in both the
+    // formatted and the unformatted case.
+    const auto x = []()
+    {
+        auto v = std::vector<double>(150003);
+        for (auto i = 0*v.size(); i < v.size(); ++i) {
+            v[i] = 1.0 / (1.0 + i);
+        }
+
+        return v;
+    }();
+
+    for (const auto formatted : { false, true }) {
+        const auto rset = RSet("CASE");
+        const auto fmt  = ::Opm::EclIO::OutputStream::Formatted{ formatted };
+
+        {
+            auto init = ::Opm::EclIO::OutputStream::Init {
+                rset, fmt
+            };
+
+            init.write("S", std::vector<float>(x.begin(), x.end()));
+            init.write("G", x.size(),
+                [&x](const std::size_t begin, const std::size_t end, float* block)
+            {
+                for (auto i = begin; i < end; ++i) {
+                    *block++ = static_cast<float>(x[i]);
+                }
+            });
+            init.write("E", 0, [](const std::size_t, const std::size_t, float*)
+            {
+                BOOST_FAIL("Empty vector must not generate any blocks");
+            });
+        }
+
+        const auto fname = ::Opm::EclIO::OutputStream::
+            outputFileName(rset, formatted ? "FINIT" : "INIT");
+
+        auto init = ::Opm::EclIO::EclFile{fname};
+
+        {
+            const auto vectors        = init.getList();
+            const auto expect_vectors = std::vector<Opm::EclIO::EclFile::EclEntry>{
+                Opm::EclIO::EclFile::EclEntry{"S", Opm::EclIO::eclArrType::REAL, 150003},
+                Opm::EclIO::EclFile::EclEntry{"G", Opm::EclIO::eclArrType::REAL, 150003},
+                Opm::EclIO::EclFile::EclEntry{"E", Opm::EclIO::eclArrType::REAL, 0},
+            };
+
+            BOOST_CHECK_EQUAL_COLLECTIONS(vectors.begin(), vectors.end(),
+                                          expect_vectors.begin(),
+                                          expect_vectors.end());
+        }
+
+        init.loadData();
+
+        const auto& S = init.get<float>("S");
+        const auto& G = init.get<float>("G");
+        BOOST_CHECK_EQUAL_COLLECTIONS(G.begin(), G.end(),
+                                      S.begin(), S.end());
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 // ==========================================================================
@@ -1084,4 +1151,537 @@ BOOST_AUTO_TEST_CASE(Formatted_Separate)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Compressed)
+{
+    const auto rset  = RSet("CASE");
+    const auto fmt   = ::Opm::EclIO::OutputStream::Formatted { false };
+    const auto unif  = ::Opm::EclIO::OutputStream::Unified   { true };
+    const auto compr = ::Opm::EclIO::OutputStream::Compressed{ true };
+
+    const auto n = std::size_t{ 20000 };
+
+    auto pressure = [n](const int seqnum)
+    {
+        auto p = std::vector<double>(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            p[i] = 100.0*seqnum + 0.01*(i % 250);
+        }
+
+        return p;
+    };
+
+    for (const auto seqnum : { 1, 13, 5 }) {  // 5 overwrites 13
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, seqnum, fmt, unif, compr
+        };
+
+        rst.write("I", std::vector<int>(n, seqnum));
+        rst.write("S", std::vector<float>{ 1.0f*seqnum });
+        rst.write("P", pressure(seqnum));
+        rst.write("Z", std::vector<std::string>{ "W1" });
+    }
+
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    auto rst = ::Opm::EclIO::ERst{fname};
+
+    {
+        const auto seqnum        = rst.listOfReportStepNumbers();
+        const auto expect_seqnum = std::vector<int>{1, 5};
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+    }
+
+    {
+        const auto vectors        = rst.listOfRstArrays(5);
+        const auto expect_vectors = std::vector<Opm::EclIO::EclFile::EclEntry>{
+            Opm::EclIO::EclFile::EclEntry{"SEQNUM", Opm::EclIO::eclArrType::INTE, 1},
+            Opm::EclIO::EclFile::EclEntry{"I", Opm::EclIO::eclArrType::INTE, static_cast<int>(n)},
+            Opm::EclIO::EclFile::EclEntry{"S", Opm::EclIO::eclArrType::REAL, 1},
+            Opm::EclIO::EclFile::EclEntry{"P", Opm::EclIO::eclArrType::DOUB, static_cast<int>(n)},
+            Opm::EclIO::EclFile::EclEntry{"Z", Opm::EclIO::eclArrType::CHAR, 1},
+        };
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(vectors.begin(), vectors.end(),
+                                      expect_vectors.begin(),
+                                      expect_vectors.end());
+    }
+
+    for (const auto seqnum : { 1, 5 }) {
+        const auto& I = rst.getRst<int>("I", seqnum);
+        const auto  expect_I = std::vector<int>(n, seqnum);
+        BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                      expect_I.begin(),
+                                      expect_I.end());
+
+        const auto& P = rst.getRst<double>("P", seqnum);
+        const auto  expect_P = pressure(seqnum);
+        BOOST_CHECK_EQUAL_COLLECTIONS(P.begin(), P.end(),
+                                      expect_P.begin(),
+                                      expect_P.end());
+
+        const auto& S = rst.getRst<float>("S", seqnum);
+        BOOST_CHECK_EQUAL(S.size(), std::size_t{1});
+        BOOST_CHECK_EQUAL(S[0], 1.0f*seqnum);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Delta)
+{
+    const auto fmt   = ::Opm::EclIO::OutputStream::Formatted { false };
+    const auto unif  = ::Opm::EclIO::OutputStream::Unified   { true };
+    const auto compr = ::Opm::EclIO::OutputStream::Compressed{ false };
+
+    const auto n = std::size_t{ 5000 };
+
+    auto pressure = [n](const int seqnum)
+    {
+        auto p = std::vector<double>(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            p[i] = 100.0 + 0.01*(i % 250);
+        }
+
+        p[10*seqnum] += 1.0;
+
+        return p;
+    };
+
+    // Generated array of several compressed blocks which differs from one
+    // report step to the next in a few elements.
+    const auto nG = std::size_t{ 3*8192 + 100 };
+
+    auto gValue = [](const int seqnum, const std::size_t i)
+    {
+        return 0.25f*(i % 1000) + ((i % 9000 == std::size_t(10*seqnum)) ? 1.0f : 0.0f);
+    };
+
+    auto noise = [n](const int seqnum)
+    {
+        auto x = std::vector<int>(n);
+        auto state = static_cast<unsigned int>(seqnum);
+        for (auto& xi : x) {
+            state = 1664525u*state + 1013904223u;
+            xi = static_cast<int>(state >> 1);
+        }
+
+        return x;
+    };
+
+    auto writeSteps = [&](const ::Opm::EclIO::OutputStream::ResultSet& rset,
+                          ::Opm::EclIO::OutputStream::DeltaBase* deltas)
+    {
+        for (const auto seqnum : { 1, 2, 3, 2 }) {  // 2 overwrites 2 and 3
+            auto rst = ::Opm::EclIO::OutputStream::Restart {
+                rset, seqnum, fmt, unif, compr, deltas
+            };
+
+            rst.write("I", std::vector<int>(n, 7));
+            rst.write("P", pressure(seqnum));
+            rst.write("N", noise(seqnum));
+            rst.write("L", std::vector<bool>(n, true));
+            rst.write("Z", std::vector<std::string>(40, "W1"));
+            rst.write("F", n, [](std::size_t begin, std::size_t end, float* block)
+            {
+                for (auto i = begin; i < end; ++i) {
+                    block[i - begin] = 0.5f*i;
+                }
+            });
+            rst.write("G", nG, [seqnum, &gValue](std::size_t begin, std::size_t end, float* block)
+            {
+                for (auto i = begin; i < end; ++i) {
+                    block[i - begin] = gValue(seqnum, i);
+                }
+            });
+        }
+    };
+
+    const auto rset = RSet("CASE");
+    const auto full = RSet("FULL");
+
+    auto deltas = ::Opm::EclIO::OutputStream::DeltaBase{};
+    writeSteps(rset, &deltas);
+    writeSteps(full, nullptr);
+
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    // Only "N" of the second report step is written in full.
+    BOOST_CHECK_LT(3 * boost::filesystem::file_size(fname),
+                   2 * boost::filesystem::file_size(::Opm::EclIO::OutputStream::
+                           outputFileName(full, "UNRST")));
+
+    auto rst = ::Opm::EclIO::ERst{fname};
+
+    {
+        const auto seqnum        = rst.listOfReportStepNumbers();
+        const auto expect_seqnum = std::vector<int>{1, 2};
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+    }
+
+    rst.loadReportStepNumber(2);
+
+    for (const auto seqnum : { 2, 1 }) {
+        const auto& I = rst.getRst<int>("I", seqnum);
+        const auto  expect_I = std::vector<int>(n, 7);
+        BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                      expect_I.begin(),
+                                      expect_I.end());
+
+        const auto& P = rst.getRst<double>("P", seqnum);
+        const auto  expect_P = pressure(seqnum);
+        BOOST_CHECK_EQUAL_COLLECTIONS(P.begin(), P.end(),
+                                      expect_P.begin(),
+                                      expect_P.end());
+
+        const auto& N = rst.getRst<int>("N", seqnum);
+        const auto  expect_N = noise(seqnum);
+        BOOST_CHECK_EQUAL_COLLECTIONS(N.begin(), N.end(),
+                                      expect_N.begin(),
+                                      expect_N.end());
+
+        const auto& L = rst.getRst<bool>("L", seqnum);
+        BOOST_CHECK_EQUAL(L.size(), n);
+        BOOST_CHECK(std::all_of(L.begin(), L.end(), [](const bool l) { return l; }));
+
+        const auto& Z = rst.getRst<std::string>("Z", seqnum);
+        BOOST_CHECK_EQUAL(Z.size(), std::size_t{40});
+        BOOST_CHECK(std::all_of(Z.begin(), Z.end(), [](const std::string& z) { return z == "W1"; }));
+
+        const auto& F = rst.getRst<float>("F", seqnum);
+        BOOST_CHECK_EQUAL(F.size(), n);
+        BOOST_CHECK_EQUAL(F[n - 1], 0.5f*(n - 1));
+
+        const auto& G = rst.getRst<float>("G", seqnum);
+        BOOST_CHECK_EQUAL(G.size(), nG);
+        for (std::size_t i = 0; i < G.size(); ++i) {
+            if (G[i] != gValue(seqnum, i)) {
+                BOOST_CHECK_EQUAL(G[i], gValue(seqnum, i));
+                break;
+            }
+        }
+    }
+
+    // Arrays referring to earlier report steps are resolved by ERst only.
+    {
+        auto file = ::Opm::EclIO::EclFile{fname};
+        const auto& names = file.arrayNames();
+        const auto i = std::find(names.rbegin(), names.rend(), "I").base() - names.begin() - 1;
+
+        BOOST_CHECK_THROW(file.get<int>(static_cast<int>(i)), std::runtime_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Delta_Limit)
+{
+    const auto fmt   = ::Opm::EclIO::OutputStream::Formatted { false };
+    const auto unif  = ::Opm::EclIO::OutputStream::Unified   { true };
+    const auto compr = ::Opm::EclIO::OutputStream::Compressed{ false };
+
+    const auto n = std::size_t{ 5000 };
+    const auto rset = RSet("CASE");
+
+    // Room for one of the two arrays only.
+    auto deltas = ::Opm::EclIO::OutputStream::DeltaBase{ 3 * n * sizeof(int) / 2 };
+
+    for (const auto seqnum : { 1, 2 }) {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, seqnum, fmt, unif, compr, &deltas
+        };
+
+        rst.write("A", std::vector<int>(n, 1));
+        rst.write("B", n, [seqnum](std::size_t begin, std::size_t end, float* block)
+        {
+            for (auto i = begin; i < end; ++i) {
+                block[i - begin] = 1.0f*seqnum;
+            }
+        });
+
+        BOOST_CHECK_EQUAL(deltas.retainedBytes(), n * sizeof(int));
+    }
+
+    auto rst = ::Opm::EclIO::ERst{
+        ::Opm::EclIO::OutputStream::outputFileName(rset, "UNRST")
+    };
+
+    rst.loadReportStepNumber(2);
+
+    for (const auto seqnum : { 2, 1 }) {
+        const auto& A = rst.getRst<int>("A", seqnum);
+        BOOST_CHECK_EQUAL(A.size(), n);
+        BOOST_CHECK(std::all_of(A.begin(), A.end(), [](const int a) { return a == 1; }));
+
+        const auto& B = rst.getRst<float>("B", seqnum);
+        BOOST_CHECK_EQUAL(B.size(), n);
+        BOOST_CHECK(std::all_of(B.begin(), B.end(), [seqnum](const float b) { return b == 1.0f*seqnum; }));
+    }
+
+    deltas.discardFrom(1);
+    BOOST_CHECK_EQUAL(deltas.retainedBytes(), std::size_t{0});
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Class_Restart
+
+// ==========================================================================
+
+namespace {
+    void writeRftRecord(::Opm::EclIO::OutputStream::RFT& rft,
+                        const std::string&               well,
+                        const std::vector<int>&          date,
+                        const float                      time,
+                        const std::vector<float>&        pressure)
+    {
+        using Str = ::Opm::EclIO::PaddedOutputString<8>;
+
+        auto welletc = std::vector<Str>(16);
+        welletc[0] = "DAYS";
+        welletc[1] = well;
+        welletc[5] = "R";
+
+        rft.write("TIME", std::vector<float>{ time });
+        rft.write("DATE", date);
+        rft.write("WELLETC", welletc);
+        rft.write("CONIPOS", std::vector<int>(pressure.size(), 1));
+        rft.write("HOSTGRID", std::vector<Str>(pressure.size()));
+        rft.write("PRESSURE", pressure);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(Class_RFT)
+
+BOOST_AUTO_TEST_CASE(Unformatted_Append)
+{
+    using RFT = ::Opm::EclIO::OutputStream::RFT;
+
+    const auto rset = RSet("CASE");
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted{ false };
+
+    {
+        auto rft = RFT{ rset, fmt, RFT::OpenExisting{ false } };
+
+        writeRftRecord(rft, "P1", { 1, 2, 2019 }, 31.0f, { 250.0f, 251.5f });
+        writeRftRecord(rft, "I1", { 1, 2, 2019 }, 31.0f, { 300.0f });
+    }
+
+    {
+        auto rft = RFT{ rset, fmt, RFT::OpenExisting{ true } };
+
+        writeRftRecord(rft, "P1", { 1, 3, 2019 }, 59.0f, { 240.0f, 242.25f });
+    }
+
+    {
+        const auto fname = ::Opm::EclIO::OutputStream::
+            outputFileName(rset, "RFT");
+
+        const auto rft = ::Opm::EclIO::ERft{ fname };
+
+        BOOST_CHECK_EQUAL(rft.listOfRftReports().size(), std::size_t{3});
+
+        BOOST_CHECK( rft.hasRft("P1", 2019, 2, 1));
+        BOOST_CHECK( rft.hasRft("I1", 2019, 2, 1));
+        BOOST_CHECK( rft.hasRft("P1", 2019, 3, 1));
+        BOOST_CHECK(!rft.hasRft("I1", 2019, 3, 1));
+
+        {
+            const auto& p = rft.getRft<float>("PRESSURE", "P1", 2019, 3, 1);
+            const auto  expect_p = std::vector<float>{ 240.0f, 242.25f };
+
+            check_is_close(p, expect_p);
+        }
+
+        {
+            const auto& p = rft.getRft<float>("PRESSURE", "I1", 2019, 2, 1);
+            const auto  expect_p = std::vector<float>{ 300.0f };
+
+            check_is_close(p, expect_p);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Formatted_New)
+{
+    using RFT = ::Opm::EclIO::OutputStream::RFT;
+
+    const auto rset = RSet("CASE");
+    const auto fmt  = ::Opm::EclIO::OutputStream::Formatted{ true };
+
+    {
+        auto rft = RFT{ rset, fmt, RFT::OpenExisting{ false } };
+
+        writeRftRecord(rft, "P1", { 1, 2, 2019 }, 31.0f, { 250.0f, 251.5f });
+    }
+
+    {
+        // Not appending: Replaces existing contents.
+        auto rft = RFT{ rset, fmt, RFT::OpenExisting{ false } };
+
+        writeRftRecord(rft, "P2", { 1, 3, 2019 }, 59.0f, { 123.0f });
+    }
+
+    {
+        const auto fname = ::Opm::EclIO::OutputStream::
+            outputFileName(rset, "FRFT");
+
+        const auto rft = ::Opm::EclIO::ERft{ fname };
+
+        BOOST_CHECK_EQUAL(rft.listOfRftReports().size(), std::size_t{1});
+
+        BOOST_CHECK(!rft.hasRft("P1", 2019, 2, 1));
+        BOOST_CHECK( rft.hasRft("P2", 2019, 3, 1));
+
+        const auto& p = rft.getRft<float>("PRESSURE", "P2", 2019, 3, 1);
+        const auto  expect_p = std::vector<float>{ 123.0f };
+
+        check_is_close(p, expect_p);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Class_RFT
+
+// ==========================================================================
+
+namespace {
+    void writeSection(::Opm::EclIO::OutputStream::ArrayWriter& section)
+    {
+        using Str = ::Opm::EclIO::PaddedOutputString<8>;
+
+        section.write("I", std::vector<int>   {1, 7, 2, 9});
+        section.write("L", std::vector<bool>  {true, false, false, true});
+        section.write("S", std::vector<float> {3.1f, 4.1f, 59.265f});
+        section.write("D", std::vector<double>{2.71, 8.21});
+        section.message("STARTSOL");
+        section.write("Z", std::vector<std::string>{ "Hello", "", "World!!" });
+        section.write("Z", std::vector<Str>{ Str{"PROD"}, Str{"INJ_1"} });
+        section.write("X/Y", std::vector<int>{ -1 });
+        section.write("R", 100 * 1000,
+            [](const std::size_t begin, const std::size_t end, float* block)
+        {
+            for (auto i = begin; i < end; ++i)
+                *block++ = 0.5f * i;
+        });
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(Class_Columnar)
+
+BOOST_AUTO_TEST_CASE(Write_Read)
+{
+    using Columnar = ::Opm::EclIO::OutputStream::Columnar;
+
+    const auto rset = RSet("CASE");
+
+    {
+        auto rst = Columnar{ rset, Columnar::Section::Restart, 5 };
+        writeSection(rst);
+    }
+
+    const auto dir = Columnar::directory(rset, Columnar::Section::Restart, 5);
+    BOOST_CHECK(boost::filesystem::exists(boost::filesystem::path{ dir } / "I.col"));
+    BOOST_CHECK(boost::filesystem::exists(boost::filesystem::path{ dir } / "Z.1.col"));
+    BOOST_CHECK(boost::filesystem::exists(boost::filesystem::path{ dir } / "X%2FY.col"));
+
+    const auto rst = ::Opm::EclIO::EColumnar{ dir };
+
+    {
+        const auto vectors        = rst.getList();
+        const auto expect_vectors = std::vector<Opm::EclIO::EclFile::EclEntry>{
+            Opm::EclIO::EclFile::EclEntry{"I"       , Opm::EclIO::eclArrType::INTE, 4},
+            Opm::EclIO::EclFile::EclEntry{"L"       , Opm::EclIO::eclArrType::LOGI, 4},
+            Opm::EclIO::EclFile::EclEntry{"S"       , Opm::EclIO::eclArrType::REAL, 3},
+            Opm::EclIO::EclFile::EclEntry{"D"       , Opm::EclIO::eclArrType::DOUB, 2},
+            Opm::EclIO::EclFile::EclEntry{"STARTSOL", Opm::EclIO::eclArrType::MESS, 0},
+            Opm::EclIO::EclFile::EclEntry{"Z"       , Opm::EclIO::eclArrType::CHAR, 3},
+            Opm::EclIO::EclFile::EclEntry{"Z"       , Opm::EclIO::eclArrType::CHAR, 2},
+            Opm::EclIO::EclFile::EclEntry{"X/Y"     , Opm::EclIO::eclArrType::INTE, 1},
+            Opm::EclIO::EclFile::EclEntry{"R"       , Opm::EclIO::eclArrType::REAL, 100 * 1000},
+        };
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(vectors.begin(), vectors.end(),
+                                      expect_vectors.begin(),
+                                      expect_vectors.end());
+    }
+
+    BOOST_CHECK(rst.hasKey("STARTSOL"));
+    BOOST_CHECK(!rst.hasKey("ENDSOL"));
+    BOOST_CHECK_EQUAL(rst.count("Z"), 2);
+
+    {
+        const auto I = rst.get<int>("I");
+        const auto expect_I = std::vector<int>{ 1, 7, 2, 9 };
+        BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                      expect_I.begin(), expect_I.end());
+    }
+
+    {
+        const auto L = rst.get<bool>("L");
+        const auto expect_L = std::vector<bool>{ true, false, false, true };
+        BOOST_CHECK_EQUAL_COLLECTIONS(L.begin(), L.end(),
+                                      expect_L.begin(), expect_L.end());
+    }
+
+    {
+        const auto S = rst.get<float>("S");
+        check_is_close(S, std::vector<float>{ 3.1f, 4.1f, 59.265f });
+
+        const auto D = rst.get<double>("D");
+        check_is_close(D, std::vector<double>{ 2.71, 8.21 });
+    }
+
+    {
+        const auto Z0 = rst.get<std::string>("Z");
+        const auto expect_Z0 = std::vector<std::string>{ "Hello", "", "World!!" };
+        BOOST_CHECK_EQUAL_COLLECTIONS(Z0.begin(), Z0.end(),
+                                      expect_Z0.begin(), expect_Z0.end());
+
+        const auto Z1 = rst.get<std::string>("Z", 1);
+        const auto expect_Z1 = std::vector<std::string>{ "PROD", "INJ_1" };
+        BOOST_CHECK_EQUAL_COLLECTIONS(Z1.begin(), Z1.end(),
+                                      expect_Z1.begin(), expect_Z1.end());
+    }
+
+    {
+        // Range straddling the boundary between generated chunks.
+        const auto R = rst.get<float>("R", 65530, 65540);
+        BOOST_REQUIRE_EQUAL(R.size(), std::size_t{10});
+
+        for (auto i = 0*R.size(); i < R.size(); ++i)
+            BOOST_CHECK_EQUAL(R[i], 0.5f * (65530 + i));
+
+        BOOST_CHECK_EQUAL(rst.get<float>("R").back(), 0.5f * (100 * 1000 - 1));
+    }
+
+    BOOST_CHECK_THROW(rst.get<float>("I"), std::runtime_error);
+    BOOST_CHECK_THROW(rst.get<int>("Z", 2), std::invalid_argument);
+    BOOST_CHECK_THROW(rst.get<int>("I", 3, 5), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Rewrite_Section)
+{
+    using Columnar = ::Opm::EclIO::OutputStream::Columnar;
+
+    const auto rset = RSet("CASE");
+
+    {
+        auto init = Columnar{ rset, Columnar::Section::Init };
+        writeSection(init);
+    }
+
+    {
+        auto init = Columnar{ rset, Columnar::Section::Init };
+        init.write("PORV", std::vector<float>{ 1.0f, 2.0f });
+    }
+
+    const auto dir  = Columnar::directory(rset, Columnar::Section::Init);
+    const auto init = ::Opm::EclIO::EColumnar{ dir };
+
+    BOOST_CHECK_EQUAL(init.getList().size(), std::size_t{1});
+    BOOST_CHECK(init.hasKey("PORV"));
+    BOOST_CHECK(!boost::filesystem::exists(boost::filesystem::path{ dir } / "I.col"));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Class_Columnar
@@ -22,6 +22,8 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <opm/io/eclipse/ERft.hpp>
+
 #include <opm/output/eclipse/EclipseIO.hpp>
 #include <opm/output/data/Wells.hpp>
 
@@ -39,48 +41,98 @@
 #include <ert/util/util.h>
 #include <ert/util/test_work_area.h>
 
+#include <fstream>
+#include <iterator>
+#include <memory>
 #include <vector>
 
 using namespace Opm;
 
 namespace {
 
+/*
+  Check one well's record with the independent libecl RFT reader, such
+  that errors shared by the RFT writer and ERft are caught.
+*/
+void verifyRFTNodeLibecl(const std::string& rft_filename,
+                         const std::string& well,
+                         const time_t       date,
+                         const std::size_t  numConnections,
+                         const double       pressure_998,
+                         const double       depth_998) {
+    std::shared_ptr<ecl_rft_file_type> rft_file( ecl_rft_file_alloc(rft_filename.c_str()), ecl_rft_file_free );
+    BOOST_REQUIRE( rft_file );
+
+    const ecl_rft_node_type * node = ecl_rft_file_get_well_time_rft(rft_file.get(), well.c_str(), date);
+    BOOST_REQUIRE( node != nullptr );
+    BOOST_CHECK( ecl_rft_node_is_RFT(node) );
+    BOOST_CHECK_EQUAL( ecl_rft_node_get_well_name(node), well );
+    BOOST_CHECK_EQUAL( ecl_rft_node_get_date(node), date );
+    BOOST_CHECK_EQUAL( static_cast<std::size_t>(ecl_rft_node_get_size(node)), numConnections );
+
+    const ecl_rft_cell_type * cell = ecl_rft_node_lookup_ijk(node, 8, 8, 2);
+    BOOST_REQUIRE( cell != nullptr );
+    BOOST_CHECK_CLOSE( ecl_rft_cell_get_pressure(cell), pressure_998, 1.0e-3 );
+    BOOST_CHECK_CLOSE( ecl_rft_cell_get_depth(cell), depth_998, 1.0e-3 );
+}
+
 void verifyRFTFile(const std::string& rft_filename) {
+    verifyRFTNodeLibecl(rft_filename, "OP_1", ecl_util_make_date(10, 10, 2008),
+                        9, 0.00002, 3*0.250 + (0.250/2));
 
-    ecl_rft_file_type * new_rft_file = ecl_rft_file_alloc(rft_filename.c_str());
-    std::shared_ptr<ecl_rft_file_type> rft_file;
-    rft_file.reset(new_rft_file, ecl_rft_file_free);
+    const auto rft = EclIO::ERft{ rft_filename };
 
     //Get RFT node for well/time OP_1/10 OKT 2008
-    time_t recording_time = ecl_util_make_date(10, 10, 2008);
-    ecl_rft_node_type * ecl_rft_node = ecl_rft_file_get_well_time_rft(rft_file.get() , "OP_1" , recording_time);
-    BOOST_CHECK(ecl_rft_node_is_RFT(ecl_rft_node));
+    const auto date = EclIO::ERft::RftDate{ 2008, 10, 10 };
+    BOOST_REQUIRE(rft.hasRft("OP_1", date));
+
+    const auto& welletc = rft.getRft<std::string>("WELLETC", "OP_1", date);
+    BOOST_CHECK_EQUAL(welletc[5], "R");
+
+    const auto& I = rft.getRft<int>("CONIPOS", "OP_1", date);
+    const auto& J = rft.getRft<int>("CONJPOS", "OP_1", date);
+    const auto& K = rft.getRft<int>("CONKPOS", "OP_1", date);
+
+    const auto& pressure = rft.getRft<float>("PRESSURE", "OP_1", date);
+    const auto& sgas     = rft.getRft<float>("SGAS", "OP_1", date);
+    const auto& swat     = rft.getRft<float>("SWAT", "OP_1", date);
+    const auto& depth    = rft.getRft<float>("DEPTH", "OP_1", date);
 
     //Verify RFT data for completions (ijk) 9 9 1, 9 9 2 and 9 9 3 for OP_1
-    const ecl_rft_cell_type * ecl_rft_cell1 = ecl_rft_node_lookup_ijk(ecl_rft_node, 8, 8, 0);
-    const ecl_rft_cell_type * ecl_rft_cell2 = ecl_rft_node_lookup_ijk(ecl_rft_node, 8, 8, 1);
-    const ecl_rft_cell_type * ecl_rft_cell3 = ecl_rft_node_lookup_ijk(ecl_rft_node, 8, 8, 2);
+    auto lookup_ijk = [&I, &J, &K](const int i, const int j, const int k) {
+        for (std::size_t c = 0; c < I.size(); ++c) {
+            if ((I[c] == i + 1) && (J[c] == j + 1) && (K[c] == k + 1))
+                return c;
+        }
+
+        BOOST_FAIL("No RFT data for connection " << i << ", " << j << ", " << k);
+        return I.size();
+    };
+
+    const auto cell1 = lookup_ijk(8, 8, 0);
+    const auto cell2 = lookup_ijk(8, 8, 1);
+    const auto cell3 = lookup_ijk(8, 8, 2);
 
     double tol = 0.00001;
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_pressure(ecl_rft_cell1), 0.00000, tol);
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_pressure(ecl_rft_cell2), 0.00001, tol);
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_pressure(ecl_rft_cell3), 0.00002, tol);
+    BOOST_CHECK_CLOSE(pressure[cell1], 0.00000, tol);
+    BOOST_CHECK_CLOSE(pressure[cell2], 0.00001, tol);
+    BOOST_CHECK_CLOSE(pressure[cell3], 0.00002, tol);
 
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_sgas(ecl_rft_cell1), 0.0, tol);
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_sgas(ecl_rft_cell2), 0.2, tol);
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_sgas(ecl_rft_cell3), 0.4, tol);
+    BOOST_CHECK_CLOSE(sgas[cell1], 0.0, tol);
+    BOOST_CHECK_CLOSE(sgas[cell2], 0.2, tol);
+    BOOST_CHECK_CLOSE(sgas[cell3], 0.4, tol);
 
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_swat(ecl_rft_cell1), 0.0, tol);
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_swat(ecl_rft_cell2), 0.1, tol);
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_swat(ecl_rft_cell3), 0.2, tol);
+    BOOST_CHECK_CLOSE(swat[cell1], 0.0, tol);
+    BOOST_CHECK_CLOSE(swat[cell2], 0.1, tol);
+    BOOST_CHECK_CLOSE(swat[cell3], 0.2, tol);
 
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_soil(ecl_rft_cell1), 1.0, tol);
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_soil(ecl_rft_cell2), 0.7, tol);
-    BOOST_CHECK_CLOSE(ecl_rft_cell_get_soil(ecl_rft_cell3), 0.4, tol);
+    BOOST_CHECK_CLOSE(1.0 - swat[cell1] - sgas[cell1], 1.0, tol);
+    BOOST_CHECK_CLOSE(1.0 - swat[cell2] - sgas[cell2], 0.7, tol);
+    BOOST_CHECK_CLOSE(1.0 - swat[cell3] - sgas[cell3], 0.4, tol);
 
-    BOOST_CHECK_EQUAL(ecl_rft_cell_get_depth(ecl_rft_cell1), (0.250 + (0.250/2)));
-    BOOST_CHECK_EQUAL(ecl_rft_cell_get_depth(ecl_rft_cell2), (2*0.250 + (0.250/2)));
-    BOOST_CHECK_EQUAL(ecl_rft_cell_get_depth(ecl_rft_cell3), (3*0.250 + (0.250/2)));
+    BOOST_CHECK_EQUAL(depth[cell1], (0.250 + (0.250/2)));
+    BOOST_CHECK_EQUAL(depth[cell2], (2*0.250 + (0.250/2)));
+    BOOST_CHECK_EQUAL(depth[cell3], (3*0.250 + (0.250/2)));
 }
 
 data::Solution createBlackoilState( int timeStepIdx, int numCells ) {
@@ -100,12 +152,8 @@ data::Solution createBlackoilState( int timeStepIdx, int numCells ) {
 
 }
 
-BOOST_AUTO_TEST_CASE(test_RFT) {
-    std::string eclipse_data_filename    = "testrft.DATA";
-    test_work_area_type * test_area = test_work_area_alloc("test_RFT");
-    test_work_area_copy_file( test_area, eclipse_data_filename.c_str() );
-
-    auto deck = Parser().parseFile( eclipse_data_filename );
+namespace {
+void writeRFTStep2(const Deck& deck) {
     auto eclipseState = EclipseState(deck);
     {
         /* eclipseWriter is scoped here to ensure it is destroyed after the
@@ -160,14 +208,60 @@ BOOST_AUTO_TEST_CASE(test_RFT) {
                                      step_time - start_time,
                                      restart_value);
     }
+}
+}
+
+BOOST_AUTO_TEST_CASE(test_RFT) {
+    std::string eclipse_data_filename    = "testrft.DATA";
+    test_work_area_type * test_area = test_work_area_alloc("test_RFT");
+    test_work_area_copy_file( test_area, eclipse_data_filename.c_str() );
+
+    writeRFTStep2( Parser().parseFile( eclipse_data_filename ) );
 
     verifyRFTFile("TESTRFT.RFT");
     test_work_area_free( test_area );
 }
 
+
+BOOST_AUTO_TEST_CASE(test_RFT_FIELD) {
+    std::string eclipse_data_filename    = "testrft.DATA";
+    test_work_area_type * test_area = test_work_area_alloc("test_RFT_FIELD");
+    test_work_area_copy_file( test_area, eclipse_data_filename.c_str() );
+
+    // The same case in FIELD units; the grid is then given in feet.
+    std::string deck_string;
+    {
+        std::ifstream deck_file( eclipse_data_filename );
+        deck_string.assign( std::istreambuf_iterator<char>( deck_file ), std::istreambuf_iterator<char>() );
+    }
+    BOOST_REQUIRE_EQUAL( deck_string.compare(0, 8, "RUNSPEC\n"), 0 );
+    deck_string.insert( 8, "FIELD\n" );
+
+    writeRFTStep2( Parser().parseString( deck_string ) );
+
+    // DEPTH is written in feet and PRESSURE in psi.
+    const double psi = 6894.757293168360;
+    verifyRFTNodeLibecl("TESTRFT.RFT", "OP_1", ecl_util_make_date(10, 10, 2008),
+                        9, 2.0 / psi, 3*0.250 + (0.250/2));
+
+    const auto rft = EclIO::ERft{ "TESTRFT.RFT" };
+    const auto date = EclIO::ERft::RftDate{ 2008, 10, 10 };
+    BOOST_REQUIRE( rft.hasRft("OP_1", date) );
+
+    const auto& depth = rft.getRft<float>("DEPTH", "OP_1", date);
+    const auto& pressure = rft.getRft<float>("PRESSURE", "OP_1", date);
+    BOOST_REQUIRE_EQUAL( depth.size(), 9U );
+    for (std::size_t k = 0; k < depth.size(); ++k) {
+        BOOST_CHECK_CLOSE( depth[k], (k + 1)*0.250 + (0.250/2), 1.0e-3 );
+        BOOST_CHECK_CLOSE( pressure[k], k / psi, 1.0e-3 );
+    }
+
+    test_work_area_free( test_area );
+}
+
 namespace {
 void verifyRFTFile2(const std::string& rft_filename) {
-    ecl_rft_file_type * rft_file = ecl_rft_file_alloc(rft_filename.c_str());
+    const auto rft = EclIO::ERft{ rft_filename };
     /*
       Expected occurences:
 
@@ -179,12 +273,13 @@ void verifyRFTFile2(const std::string& rft_filename) {
       ---------------------
     */
 
-    BOOST_CHECK_EQUAL( 3 , ecl_rft_file_get_size( rft_file ));
-    BOOST_CHECK( ecl_rft_file_get_well_time_rft(rft_file , "OP_1" , ecl_util_make_date(10, 10, 2008)) != NULL );
-    BOOST_CHECK( ecl_rft_file_get_well_time_rft(rft_file , "OP_2" , ecl_util_make_date(10, 10, 2008)) != NULL );
-    BOOST_CHECK( ecl_rft_file_get_well_time_rft(rft_file , "OP_2" , ecl_util_make_date(10, 11, 2008)) != NULL );
+    BOOST_CHECK_EQUAL( 3U , rft.listOfRftReports().size() );
 
-    ecl_rft_file_free( rft_file );
+    std::shared_ptr<ecl_rft_file_type> ecl_rft( ecl_rft_file_alloc(rft_filename.c_str()), ecl_rft_file_free );
+    BOOST_CHECK_EQUAL( 3 , ecl_rft_file_get_size( ecl_rft.get() ));
+    BOOST_CHECK( rft.hasRft("OP_1", 2008, 10, 10) );
+    BOOST_CHECK( rft.hasRft("OP_2", 2008, 10, 10) );
+    BOOST_CHECK( rft.hasRft("OP_2", 2008, 11, 10) );
 }
 }
 
@@ -18,6 +18,7 @@
 #include "config.h"
 
 #include <cstdlib>
+#include <fstream>
 
 #define BOOST_TEST_MODULE EclipseIO
 #include <boost/test/unit_test.hpp>
@@ -38,6 +39,7 @@
 #include <opm/parser/eclipse/Utility/Functional.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp>
 
+#include <opm/io/eclipse/Columnar.hpp>
 #include <opm/io/eclipse/OutputStream.hpp>
 
 // ERT stuff
@@ -557,6 +559,33 @@ BOOST_AUTO_TEST_CASE(EclipseReadWriteWellStateData) {
 }
 
 
+BOOST_AUTO_TEST_CASE(EclipseReadWriteWellStateData_Columnar) {
+    std::vector<RestartKey> keys {{"PRESSURE" , UnitSystem::measure::pressure},
+                                  {"SWAT" , UnitSystem::measure::identity},
+                                  {"SGAS" , UnitSystem::measure::identity},
+                                  {"TEMP" , UnitSystem::measure::temperature}};
+    test_work_area_type * test_area = test_work_area_alloc("test_restart_columnar");
+    test_work_area_copy_file( test_area, "FIRST_SIM.DATA");
+
+    Setup setup("FIRST_SIM.DATA");
+    EclipseIO eclWriter( setup.es, setup.grid, setup.schedule, setup.summary_config,
+                         EclipseIO::Backend::Columnar );
+    SummaryState st;
+    auto state1 = first_sim( setup.es , eclWriter , st, false );
+
+    // The restart step is only available from the columnar container.
+    using OS = EclIO::OutputStream::Columnar;
+    const auto rstDir = OS::directory( { ".", "FIRST_SIM" }, OS::Section::Restart, 1 );
+    BOOST_CHECK( EclIO::EColumnar( rstDir ).hasKey( "OPM_XWEL" ) );
+    BOOST_CHECK( !std::ifstream( "FIRST_SIM.UNRST" ) );
+
+    auto state2 = second_sim( eclWriter , st , keys );
+    compare(state1, state2 , keys);
+
+    BOOST_CHECK_THROW( second_sim( eclWriter, st, {{"SOIL", UnitSystem::measure::pressure, true}}) , std::runtime_error );
+    test_work_area_free( test_area );
+}
+
 BOOST_AUTO_TEST_CASE(ECL_FORMATTED) {
     namespace OS = ::Opm::EclIO::OutputStream;
 
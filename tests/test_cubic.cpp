@@ -44,6 +44,10 @@
 
 /* --- our own headers --- */
 #include <opm/common/utility/numeric/MonotCubicInterpolator.hpp>
+
+#include <algorithm>
+#include <vector>
+
 using namespace Opm;
 
 BOOST_AUTO_TEST_SUITE ()
@@ -65,4 +69,57 @@ BOOST_AUTO_TEST_CASE (cubic)
     BOOST_REQUIRE_CLOSE (interp.evaluate(4.0), 2., 0.00001);
 }
 
+BOOST_AUTO_TEST_CASE (cubic_batch)
+{
+    const std::vector<double> x = {0.0, 1.0, 2.0, 3.5, 4.0};
+    const std::vector<double> f = {10.0, 21.0, 2.0, 2.0, -1.0};
+    MonotCubicInterpolator interp(x, f);
+
+    // Sorted input, including extrapolation and data points
+    std::vector<double> xs;
+    for (int i = 0; i <= 60; ++i) {
+        xs.push_back(-1.0 + i*0.1);
+    }
+    std::vector<double> fs = interp.evaluate(xs);
+    BOOST_REQUIRE_EQUAL (fs.size(), xs.size());
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        BOOST_CHECK_EQUAL (fs[i], interp.evaluate(xs[i]));
+    }
+
+    // Unsorted input
+    const std::vector<double> xu = {3.9, 0.5, 1.0, 5.0, -2.0, 2.25, 2.0, 0.0};
+    fs = interp.evaluate(xu);
+    for (std::size_t i = 0; i < xu.size(); ++i) {
+        BOOST_CHECK_EQUAL (fs[i], interp.evaluate(xu[i]));
+    }
+    BOOST_CHECK_EQUAL (fs[2], 21.);
+    BOOST_CHECK_EQUAL (fs[3], -1.);
+    BOOST_CHECK_EQUAL (fs[4], 10.);
+    BOOST_CHECK_EQUAL (fs[6], 2.);
+}
+
+BOOST_AUTO_TEST_CASE (cubic_addPair)
+{
+    MonotCubicInterpolator interp(std::vector<double>{2.0, 0.0, 1.0, 0.0},
+                                  std::vector<double>{2.0, 5.0, 1.0, 0.0});
+    BOOST_CHECK_EQUAL (interp.getSize(), 3);
+    BOOST_CHECK_EQUAL (interp.getMinimumX().first, 0.);
+    BOOST_CHECK_EQUAL (interp.getMinimumX().second, 0.);
+    BOOST_CHECK (interp.isStrictlyIncreasing());
+
+    interp.addPair(1.5, 1.5);
+    interp.addPair(2.0, 3.0);
+    BOOST_CHECK_EQUAL (interp.getSize(), 4);
+    BOOST_CHECK_EQUAL (interp.evaluate(1.5), 1.5);
+    BOOST_CHECK_EQUAL (interp.getMaximumF().second, 3.);
+
+    const std::vector<double> xv = interp.get_xVector();
+    BOOST_CHECK (std::is_sorted(xv.begin(), xv.end()));
+
+    interp.addPair(3.0, 3.0);
+    interp.shrinkFlatAreas();
+    BOOST_CHECK_EQUAL (interp.getSize(), 4);
+    BOOST_REQUIRE_CLOSE (interp.evaluate(1.75), 2.25, 0.00001);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,138 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+
+#define BOOST_TEST_MODULE LinearInterpolationTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/numeric/linearInterpolation.hpp>
+#include <opm/common/utility/numeric/PiecewiseLinearTable.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace {
+
+    std::vector<double> makeAbscissas(std::size_t n)
+    {
+        // Nonuniform, strictly increasing.
+        std::vector<double> x(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = -1.0 + i + 0.3*std::sin(double(i));
+        }
+        return x;
+    }
+
+    std::vector<double> makeValues(const std::vector<double>& x)
+    {
+        std::vector<double> y(x.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            y[i] = std::cos(x[i]) + 0.1*x[i];
+        }
+        return y;
+    }
+
+    std::vector<double> makeQueries(const std::vector<double>& xv)
+    {
+        // The nodes, midpoints and points outside the table, permuted
+        // by a stride which is prime to the number of points.
+        std::vector<double> x(xv);
+        for (std::size_t i = 0; i + 1 < xv.size(); ++i) {
+            x.push_back(0.5*(xv[i] + xv[i + 1]));
+        }
+        x.push_back(xv.front() - 2.5);
+        x.push_back(xv.back() + 3.5);
+
+        std::vector<double> scrambled;
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            scrambled.push_back(x[(i*7919) % x.size()]);
+        }
+        return scrambled;
+    }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(batch_matches_scalar)
+{
+    for (std::size_t n : { 2, 3, 4, 5, 10, 63, 64, 65, 1000 }) {
+        const auto xv = makeAbscissas(n);
+        const auto yv = makeValues(xv);
+        auto x = makeQueries(xv);
+        const std::size_t m = x.size();
+
+        std::vector<int> index(m);
+        std::vector<double> y(m), dy(m);
+
+        Opm::tableIndex(xv.data(), n, x.data(), index.data(), m);
+        Opm::linearInterpolation(xv.data(), yv.data(), n, x.data(), y.data(), m);
+        Opm::linearInterpolationDerivative(xv.data(), yv.data(), n, x.data(), dy.data(), m);
+        for (std::size_t q = 0; q < m; ++q) {
+            BOOST_CHECK_EQUAL(index[q], Opm::tableIndex(xv, x[q]));
+            BOOST_CHECK_EQUAL(y[q], Opm::linearInterpolation(xv, yv, x[q]));
+            BOOST_CHECK_EQUAL(dy[q], Opm::linearInterpolationDerivative(xv, yv, x[q]));
+        }
+
+        std::sort(x.begin(), x.end());
+        Opm::tableIndexSorted(xv.data(), n, x.data(), index.data(), m);
+        Opm::linearInterpolationSorted(xv.data(), yv.data(), n, x.data(), y.data(), m);
+        Opm::linearInterpolationDerivativeSorted(xv.data(), yv.data(), n, x.data(), dy.data(), m);
+        for (std::size_t q = 0; q < m; ++q) {
+            BOOST_CHECK_EQUAL(index[q], Opm::tableIndex(xv, x[q]));
+            BOOST_CHECK_EQUAL(y[q], Opm::linearInterpolation(xv, yv, x[q]));
+            BOOST_CHECK_EQUAL(dy[q], Opm::linearInterpolationDerivative(xv, yv, x[q]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(piecewise_linear_table)
+{
+    double xva[] = { -1.0, 2.0, 2.2, 3.0, 5.0 };
+    double yva[] = { 1.0, 2.0, 3.0, 4.0, 2.0 };
+    const std::vector<double> xv(std::begin(xva), std::end(xva));
+    const std::vector<double> yv(std::begin(yva), std::end(yva));
+    const Opm::PiecewiseLinearTable t(xv, yv);
+
+    BOOST_CHECK_EQUAL(t.domain().first, -1.0);
+    BOOST_CHECK_EQUAL(t.domain().second, 5.0);
+    for (std::size_t i = 0; i < xv.size(); ++i) {
+        BOOST_CHECK_EQUAL(t(xv[i]), yv[i]);
+    }
+    BOOST_CHECK_EQUAL(t(2.6), 3.5);
+    BOOST_CHECK_EQUAL(t.derivative(4.0), -1.0);
+    BOOST_CHECK_CLOSE(t(xv.front() - 1.0), 2.0/3.0, 1e-13);
+    BOOST_CHECK_CLOSE(t(xv.back() + 1.0), 1.0, 1e-13);
+
+    std::vector<double> x { 6.0, -2.0, 2.6, 4.0, 2.0, -1.0, 5.0, 0.5 };
+    std::vector<double> y(x.size()), dy(x.size());
+    t.evaluate(x.data(), y.data(), x.size());
+    t.derivative(x.data(), dy.data(), x.size());
+    for (std::size_t q = 0; q < x.size(); ++q) {
+        BOOST_CHECK_EQUAL(y[q], Opm::linearInterpolation(xv, yv, x[q]));
+        BOOST_CHECK_EQUAL(dy[q], Opm::linearInterpolationDerivative(xv, yv, x[q]));
+    }
+
+    std::sort(x.begin(), x.end());
+    t.evaluateSorted(x.data(), y.data(), x.size());
+    for (std::size_t q = 0; q < x.size(); ++q) {
+        BOOST_CHECK_EQUAL(y[q], t(x[q]));
+    }
+}